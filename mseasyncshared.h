@@ -11,9 +11,11 @@
 #include "mseoptional.h"
 #include "msemsearray.h"
 #include "msemsevector.h"
+#include "mseunorderedmap.h"
 #include "msepointerbasics.h"
 #ifndef MSE_ASYNCSHARED_NO_XSCOPE_DEPENDENCE
 #include "msescope.h"
+#include "msescopeatomic.h" /* for mse::impl::ns_atomic_wait */
 #endif // !MSE_ASYNCSHARED_NO_XSCOPE_DEPENDENCE
 #include <shared_mutex>
 #include <thread>
@@ -27,6 +29,33 @@
 #include <vector>
 #include <future>
 #include <map>
+#include <algorithm>
+#include <mutex>
+#include <cstdint>
+#include <limits>
+#include <deque>
+#include <list>
+#include <exception>
+#include <condition_variable>
+#include <functional>
+#include <array>
+#include <tuple>
+#ifdef MSE_ENABLE_LOCK_PROFILING
+#include <string>
+#include <ostream>
+#include <typeinfo>
+#endif // MSE_ENABLE_LOCK_PROFILING
+
+/* Support for awaitable (C++20 coroutine) lock acquisition is enabled when the compiler supports coroutines. It can be
+explicitly disabled by defining MSE_COROUTINES_DISABLED. */
+#if !defined(MSE_COROUTINES_DISABLED) && defined(__cpp_impl_coroutine) && defined(__has_include)
+#if (__cpp_impl_coroutine >= 201902L) && __has_include(<coroutine>)
+#define MSE_HAS_CXX20_COROUTINES
+#endif /*(__cpp_impl_coroutine >= 201902L) && __has_include(<coroutine>)*/
+#endif /*!defined(MSE_COROUTINES_DISABLED) && defined(__cpp_impl_coroutine) && defined(__has_include)*/
+#ifdef MSE_HAS_CXX20_COROUTINES
+#include <coroutine>
+#endif // MSE_HAS_CXX20_COROUTINES
 
 #if defined(MSE_SAFER_SUBSTITUTES_DISABLED) || defined(MSE_SAFERPTR_DISABLED)
 #define MSE_ASYNCSHAREDPOINTER_DISABLED
@@ -91,12 +120,659 @@ namespace mse {
 		_Ty& m_mutex_ref;
 	};
 
+#ifdef MSE_HAS_CXX20_COROUTINES
+	class co_task;
+	class co_scheduler;
+	class co_thread_pool_scheduler;
+
+	namespace impl {
+		namespace ns_co {
+			/* A (type-erased) record of a suspended task waiting for a lock to become available. */
+			struct CLockWaiter {
+				void(*m_wake_fn)(void*) = nullptr;
+				void* m_context = nullptr;
+				bool m_wants_exclusive_lock = true;
+			};
+
+			/* A record of the locks held (via the awaitable lock acquisition functions) by a (spawned) task, including those
+			held by the child tasks it awaits. The lock mutexes track their holders by thread, and tasks sharing a scheduler
+			thread are indistinguishable to them. So this record is used to detect a task requesting a lock that it would
+			have to wait for itself to release (which would leave it suspended indefinitely). (A task only ever runs on one
+			thread, so the record isn't accessed concurrently.) */
+			class CCoTaskHeldLocks {
+			public:
+				/* Returns true if the given lock request would have to wait for a lock held by the task to be released. */
+				bool would_wait_for_self(const void* mutex_id, bool wants_exclusive_lock) const {
+					for (const auto& entry : m_entries) {
+						if ((entry.m_mutex_id == mutex_id) && (wants_exclusive_lock || entry.m_exclusive)) {
+							return true;
+						}
+					}
+					return false;
+				}
+				void add(const void* mutex_id, bool exclusive) {
+					m_entries.push_back({ mutex_id, exclusive });
+				}
+				void remove(const void* mutex_id, bool exclusive) {
+					for (auto rit = m_entries.rbegin(); m_entries.rend() != rit; ++rit) {
+						if (((*rit).m_mutex_id == mutex_id) && ((*rit).m_exclusive == exclusive)) {
+							m_entries.erase(std::next(rit).base());
+							break;
+						}
+					}
+				}
+
+			private:
+				struct CEntry {
+					const void* m_mutex_id;
+					bool m_exclusive;
+				};
+				std::vector<CEntry> m_entries;
+			};
+
+			template<typename _TAccessLease, bool _Exclusive> class TAsyncSharedV2LockAwaiter;
+
+			/* The queue of runnable tasks serviced by a (single) scheduler thread. Tasks are pinned to the queue (and thus the
+			thread) they were spawned on. This is necessary because the lock pointers they may hold across suspension points
+			must be released by the same thread that acquired them. */
+			class CCoTaskQueue {
+			public:
+				struct CRunnable {
+					std::coroutine_handle<> m_handle;
+					/* If present, this function is called (on the scheduler thread) before the task is resumed. If it returns
+					false, the task is not resumed (it is presumed to have re-registered itself as a waiter). */
+					bool(*m_ready_fn)(void*) = nullptr;
+					void* m_ready_context = nullptr;
+				};
+
+				/* Tasks that were spawned but never run (because run() was never called) are destroyed along with the
+				queue, releasing the function objects and arguments they own. (Tasks that have started only remain queued
+				while waiting for a lock, and only if the queue is abandoned while they do.) */
+				~CCoTaskQueue() {
+					for (auto& runnable : m_runnables) {
+						if (!runnable.m_ready_fn) {
+							runnable.m_handle.destroy();
+						}
+					}
+				}
+
+				void post(const CRunnable& runnable) {
+					{
+						std::lock_guard<std::mutex> lock1(m_mutex);
+						m_runnables.push_back(runnable);
+					}
+					m_cv.notify_one();
+				}
+				inline void add_task(co_task&& task);
+				void task_completed() {
+					{
+						std::lock_guard<std::mutex> lock1(m_mutex);
+						assert(1 <= m_num_outstanding_tasks);
+						m_num_outstanding_tasks -= 1;
+					}
+					m_cv.notify_all();
+				}
+				void set_exception(std::exception_ptr eptr) {
+					std::lock_guard<std::mutex> lock1(m_mutex);
+					if (!m_exception) {
+						m_exception = eptr;
+					}
+				}
+				std::exception_ptr exception() {
+					std::lock_guard<std::mutex> lock1(m_mutex);
+					return m_exception;
+				}
+				void request_stop() {
+					{
+						std::lock_guard<std::mutex> lock1(m_mutex);
+						m_stop_requested = true;
+					}
+					m_cv.notify_all();
+				}
+
+				/* Runs tasks on the calling thread until there are none left. If wait_for_stop_request is true, it won't
+				return until request_stop() has (also) been called. */
+				void run(bool wait_for_stop_request) {
+					std::unique_lock<std::mutex> lock1(m_mutex);
+					while (true) {
+						m_cv.wait(lock1, [&]() { return (!m_runnables.empty())
+							|| ((0 == m_num_outstanding_tasks) && ((!wait_for_stop_request) || m_stop_requested)); });
+						if (m_runnables.empty()) {
+							break;
+						}
+						auto runnable = m_runnables.front();
+						m_runnables.pop_front();
+						lock1.unlock();
+						if ((!runnable.m_ready_fn) || runnable.m_ready_fn(runnable.m_ready_context)) {
+							runnable.m_handle.resume();
+						}
+						lock1.lock();
+					}
+				}
+
+			private:
+				std::mutex m_mutex;
+				std::condition_variable m_cv;
+				std::deque<CRunnable> m_runnables;
+				size_t m_num_outstanding_tasks = 0;
+				bool m_stop_requested = false;
+				std::exception_ptr m_exception;
+			};
+		}
+	}
+
+	/* co_task is the (C++20) coroutine type whose instances can be run by co_scheduler and co_thread_pool_scheduler, and
+	that can use the awaitable lock acquisition functions of access requesters (i.e. "co_await ar.async_writelock_ptr()").
+	A co_task can also co_await another co_task, which runs as part of the awaiting task. */
+	class co_task {
+	public:
+		class promise_type {
+		public:
+			co_task get_return_object() { return co_task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+			std::suspend_always initial_suspend() noexcept { return {}; }
+			struct final_awaiter {
+				bool await_ready() noexcept { return false; }
+				std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept {
+					auto& promise = handle.promise();
+					if (promise.m_continuation) {
+						/* The awaiting task resumes, and will destroy this (child) task. */
+						return promise.m_continuation;
+					}
+					/* A top-level (spawned) task destroys itself upon completion. */
+					auto queue_ptr = promise.m_queue_ptr;
+					handle.destroy();
+					if (queue_ptr) {
+						queue_ptr->task_completed();
+					}
+					return std::noop_coroutine();
+				}
+				void await_resume() noexcept {}
+			};
+			final_awaiter final_suspend() noexcept { return {}; }
+			void return_void() {}
+			void unhandled_exception() {
+				if (m_continuation) {
+					m_exception = std::current_exception();
+				}
+				else if (m_queue_ptr) {
+					m_queue_ptr->set_exception(std::current_exception());
+				}
+			}
+
+			mse::impl::ns_co::CCoTaskQueue* queue_ptr() const { return m_queue_ptr; }
+			/* The record of the locks held by the (spawned) task this (possibly child) task is running as part of. */
+			const std::shared_ptr<mse::impl::ns_co::CCoTaskHeldLocks>& held_locks_shptr() {
+				auto& shptr_ref = m_spawned_task_promise_ptr->m_held_locks_shptr;
+				if (!shptr_ref) {
+					shptr_ref = std::make_shared<mse::impl::ns_co::CCoTaskHeldLocks>();
+				}
+				return shptr_ref;
+			}
+
+		private:
+			mse::impl::ns_co::CCoTaskQueue* m_queue_ptr = nullptr;
+			std::coroutine_handle<> m_continuation;
+			std::exception_ptr m_exception;
+			promise_type* m_spawned_task_promise_ptr = this;
+			std::shared_ptr<mse::impl::ns_co::CCoTaskHeldLocks> m_held_locks_shptr;
+
+			friend class co_task;
+			friend class mse::impl::ns_co::CCoTaskQueue;
+		};
+
+		co_task(co_task&& src) noexcept : m_handle(src.m_handle) { src.m_handle = nullptr; }
+		~co_task() {
+			if (m_handle) {
+				m_handle.destroy();
+			}
+		}
+
+		/* Awaiting a co_task runs it (to completion) as part of the awaiting task. */
+		auto operator co_await() && {
+			struct awaiter {
+				std::coroutine_handle<promise_type> m_handle;
+				bool await_ready() const noexcept { return !m_handle; }
+				std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> awaiting_handle) noexcept {
+					m_handle.promise().m_queue_ptr = awaiting_handle.promise().m_queue_ptr;
+					m_handle.promise().m_spawned_task_promise_ptr = awaiting_handle.promise().m_spawned_task_promise_ptr;
+					m_handle.promise().m_continuation = awaiting_handle;
+					return m_handle;
+				}
+				void await_resume() {
+					if (m_handle && m_handle.promise().m_exception) {
+						std::rethrow_exception(m_handle.promise().m_exception);
+					}
+				}
+			};
+			return awaiter{ m_handle };
+		}
+
+	private:
+		explicit co_task(std::coroutine_handle<promise_type> handle) : m_handle(handle) {}
+		co_task(const co_task&) = delete;
+		co_task& operator=(const co_task&) = delete;
+		co_task& operator=(co_task&&) = delete;
+
+		std::coroutine_handle<promise_type> m_handle;
+
+		friend class mse::impl::ns_co::CCoTaskQueue;
+	};
+
+	namespace impl {
+		namespace ns_co {
+			inline void CCoTaskQueue::add_task(co_task&& task) {
+				if (!task.m_handle) { MSE_THROW(asyncshared_runtime_error("invalid task - CCoTaskQueue::add_task()")); }
+				auto handle = task.m_handle;
+				task.m_handle = nullptr;
+				handle.promise().m_queue_ptr = this;
+				{
+					std::lock_guard<std::mutex> lock1(m_mutex);
+					m_num_outstanding_tasks += 1;
+				}
+				post(CRunnable{ handle });
+			}
+
+			/* This coroutine owns (copies of) the given function object and arguments for the duration of the task, so
+			that coroutine functions (including lambdas with captures) that take their arguments by reference remain
+			valid. */
+			template<class _TFunction, class... _TArgs>
+			co_task owning_invoke(_TFunction function1, _TArgs... args) {
+				co_await function1(args...);
+			}
+		}
+	}
+
+	/* co_scheduler runs co_tasks on the thread that calls its run() member function. */
+	class co_scheduler {
+	public:
+		template<class _Fn, class... _Args>
+		void spawn(_Fn&& _Fx, _Args&&... _Ax) {
+			m_queue.add_task(mse::impl::ns_co::owning_invoke(std::forward<_Fn>(_Fx), std::forward<_Args>(_Ax)...));
+		}
+		/* Runs the spawned tasks until they have all completed. If any task exited via an exception, the (first such)
+		exception is rethrown. */
+		void run() {
+			m_queue.run(false);
+			if (auto eptr = m_queue.exception()) {
+				std::rethrow_exception(eptr);
+			}
+		}
+
+	private:
+		mse::impl::ns_co::CCoTaskQueue m_queue;
+	};
+
+	/* co_thread_pool_scheduler runs co_tasks on a fixed set of threads. Each task is assigned to a thread (round-robin)
+	when it is spawned, and runs only on that thread. Because the task will run on another thread, the arguments
+	(and function object) are required to be of a type that's safely passable to other threads. */
+	class co_thread_pool_scheduler {
+	public:
+		explicit co_thread_pool_scheduler(size_t num_threads = (std::max)(size_t(std::thread::hardware_concurrency()), size_t(1))) {
+			if (0 == num_threads) { MSE_THROW(asyncshared_runtime_error("invalid number of threads - co_thread_pool_scheduler")); }
+			for (size_t i = 0; num_threads > i; i += 1) {
+				m_queues.push_back(std::make_unique<mse::impl::ns_co::CCoTaskQueue>());
+			}
+			for (auto& queue_uqptr : m_queues) {
+				auto queue_ptr = queue_uqptr.get();
+				m_threads.emplace_back([queue_ptr]() { queue_ptr->run(true); });
+			}
+		}
+		~co_thread_pool_scheduler() {
+			stop_and_join_threads();
+		}
+
+		template<class _Fn, class... _Args>
+		void spawn(_Fn&& _Fx, _Args&&... _Ax) {
+			s_valid_if_passable(_Ax...); // ensure that the function arguments are of a safely passable type
+			s_valid_if_passable(_Fx);
+			auto& queue_ref = *(m_queues.at(m_next_queue_index % m_queues.size()));
+			m_next_queue_index += 1;
+			queue_ref.add_task(mse::impl::ns_co::owning_invoke(std::forward<_Fn>(_Fx), std::forward<_Args>(_Ax)...));
+		}
+		/* Waits for all the spawned tasks to complete, then stops the threads. If any task exited via an exception, the
+		(first such) exception is rethrown. */
+		void join() {
+			stop_and_join_threads();
+			for (auto& queue_uqptr : m_queues) {
+				if (auto eptr = queue_uqptr->exception()) {
+					std::rethrow_exception(eptr);
+				}
+			}
+		}
+
+	private:
+		co_thread_pool_scheduler(const co_thread_pool_scheduler&) = delete;
+		co_thread_pool_scheduler& operator=(const co_thread_pool_scheduler&) = delete;
+
+		void stop_and_join_threads() {
+			for (auto& queue_uqptr : m_queues) {
+				queue_uqptr->request_stop();
+			}
+			for (auto& thread_ref : m_threads) {
+				if (thread_ref.joinable()) {
+					thread_ref.join();
+				}
+			}
+		}
+		template<class _Ty, class... _Args>
+		static void s_valid_if_passable(const _Ty& arg1, _Args&&... _Ax) {
+			mse::impl::async_passable(arg1);
+			s_valid_if_passable(_Ax...);
+		}
+		static void s_valid_if_passable() {}
+
+		std::vector<std::unique_ptr<mse::impl::ns_co::CCoTaskQueue> > m_queues;
+		std::vector<std::thread> m_threads;
+		size_t m_next_queue_index = 0;
+	};
+#endif // MSE_HAS_CXX20_COROUTINES
+
+	/* The following shared mutexes can be used (instead of the default std::shared_timed_mutex, whose fairness is
+	implementation defined) as the underlying mutex of the access requesters' (recursive) access mutex, via the
+	_TSharedMutex template parameter of TAsyncSharedV2ReadWriteAccessRequester<> and TAsyncSharedV2ReadOnlyAccessRequester<>.
+	reader_preferring_shared_timed_mutex admits readers whenever no writer holds the lock, which maximizes read throughput
+	but can starve writers. writer_preferring_shared_timed_mutex stops admitting new readers once a writer is waiting, which
+	can starve readers. fifo_shared_timed_mutex grants the lock in the order it was requested (admitting consecutive
+	readers together), so no request can be starved, at some cost in throughput. */
+	namespace impl {
+		namespace ns_shared_mutex {
+			class CPreferringSharedTimedMutexBase {
+			public:
+				CPreferringSharedTimedMutexBase() {}
+				CPreferringSharedTimedMutexBase(const CPreferringSharedTimedMutexBase&) = delete;
+				CPreferringSharedTimedMutexBase& operator=(const CPreferringSharedTimedMutexBase&) = delete;
+
+			protected:
+				bool writer_can_enter() const { return (!m_writer_entered) && (0 == m_reader_count); }
+
+				std::mutex m_mutex;
+				std::condition_variable m_reader_cv;
+				std::condition_variable m_writer_cv;
+				size_t m_reader_count = 0;
+				bool m_writer_entered = false;
+			};
+		}
+	}
+
+	class reader_preferring_shared_timed_mutex : private mse::impl::ns_shared_mutex::CPreferringSharedTimedMutexBase {
+	public:
+		void lock() {
+			std::unique_lock<std::mutex> lock1(m_mutex);
+			m_writer_cv.wait(lock1, [this]() { return writer_can_enter(); });
+			m_writer_entered = true;
+		}
+		bool try_lock() {
+			std::lock_guard<std::mutex> lock1(m_mutex);
+			if (!writer_can_enter()) { return false; }
+			m_writer_entered = true;
+			return true;
+		}
+		template<class _Rep, class _Period>
+		bool try_lock_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {
+			return try_lock_until(std::chrono::steady_clock::now() + _Rel_time);
+		}
+		template<class _Clock, class _Duration>
+		bool try_lock_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
+			std::unique_lock<std::mutex> lock1(m_mutex);
+			const bool acquired = m_writer_cv.wait_until(lock1, _Abs_time, [this]() { return writer_can_enter(); });
+			if (acquired) { m_writer_entered = true; }
+			return acquired;
+		}
+		void unlock() {
+			{
+				std::lock_guard<std::mutex> lock1(m_mutex);
+				m_writer_entered = false;
+			}
+			m_reader_cv.notify_all();
+			m_writer_cv.notify_one();
+		}
+
+		void lock_shared() {
+			std::unique_lock<std::mutex> lock1(m_mutex);
+			m_reader_cv.wait(lock1, [this]() { return !m_writer_entered; });
+			m_reader_count += 1;
+		}
+		bool try_lock_shared() {
+			std::lock_guard<std::mutex> lock1(m_mutex);
+			if (m_writer_entered) { return false; }
+			m_reader_count += 1;
+			return true;
+		}
+		template<class _Rep, class _Period>
+		bool try_lock_shared_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {
+			return try_lock_shared_until(std::chrono::steady_clock::now() + _Rel_time);
+		}
+		template<class _Clock, class _Duration>
+		bool try_lock_shared_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
+			std::unique_lock<std::mutex> lock1(m_mutex);
+			if (!m_reader_cv.wait_until(lock1, _Abs_time, [this]() { return !m_writer_entered; })) { return false; }
+			m_reader_count += 1;
+			return true;
+		}
+		void unlock_shared() {
+			bool last_reader = false;
+			{
+				std::lock_guard<std::mutex> lock1(m_mutex);
+				m_reader_count -= 1;
+				last_reader = (0 == m_reader_count);
+			}
+			if (last_reader) { m_writer_cv.notify_one(); }
+		}
+	};
+
+	class writer_preferring_shared_timed_mutex : private mse::impl::ns_shared_mutex::CPreferringSharedTimedMutexBase {
+	public:
+		void lock() {
+			std::unique_lock<std::mutex> lock1(m_mutex);
+			m_waiting_writer_count += 1;
+			m_writer_cv.wait(lock1, [this]() { return writer_can_enter(); });
+			m_waiting_writer_count -= 1;
+			m_writer_entered = true;
+		}
+		bool try_lock() {
+			std::lock_guard<std::mutex> lock1(m_mutex);
+			if (!writer_can_enter()) { return false; }
+			m_writer_entered = true;
+			return true;
+		}
+		template<class _Rep, class _Period>
+		bool try_lock_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {
+			return try_lock_until(std::chrono::steady_clock::now() + _Rel_time);
+		}
+		template<class _Clock, class _Duration>
+		bool try_lock_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
+			std::unique_lock<std::mutex> lock1(m_mutex);
+			m_waiting_writer_count += 1;
+			const bool acquired = m_writer_cv.wait_until(lock1, _Abs_time, [this]() { return writer_can_enter(); });
+			m_waiting_writer_count -= 1;
+			if (acquired) {
+				m_writer_entered = true;
+			}
+			else {
+				/* Readers that were held back on account of this (no longer) waiting writer may now be admitted. (And if
+				this writer was notified just as it timed out, the notification is passed along.) */
+				notify_while_locked(lock1);
+			}
+			return acquired;
+		}
+		void unlock() {
+			std::unique_lock<std::mutex> lock1(m_mutex);
+			m_writer_entered = false;
+			notify_while_locked(lock1);
+		}
+
+		void lock_shared() {
+			std::unique_lock<std::mutex> lock1(m_mutex);
+			m_reader_cv.wait(lock1, [this]() { return reader_can_enter(); });
+			m_reader_count += 1;
+		}
+		bool try_lock_shared() {
+			std::lock_guard<std::mutex> lock1(m_mutex);
+			if (!reader_can_enter()) { return false; }
+			m_reader_count += 1;
+			return true;
+		}
+		template<class _Rep, class _Period>
+		bool try_lock_shared_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {
+			return try_lock_shared_until(std::chrono::steady_clock::now() + _Rel_time);
+		}
+		template<class _Clock, class _Duration>
+		bool try_lock_shared_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
+			std::unique_lock<std::mutex> lock1(m_mutex);
+			if (!m_reader_cv.wait_until(lock1, _Abs_time, [this]() { return reader_can_enter(); })) { return false; }
+			m_reader_count += 1;
+			return true;
+		}
+		void unlock_shared() {
+			bool last_reader = false;
+			{
+				std::lock_guard<std::mutex> lock1(m_mutex);
+				m_reader_count -= 1;
+				last_reader = (0 == m_reader_count);
+			}
+			if (last_reader) { m_writer_cv.notify_one(); }
+		}
+
+	private:
+		bool reader_can_enter() const { return (!m_writer_entered) && (0 == m_waiting_writer_count); }
+		void notify_while_locked(std::unique_lock<std::mutex>& lock1) {
+			const bool writer_is_waiting = (0 != m_waiting_writer_count);
+			lock1.unlock();
+			if (writer_is_waiting) {
+				m_writer_cv.notify_one();
+			}
+			else {
+				m_reader_cv.notify_all();
+			}
+		}
+
+		size_t m_waiting_writer_count = 0;
+	};
+
+	class fifo_shared_timed_mutex {
+	public:
+		fifo_shared_timed_mutex() {}
+		fifo_shared_timed_mutex(const fifo_shared_timed_mutex&) = delete;
+		fifo_shared_timed_mutex& operator=(const fifo_shared_timed_mutex&) = delete;
+
+		void lock() {
+			std::unique_lock<std::mutex> lock1(m_mutex);
+			if (try_enter_while_locked(true)) { return; }
+			CWaiter waiter(true);
+			m_waiters.push_back(&waiter);
+			waiter.m_cv.wait(lock1, [&waiter]() { return waiter.m_granted; });
+		}
+		bool try_lock() {
+			std::lock_guard<std::mutex> lock1(m_mutex);
+			return try_enter_while_locked(true);
+		}
+		template<class _Rep, class _Period>
+		bool try_lock_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {
+			return try_lock_until(std::chrono::steady_clock::now() + _Rel_time);
+		}
+		template<class _Clock, class _Duration>
+		bool try_lock_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
+			return try_enter_until(true, _Abs_time);
+		}
+		void unlock() {
+			std::lock_guard<std::mutex> lock1(m_mutex);
+			m_writer_entered = false;
+			grant_while_locked();
+		}
+
+		void lock_shared() {
+			std::unique_lock<std::mutex> lock1(m_mutex);
+			if (try_enter_while_locked(false)) { return; }
+			CWaiter waiter(false);
+			m_waiters.push_back(&waiter);
+			waiter.m_cv.wait(lock1, [&waiter]() { return waiter.m_granted; });
+		}
+		bool try_lock_shared() {
+			std::lock_guard<std::mutex> lock1(m_mutex);
+			return try_enter_while_locked(false);
+		}
+		template<class _Rep, class _Period>
+		bool try_lock_shared_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {
+			return try_lock_shared_until(std::chrono::steady_clock::now() + _Rel_time);
+		}
+		template<class _Clock, class _Duration>
+		bool try_lock_shared_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
+			return try_enter_until(false, _Abs_time);
+		}
+		void unlock_shared() {
+			std::lock_guard<std::mutex> lock1(m_mutex);
+			m_reader_count -= 1;
+			if (0 == m_reader_count) {
+				grant_while_locked();
+			}
+		}
+
+	private:
+		/* Each blocked request waits on its own condition variable, so releasing the lock wakes only the requests that are
+		granted it. */
+		struct CWaiter {
+			CWaiter(bool exclusive) : m_exclusive(exclusive) {}
+			std::condition_variable m_cv;
+			bool m_exclusive = false;
+			bool m_granted = false;
+		};
+
+		bool can_enter_while_locked(bool exclusive) const {
+			return exclusive ? ((!m_writer_entered) && (0 == m_reader_count)) : (!m_writer_entered);
+		}
+		void enter_while_locked(bool exclusive) {
+			if (exclusive) {
+				m_writer_entered = true;
+			}
+			else {
+				m_reader_count += 1;
+			}
+		}
+		/* A request is only admitted immediately if there are no earlier requests still waiting. */
+		bool try_enter_while_locked(bool exclusive) {
+			if ((!m_waiters.empty()) || (!can_enter_while_locked(exclusive))) { return false; }
+			enter_while_locked(exclusive);
+			return true;
+		}
+		/* Grants the lock to the waiting requests at the front of the queue, for as long as they're compatible. */
+		void grant_while_locked() {
+			while ((!m_waiters.empty()) && can_enter_while_locked(m_waiters.front()->m_exclusive)) {
+				auto waiter_ptr = m_waiters.front();
+				m_waiters.pop_front();
+				enter_while_locked(waiter_ptr->m_exclusive);
+				waiter_ptr->m_granted = true;
+				waiter_ptr->m_cv.notify_one();
+			}
+		}
+		template<class _Clock, class _Duration>
+		bool try_enter_until(bool exclusive, const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
+			std::unique_lock<std::mutex> lock1(m_mutex);
+			if (try_enter_while_locked(exclusive)) { return true; }
+			CWaiter waiter(exclusive);
+			m_waiters.push_back(&waiter);
+			if (!waiter.m_cv.wait_until(lock1, _Abs_time, [&waiter]() { return waiter.m_granted; })) {
+				/* Withdraw the request. Its removal may allow the requests queued behind it to be granted. */
+				m_waiters.erase(std::find(m_waiters.begin(), m_waiters.end(), &waiter));
+				grant_while_locked();
+				return false;
+			}
+			return true;
+		}
+
+		std::mutex m_mutex;
+		std::deque<CWaiter*> m_waiters;
+		size_t m_reader_count = 0;
+		bool m_writer_entered = false;
+	};
+
 	/* Note that this "recursive_shared_timed_mutex" allows a thread to hold "read" (shared) locks and "write" locks at the
 	same time. It also provides "nonrecursive_lock()" member functions to obtain a lock that is exclusive within the thread
-	as well as between threads. */
-	class recursive_shared_timed_mutex : private std::shared_timed_mutex {
+	as well as between threads. TRecursiveSharedTimedMutex<> is the same, but built on the given (non-recursive) shared
+	mutex rather than std::shared_timed_mutex. */
+	template<class _TSharedMutex>
+	class TRecursiveSharedTimedMutex : private _TSharedMutex {
 	public:
-		typedef std::shared_timed_mutex base_class;
+		typedef _TSharedMutex base_class;
 
 		void lock()
 		{	// lock exclusive
@@ -110,7 +786,8 @@ namespace mse {
 			else {
 				bool the_shared_lock_of_this_thread_is_suspended_to_allow_an_exclusive_lock = false;
 				if (1 <= m_readlock_count) {
-					assert(0 == m_writelock_count);
+					/* (The read lock may be one held by another thread that also holds the write lock.) */
+					assert((0 == m_writelock_count) || m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock);
 					const auto this_thread_id = std::this_thread::get_id();
 					const auto found_it = m_thread_id_readlock_count_map.find(this_thread_id);
 					if (m_thread_id_readlock_count_map.end() != found_it) {
@@ -138,7 +815,7 @@ namespace mse {
 				while (true) {
 					{
 						unlock_guard<std::mutex> unlock1(m_state_mutex1);
-						base_class::lock();
+						base_lock();
 					}
 					if (m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock
 						&& (!the_shared_lock_of_this_thread_is_suspended_to_allow_an_exclusive_lock)) {
@@ -175,7 +852,8 @@ namespace mse {
 			else {
 				bool the_shared_lock_of_this_thread_is_suspended_to_allow_an_exclusive_lock = false;
 				if (1 <= m_readlock_count) {
-					assert(0 == m_writelock_count);
+					/* (The read lock may be one held by another thread that also holds the write lock.) */
+					assert((0 == m_writelock_count) || m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock);
 					const auto this_thread_id = std::this_thread::get_id();
 					const auto found_it = m_thread_id_readlock_count_map.find(this_thread_id);
 					if (m_thread_id_readlock_count_map.end() != found_it) {
@@ -202,7 +880,7 @@ namespace mse {
 							{
 								/* reacquire the shared_lock that was released to facilitate the attempt to acquire an exclusive lock */
 								unlock_guard<std::mutex> unlock1(m_state_mutex1);
-								base_class::lock_shared();
+								base_lock_shared();
 							}
 							assert(m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock);
 							m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock = false;
@@ -244,7 +922,8 @@ namespace mse {
 			else {
 				bool the_shared_lock_of_this_thread_is_suspended_to_allow_an_exclusive_lock = false;
 				if (1 <= m_readlock_count) {
-					assert(0 == m_writelock_count);
+					/* (The read lock may be one held by another thread that also holds the write lock.) */
+					assert((0 == m_writelock_count) || m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock);
 					const auto this_thread_id = std::this_thread::get_id();
 					const auto found_it = m_thread_id_readlock_count_map.find(this_thread_id);
 					if (m_thread_id_readlock_count_map.end() != found_it) {
@@ -290,7 +969,7 @@ namespace mse {
 							{
 								/* reacquire the shared_lock that was released to facilitate the attempt to acquire an exclusive lock */
 								unlock_guard<std::mutex> unlock1(m_state_mutex1);
-								base_class::lock_shared();
+								base_lock_shared();
 							}
 							assert(m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock);
 							m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock = false;
@@ -309,7 +988,23 @@ namespace mse {
 
 		void unlock()
 		{	// unlock exclusive
+#ifdef MSE_HAS_CXX20_COROUTINES
+			std::vector<mse::impl::ns_co::CLockWaiter> co_waiters_to_wake;
+			{
+				std::lock_guard<std::mutex> lock1(m_state_mutex1);
+				unlock_while_state_is_locked();
+				take_co_waiters_to_wake_while_state_is_locked(co_waiters_to_wake);
+			}
+			s_wake_co_waiters(co_waiters_to_wake);
+#else // MSE_HAS_CXX20_COROUTINES
 			std::lock_guard<std::mutex> lock1(m_state_mutex1);
+			unlock_while_state_is_locked();
+#endif // MSE_HAS_CXX20_COROUTINES
+		}
+
+	private:
+		void unlock_while_state_is_locked()
+		{
 			if (std::this_thread::get_id() != m_writelock_or_suspended_shared_lock_thread_id) {
 				MSE_THROW(std::system_error(std::make_error_code(std::errc::no_lock_available)));
 			}
@@ -332,7 +1027,7 @@ namespace mse {
 						/* We need to reacquire the shared_lock that was suspended to make way for the exclusive_lock we
 						just released. */
 						unlock_guard<std::mutex> unlock1(m_state_mutex1);
-						base_class::lock_shared();
+						base_lock_shared();
 					}
 					m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock = false;
 				}
@@ -340,6 +1035,7 @@ namespace mse {
 			m_writelock_count -= 1;
 		}
 
+	public:
 		void nonrecursive_lock()
 		{	// lock nonrecursive
 			std::lock_guard<std::mutex> lock1(m_state_mutex1);
@@ -361,7 +1057,7 @@ namespace mse {
 				while (true) {
 					{
 						unlock_guard<std::mutex> unlock1(m_state_mutex1);
-						base_class::lock();
+						base_lock();
 					}
 					if (m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock
 						/*&& (!the_shared_lock_of_this_thread_is_suspended_to_allow_an_exclusive_lock)*/) {
@@ -381,8 +1077,14 @@ namespace mse {
 
 		bool try_nonrecursive_lock()
 		{	// try to lock nonrecursive
-			bool retval = false;
 			std::lock_guard<std::mutex> lock1(m_state_mutex1);
+			return try_nonrecursive_lock_while_state_is_locked();
+		}
+
+	private:
+		bool try_nonrecursive_lock_while_state_is_locked()
+		{
+			bool retval = false;
 
 			if (m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock) {
 				return false;
@@ -411,6 +1113,7 @@ namespace mse {
 			return retval;
 		}
 
+	public:
 		template<class _Rep, class _Period>
 		bool try_nonrecursive_lock_for(const std::chrono::duration<_Rep, _Period>& _Rel_time)
 		{	// try to nonrecursive lock for duration
@@ -463,7 +1166,23 @@ namespace mse {
 
 		void nonrecursive_unlock()
 		{	// unlock nonrecursive
+#ifdef MSE_HAS_CXX20_COROUTINES
+			std::vector<mse::impl::ns_co::CLockWaiter> co_waiters_to_wake;
+			{
+				std::lock_guard<std::mutex> lock1(m_state_mutex1);
+				nonrecursive_unlock_while_state_is_locked();
+				take_co_waiters_to_wake_while_state_is_locked(co_waiters_to_wake);
+			}
+			s_wake_co_waiters(co_waiters_to_wake);
+#else // MSE_HAS_CXX20_COROUTINES
 			std::lock_guard<std::mutex> lock1(m_state_mutex1);
+			nonrecursive_unlock_while_state_is_locked();
+#endif // MSE_HAS_CXX20_COROUTINES
+		}
+
+	private:
+		void nonrecursive_unlock_while_state_is_locked()
+		{
 			if (std::this_thread::get_id() != m_writelock_or_suspended_shared_lock_thread_id) {
 				MSE_THROW(std::system_error(std::make_error_code(std::errc::no_lock_available)));
 			}
@@ -477,6 +1196,7 @@ namespace mse {
 			m_writelock_count -= 1;
 		}
 
+	public:
 		void lock_shared()
 		{	// lock non-exclusive
 			std::lock_guard<std::mutex> lock1(m_state_mutex1);
@@ -504,7 +1224,7 @@ namespace mse {
 				assert((m_thread_id_readlock_count_map.end() == found_it) || (0 == (*found_it).second));
 				{
 					unlock_guard<std::mutex> unlock1(m_state_mutex1);
-					base_class::lock_shared();
+					base_lock_shared();
 				}
 				try {
 					/* Things could've changed so we have to check again. */
@@ -528,8 +1248,14 @@ namespace mse {
 
 		bool try_lock_shared()
 		{	// try to lock non-exclusive
-			bool retval = false;
 			std::lock_guard<std::mutex> lock1(m_state_mutex1);
+			return try_lock_shared_while_state_is_locked();
+		}
+
+	private:
+		bool try_lock_shared_while_state_is_locked()
+		{
+			bool retval = false;
 
 			const auto this_thread_id = std::this_thread::get_id();
 			const auto found_it = m_thread_id_readlock_count_map.find(this_thread_id);
@@ -577,6 +1303,7 @@ namespace mse {
 			return retval;
 		}
 
+	public:
 		template<class _Rep, class _Period>
 		bool try_lock_shared_for(const std::chrono::duration<_Rep, _Period>& _Rel_time)
 		{	// try to lock non-exclusive for relative time
@@ -640,7 +1367,23 @@ namespace mse {
 
 		void unlock_shared()
 		{	// unlock non-exclusive
+#ifdef MSE_HAS_CXX20_COROUTINES
+			std::vector<mse::impl::ns_co::CLockWaiter> co_waiters_to_wake;
+			{
+				std::lock_guard<std::mutex> lock1(m_state_mutex1);
+				unlock_shared_while_state_is_locked();
+				take_co_waiters_to_wake_while_state_is_locked(co_waiters_to_wake);
+			}
+			s_wake_co_waiters(co_waiters_to_wake);
+#else // MSE_HAS_CXX20_COROUTINES
 			std::lock_guard<std::mutex> lock1(m_state_mutex1);
+			unlock_shared_while_state_is_locked();
+#endif // MSE_HAS_CXX20_COROUTINES
+		}
+
+	private:
+		void unlock_shared_while_state_is_locked()
+		{
 
 			const auto this_thread_id = std::this_thread::get_id();
 			const auto found_it = m_thread_id_readlock_count_map.find(this_thread_id);
@@ -667,33 +1410,577 @@ namespace mse {
 			m_readlock_count -= 1;
 		}
 
-		//std::mutex m_write_mutex;
-		//std::mutex m_read_mutex;
-		std::mutex m_state_mutex1;
-
-		std::thread::id m_writelock_or_suspended_shared_lock_thread_id;
-		int m_writelock_count = 0;
-		bool m_writelock_is_nonrecursive = false;
-		std::unordered_map<std::thread::id, int> m_thread_id_readlock_count_map;
-		int m_readlock_count = 0;
-		bool m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock = false;
-	};
-
-	//typedef std::shared_timed_mutex async_shared_timed_mutex_type;
-	typedef recursive_shared_timed_mutex async_shared_timed_mutex_type;
-
-
-	/* nii_vector<> qualifies as safely shareable, but its corresponding make_xscope_vector_size_change_lock_guard() function
-	only supports non-const reference arguments. So we provide mtnii_vector<> whose corresponding
-	make_xscope_vector_size_change_lock_guard() function does support const reference arguments. But in order to achieve this
-	while maintaining thread safety (and maximal performance), it needs a partially thread safe shared mutex. */
-	typedef T_shared_mutex<bool, std::atomic<size_t> > mtnii_vector_shared_mutex;
-
-	template<class _Ty, class _A = std::allocator<_Ty>, class _TStateMutex = mse::mtnii_vector_shared_mutex>
-	class mtnii_vector : public mse::us::impl::gnii_vector<_Ty, _A, mse::mtnii_vector_shared_mutex> {
+#ifdef MSE_HAS_CXX20_COROUTINES
 	public:
-		typedef mse::us::impl::gnii_vector<_Ty, _A, mse::mtnii_vector_shared_mutex> base_class;
-
+		/* These functions support awaitable (coroutine) lock acquisition. If the lock cannot be (immediately) obtained, the
+		given waiter is registered, and its "wake" function will be called when the lock may have become available. Waiters
+		are woken in the order they were registered. Waiters that are retrying after having been woken retain their place at
+		the front of the queue. The (nonrecursive) exclusive lock obtained is exclusive within the thread as well as
+		between threads, so that tasks sharing a thread also exclude each other. */
+		bool try_nonrecursive_lock_or_add_waiter(const mse::impl::ns_co::CLockWaiter& waiter, bool is_retry = false) {
+			bool wake_immediately = false;
+			{
+				std::lock_guard<std::mutex> lock1(m_state_mutex1);
+				if (try_nonrecursive_lock_while_state_is_locked()) {
+					return true;
+				}
+				if ((0 == m_writelock_count) && (0 == m_readlock_count) && (!m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock)) {
+					/* The lock seems to be available (so there may be no pending unlock to wake the waiter), but the attempt
+					to obtain it failed anyway (spuriously, or due to a not yet registered acquisition by another thread). */
+					wake_immediately = true;
+				}
+				else {
+					add_co_waiter_while_state_is_locked(waiter, is_retry);
+				}
+			}
+			if (wake_immediately) {
+				s_wake_co_waiter_immediately(waiter, is_retry);
+			}
+			return false;
+		}
+		bool try_lock_shared_or_add_waiter(const mse::impl::ns_co::CLockWaiter& waiter, bool is_retry = false) {
+			bool wake_immediately = false;
+			{
+				std::lock_guard<std::mutex> lock1(m_state_mutex1);
+				if (try_lock_shared_while_state_is_locked()) {
+					return true;
+				}
+				if ((0 == m_writelock_count) && (0 == m_readlock_count)) {
+					wake_immediately = true;
+				}
+				else {
+					/* If the lock is held (by readers, say, ahead of a writer waiting on the underlying mutex), the
+					release will wake the waiter. */
+					add_co_waiter_while_state_is_locked(waiter, is_retry);
+				}
+			}
+			if (wake_immediately) {
+				s_wake_co_waiter_immediately(waiter, is_retry);
+			}
+			return false;
+		}
+
+	private:
+		void add_co_waiter_while_state_is_locked(const mse::impl::ns_co::CLockWaiter& waiter, bool is_retry) {
+			if (!m_co_waiters_ptr) {
+				m_co_waiters_ptr = std::make_unique<std::deque<mse::impl::ns_co::CLockWaiter> >();
+			}
+			auto& co_waiters = *m_co_waiters_ptr;
+			if (is_retry) {
+				co_waiters.push_front(waiter);
+			}
+			else {
+				co_waiters.push_back(waiter);
+			}
+		}
+		/* Removes the waiter at the front of the queue (along with any immediately following waiters that, like it, want
+		a shared lock) so that they can be woken after the state mutex is released. */
+		void take_co_waiters_to_wake_while_state_is_locked(std::vector<mse::impl::ns_co::CLockWaiter>& waiters_to_wake) {
+			if ((!m_co_waiters_ptr) || m_co_waiters_ptr->empty()) {
+				return;
+			}
+			auto& co_waiters = *m_co_waiters_ptr;
+			const bool wants_exclusive_lock = co_waiters.front().m_wants_exclusive_lock;
+			waiters_to_wake.push_back(co_waiters.front());
+			co_waiters.pop_front();
+			if (!wants_exclusive_lock) {
+				while ((!co_waiters.empty()) && (!co_waiters.front().m_wants_exclusive_lock)) {
+					waiters_to_wake.push_back(co_waiters.front());
+					co_waiters.pop_front();
+				}
+			}
+		}
+		/* A waiter that is woken immediately (because no pending release would wake it) is retried on its scheduler
+		thread. So that a waiter that keeps failing (while another thread is in the process of acquiring the lock) doesn't
+		monopolize that thread, retries first yield the thread. */
+		static void s_wake_co_waiter_immediately(const mse::impl::ns_co::CLockWaiter& waiter, bool is_retry) {
+			if (is_retry) {
+				std::this_thread::yield();
+			}
+			waiter.m_wake_fn(waiter.m_context);
+		}
+		static void s_wake_co_waiters(const std::vector<mse::impl::ns_co::CLockWaiter>& waiters_to_wake) {
+			for (const auto& waiter : waiters_to_wake) {
+				waiter.m_wake_fn(waiter.m_context);
+			}
+		}
+
+		/* The waiter queue is only allocated once a waiter is registered, as (an empty) std::deque<> may itself occupy (or
+		allocate) a significant amount of memory, and most mutexes are never waited on by a task. */
+		std::unique_ptr<std::deque<mse::impl::ns_co::CLockWaiter> > m_co_waiters_ptr;
+#endif // MSE_HAS_CXX20_COROUTINES
+
+		/* Acquire the underlying mutex, noting (when stats are enabled) whether we had to wait for it. */
+		void base_lock() {
+#ifdef MSE_ENABLE_STATS
+			if (base_class::try_lock()) { return; }
+			MSE_STATS_INCREMENT(mutex_lock_wait);
+#endif // MSE_ENABLE_STATS
+			base_class::lock();
+		}
+		void base_lock_shared() {
+#ifdef MSE_ENABLE_STATS
+			if (base_class::try_lock_shared()) { return; }
+			MSE_STATS_INCREMENT(mutex_lock_wait);
+#endif // MSE_ENABLE_STATS
+			base_class::lock_shared();
+		}
+
+		//std::mutex m_write_mutex;
+		//std::mutex m_read_mutex;
+		std::mutex m_state_mutex1;
+
+		std::thread::id m_writelock_or_suspended_shared_lock_thread_id;
+		int m_writelock_count = 0;
+		bool m_writelock_is_nonrecursive = false;
+		std::unordered_map<std::thread::id, int> m_thread_id_readlock_count_map;
+		int m_readlock_count = 0;
+		bool m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock = false;
+	};
+
+	class recursive_shared_timed_mutex : public TRecursiveSharedTimedMutex<std::shared_timed_mutex> {};
+
+#ifdef MSE_ENABLE_LOCK_PROFILING
+	/* When MSE_ENABLE_LOCK_PROFILING is defined, the mutexes used by the (V2) access requesters record contention
+	statistics (acquisition counts, a histogram of the time spent waiting to acquire the lock, the longest times the
+	lock was held and by which threads), which can be obtained (or dumped) at run-time via mse::stats::lock_profiles()
+	(or mse::stats::dump_lock_profiles()). Otherwise the mutexes are not instrumented at all. */
+	namespace stats {
+		struct lock_holder_t {
+			std::thread::id thread_id;
+			std::chrono::nanoseconds hold_time{ 0 };
+			bool exclusive = false;
+		};
+
+		struct lock_profile_t {
+			/* Bucket 0 of the wait time histogram counts the acquisitions that didn't have to wait. Bucket 1 counts waits
+			of less than one microsecond, and each subsequent bucket i counts waits of less than 2^(i - 1) microseconds
+			(and at least 2^(i - 2) microseconds). The last bucket also counts any longer waits. */
+			static const size_t number_of_wait_time_buckets = 24;
+			static const size_t max_number_of_longest_holders = 4;
+
+			lock_profile_t() { wait_time_histogram.fill(0); }
+
+			std::string name;
+			const void* mutex_address = nullptr;
+			bool mutex_destroyed = false;
+			uint64_t exclusive_acquisitions = 0;
+			uint64_t shared_acquisitions = 0;
+			uint64_t contended_acquisitions = 0;
+			std::array<uint64_t, number_of_wait_time_buckets> wait_time_histogram;
+			std::chrono::nanoseconds total_wait_time{ 0 };
+			std::chrono::nanoseconds max_wait_time{ 0 };
+			std::chrono::nanoseconds max_exclusive_hold_time{ 0 };
+			std::chrono::nanoseconds max_shared_hold_time{ 0 };
+			/* sorted from longest to shortest hold time */
+			std::vector<lock_holder_t> longest_holders;
+
+			static size_t wait_time_bucket_index(std::chrono::nanoseconds wait_time) {
+				size_t retval = 1;
+				auto wait_us = std::chrono::duration_cast<std::chrono::microseconds>(wait_time).count();
+				while ((0 < wait_us) && (number_of_wait_time_buckets - 1 > retval)) {
+					wait_us >>= 1;
+					retval += 1;
+				}
+				return retval;
+			}
+
+			void dump(std::ostream& os) const {
+				os << "mutex " << mutex_address;
+				if ("" != name) { os << " (" << name << ")"; }
+				if (mutex_destroyed) { os << " (destroyed)"; }
+				os << ":\n";
+				os << "  acquisitions: " << exclusive_acquisitions << " exclusive, " << shared_acquisitions << " shared, "
+					<< contended_acquisitions << " contended\n";
+				os << "  wait time: total " << total_wait_time.count() << "ns, max " << max_wait_time.count() << "ns\n";
+				os << "  wait time histogram:";
+				if (0 != wait_time_histogram[0]) { os << " no_wait: " << wait_time_histogram[0]; }
+				for (size_t i = 1; number_of_wait_time_buckets > i; i += 1) {
+					if (0 != wait_time_histogram[i]) {
+						os << " " << ((number_of_wait_time_buckets - 1 > i) ? "<" : ">=")
+							<< ((number_of_wait_time_buckets - 1 > i) ? (uint64_t(1) << (i - 1)) : (uint64_t(1) << (i - 2)))
+							<< "us: " << wait_time_histogram[i];
+					}
+				}
+				os << "\n";
+				os << "  max hold time: " << max_exclusive_hold_time.count() << "ns exclusive, " << max_shared_hold_time.count() << "ns shared\n";
+				for (const auto& holder : longest_holders) {
+					os << "  held " << (holder.exclusive ? "exclusively" : "shared") << " for " << holder.hold_time.count()
+						<< "ns by thread " << holder.thread_id << "\n";
+				}
+			}
+		};
+
+		namespace impl {
+			class CLockProfile;
+
+			class CLockProfileRegistry {
+			public:
+				void add(CLockProfile* profile_ptr) {
+					std::lock_guard<std::mutex> lock1(m_mutex);
+					m_live_profiles.push_back(profile_ptr);
+				}
+				inline void retire(CLockProfile* profile_ptr);
+				inline std::vector<lock_profile_t> profiles();
+
+			private:
+#ifndef MSE_LOCK_PROFILING_MAX_RETIRED
+#define MSE_LOCK_PROFILING_MAX_RETIRED 256
+#endif // !MSE_LOCK_PROFILING_MAX_RETIRED
+				std::mutex m_mutex;
+				std::vector<CLockProfile*> m_live_profiles;
+				/* The profiles of (up to MSE_LOCK_PROFILING_MAX_RETIRED) destroyed mutexes that experienced contention. */
+				std::vector<lock_profile_t> m_retired_profiles;
+			};
+
+			/* Like the mse::stats registry, this registry is intentionally never destroyed. */
+			inline CLockProfileRegistry& lock_profile_registry() {
+				static CLockProfileRegistry* s_registry_ptr = new CLockProfileRegistry();
+				return *s_registry_ptr;
+			}
+
+			class CLockProfile {
+			public:
+				typedef std::chrono::steady_clock clock_t;
+
+				CLockProfile(const void* mutex_address) {
+					m_profile.mutex_address = mutex_address;
+					lock_profile_registry().add(this);
+				}
+				~CLockProfile() {
+					lock_profile_registry().retire(this);
+				}
+				CLockProfile(const CLockProfile&) = delete;
+				CLockProfile& operator=(const CLockProfile&) = delete;
+
+				void set_name(const std::string& name) {
+					std::lock_guard<std::mutex> lock1(m_mutex);
+					m_profile.name = name;
+				}
+				lock_profile_t profile() const {
+					std::lock_guard<std::mutex> lock1(m_mutex);
+					return m_profile;
+				}
+
+				/* The wait time of (contended) acquisitions (by coroutines) for which it isn't known is not reflected in the
+				wait time histogram. */
+				void note_acquisition(bool exclusive, bool contended, std::chrono::nanoseconds wait_time, bool wait_time_is_known = true) {
+					const auto now = clock_t::now();
+					std::lock_guard<std::mutex> lock1(m_mutex);
+					if (exclusive) {
+						m_profile.exclusive_acquisitions += 1;
+						if (0 == m_exclusive_depth) {
+							m_exclusive_hold_start = now;
+							m_exclusive_holder_id = std::this_thread::get_id();
+						}
+						m_exclusive_depth += 1;
+					}
+					else {
+						m_profile.shared_acquisitions += 1;
+						auto& hold = m_shared_holds[std::this_thread::get_id()];
+						if (0 == hold.first) {
+							hold.second = now;
+						}
+						hold.first += 1;
+					}
+					if (!contended) {
+						m_profile.wait_time_histogram[0] += 1;
+						return;
+					}
+					m_profile.contended_acquisitions += 1;
+					if (wait_time_is_known) {
+						m_profile.wait_time_histogram[lock_profile_t::wait_time_bucket_index(wait_time)] += 1;
+						m_profile.total_wait_time += wait_time;
+						m_profile.max_wait_time = (std::max)(m_profile.max_wait_time, wait_time);
+					}
+				}
+				void note_release(bool exclusive) {
+					const auto now = clock_t::now();
+					std::lock_guard<std::mutex> lock1(m_mutex);
+					if (exclusive) {
+						if (0 == m_exclusive_depth) { return; }
+						m_exclusive_depth -= 1;
+						if (0 == m_exclusive_depth) {
+							const auto hold_time = std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_exclusive_hold_start);
+							m_profile.max_exclusive_hold_time = (std::max)(m_profile.max_exclusive_hold_time, hold_time);
+							note_hold_while_locked(lock_holder_t{ m_exclusive_holder_id, hold_time, true });
+						}
+					}
+					else {
+						/* Shared locks are always released by the thread that acquired them. (Coroutines that acquire
+						the lock are pinned to their scheduler thread, on which both the acquisition and the release occur.) */
+						auto found_it = m_shared_holds.find(std::this_thread::get_id());
+						assert(m_shared_holds.end() != found_it);
+						if (m_shared_holds.end() == found_it) { return; }
+						(*found_it).second.first -= 1;
+						if (0 == (*found_it).second.first) {
+							const auto hold_time = std::chrono::duration_cast<std::chrono::nanoseconds>(now - (*found_it).second.second);
+							m_shared_holds.erase(found_it);
+							m_profile.max_shared_hold_time = (std::max)(m_profile.max_shared_hold_time, hold_time);
+							note_hold_while_locked(lock_holder_t{ std::this_thread::get_id(), hold_time, false });
+						}
+					}
+				}
+
+			private:
+				void note_hold_while_locked(const lock_holder_t& holder) {
+					auto& holders = m_profile.longest_holders;
+					if ((lock_profile_t::max_number_of_longest_holders <= holders.size()) && (holders.back().hold_time >= holder.hold_time)) {
+						return;
+					}
+					auto insert_it = std::find_if(holders.begin(), holders.end()
+						, [&holder](const lock_holder_t& item) { return item.hold_time < holder.hold_time; });
+					holders.insert(insert_it, holder);
+					if (lock_profile_t::max_number_of_longest_holders < holders.size()) {
+						holders.pop_back();
+					}
+				}
+
+				mutable std::mutex m_mutex;
+				lock_profile_t m_profile;
+				size_t m_exclusive_depth = 0;
+				clock_t::time_point m_exclusive_hold_start;
+				std::thread::id m_exclusive_holder_id;
+				std::unordered_map<std::thread::id, std::pair<size_t, clock_t::time_point> > m_shared_holds;
+			};
+
+			inline void CLockProfileRegistry::retire(CLockProfile* profile_ptr) {
+				auto profile = profile_ptr->profile();
+				std::lock_guard<std::mutex> lock1(m_mutex);
+				auto found_it = std::find(m_live_profiles.begin(), m_live_profiles.end(), profile_ptr);
+				if (m_live_profiles.end() != found_it) {
+					m_live_profiles.erase(found_it);
+				}
+				if (0 == profile.contended_acquisitions) {
+					return;
+				}
+				profile.mutex_destroyed = true;
+				if (MSE_LOCK_PROFILING_MAX_RETIRED > m_retired_profiles.size()) {
+					m_retired_profiles.push_back(std::move(profile));
+				}
+				else {
+					/* replace the retained profile with the least total wait time (if it's less than that of this one) */
+					auto min_it = std::min_element(m_retired_profiles.begin(), m_retired_profiles.end()
+						, [](const lock_profile_t& a, const lock_profile_t& b) { return a.total_wait_time < b.total_wait_time; });
+					if ((m_retired_profiles.end() != min_it) && ((*min_it).total_wait_time < profile.total_wait_time)) {
+						(*min_it) = std::move(profile);
+					}
+				}
+			}
+			inline std::vector<lock_profile_t> CLockProfileRegistry::profiles() {
+				std::vector<lock_profile_t> retval;
+				{
+					std::lock_guard<std::mutex> lock1(m_mutex);
+					retval = m_retired_profiles;
+					for (auto profile_ptr : m_live_profiles) {
+						retval.push_back(profile_ptr->profile());
+					}
+				}
+				std::stable_sort(retval.begin(), retval.end()
+					, [](const lock_profile_t& a, const lock_profile_t& b) { return a.total_wait_time > b.total_wait_time; });
+				return retval;
+			}
+
+			/* TLockProfilingMutex<> wraps a (recursive_shared_timed_mutex compatible) mutex and records the contention it
+			experiences. A lock attempt that doesn't immediately succeed is considered contended, and the time taken to
+			eventually acquire the lock is recorded as its wait time. */
+			template<class _TMutex>
+			class TLockProfilingMutex : public _TMutex {
+			public:
+				typedef _TMutex base_class;
+				typedef CLockProfile::clock_t clock_t;
+
+				TLockProfilingMutex() : m_lock_profile(this) {}
+
+				void set_profile_name(const std::string& name) { m_lock_profile.set_name(name); }
+				lock_profile_t profile() const { return m_lock_profile.profile(); }
+
+				void lock() {
+					if (base_class::try_lock()) {
+						m_lock_profile.note_acquisition(true, false, std::chrono::nanoseconds(0));
+						return;
+					}
+					const auto start_time = clock_t::now();
+					base_class::lock();
+					note_contended_acquisition(true, start_time);
+				}
+				bool try_lock() {
+					auto retval = base_class::try_lock();
+					if (retval) { m_lock_profile.note_acquisition(true, false, std::chrono::nanoseconds(0)); }
+					return retval;
+				}
+				template<class _Rep, class _Period>
+				bool try_lock_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {
+					return try_lock_until(std::chrono::steady_clock::now() + _Rel_time);
+				}
+				template<class _Clock, class _Duration>
+				bool try_lock_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
+					if (base_class::try_lock()) {
+						m_lock_profile.note_acquisition(true, false, std::chrono::nanoseconds(0));
+						return true;
+					}
+					const auto start_time = clock_t::now();
+					auto retval = base_class::try_lock_until(_Abs_time);
+					if (retval) { note_contended_acquisition(true, start_time); }
+					return retval;
+				}
+				void unlock() {
+					/* The release is noted while the lock is still held, so that it can't be (mis)attributed to, or
+					interleaved with, a subsequent acquisition by another thread. */
+					m_lock_profile.note_release(true);
+					base_class::unlock();
+				}
+
+				void nonrecursive_lock() {
+					if (base_class::try_nonrecursive_lock()) {
+						m_lock_profile.note_acquisition(true, false, std::chrono::nanoseconds(0));
+						return;
+					}
+					const auto start_time = clock_t::now();
+					base_class::nonrecursive_lock();
+					note_contended_acquisition(true, start_time);
+				}
+				bool try_nonrecursive_lock() {
+					auto retval = base_class::try_nonrecursive_lock();
+					if (retval) { m_lock_profile.note_acquisition(true, false, std::chrono::nanoseconds(0)); }
+					return retval;
+				}
+				template<class _Rep, class _Period>
+				bool try_nonrecursive_lock_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {
+					return try_nonrecursive_lock_until(std::chrono::steady_clock::now() + _Rel_time);
+				}
+				template<class _Clock, class _Duration>
+				bool try_nonrecursive_lock_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
+					if (base_class::try_nonrecursive_lock()) {
+						m_lock_profile.note_acquisition(true, false, std::chrono::nanoseconds(0));
+						return true;
+					}
+					const auto start_time = clock_t::now();
+					auto retval = base_class::try_nonrecursive_lock_until(_Abs_time);
+					if (retval) { note_contended_acquisition(true, start_time); }
+					return retval;
+				}
+				void nonrecursive_unlock() {
+					m_lock_profile.note_release(true);
+					base_class::nonrecursive_unlock();
+				}
+
+				void lock_shared() {
+					if (base_class::try_lock_shared()) {
+						m_lock_profile.note_acquisition(false, false, std::chrono::nanoseconds(0));
+						return;
+					}
+					const auto start_time = clock_t::now();
+					base_class::lock_shared();
+					note_contended_acquisition(false, start_time);
+				}
+				bool try_lock_shared() {
+					auto retval = base_class::try_lock_shared();
+					if (retval) { m_lock_profile.note_acquisition(false, false, std::chrono::nanoseconds(0)); }
+					return retval;
+				}
+				template<class _Rep, class _Period>
+				bool try_lock_shared_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {
+					return try_lock_shared_until(std::chrono::steady_clock::now() + _Rel_time);
+				}
+				template<class _Clock, class _Duration>
+				bool try_lock_shared_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
+					if (base_class::try_lock_shared()) {
+						m_lock_profile.note_acquisition(false, false, std::chrono::nanoseconds(0));
+						return true;
+					}
+					const auto start_time = clock_t::now();
+					auto retval = base_class::try_lock_shared_until(_Abs_time);
+					if (retval) { note_contended_acquisition(false, start_time); }
+					return retval;
+				}
+				void unlock_shared() {
+					m_lock_profile.note_release(false);
+					base_class::unlock_shared();
+				}
+
+#ifdef MSE_HAS_CXX20_COROUTINES
+				bool try_nonrecursive_lock_or_add_waiter(const mse::impl::ns_co::CLockWaiter& waiter, bool is_retry = false) {
+					auto retval = base_class::try_nonrecursive_lock_or_add_waiter(waiter, is_retry);
+					if (retval) { note_co_acquisition(true, is_retry); }
+					return retval;
+				}
+				bool try_lock_shared_or_add_waiter(const mse::impl::ns_co::CLockWaiter& waiter, bool is_retry = false) {
+					auto retval = base_class::try_lock_shared_or_add_waiter(waiter, is_retry);
+					if (retval) { note_co_acquisition(false, is_retry); }
+					return retval;
+				}
+#endif // MSE_HAS_CXX20_COROUTINES
+
+			private:
+				void note_contended_acquisition(bool exclusive, clock_t::time_point start_time) {
+					const auto wait_time = std::chrono::duration_cast<std::chrono::nanoseconds>(clock_t::now() - start_time);
+					m_lock_profile.note_acquisition(exclusive, true, wait_time);
+				}
+				void note_co_acquisition(bool exclusive, bool is_retry) {
+					if (is_retry) {
+						/* The (suspended) coroutine had to wait, but for how long isn't known here. */
+						m_lock_profile.note_acquisition(exclusive, true, std::chrono::nanoseconds(0), false);
+					}
+					else {
+						m_lock_profile.note_acquisition(exclusive, false, std::chrono::nanoseconds(0));
+					}
+				}
+
+				CLockProfile m_lock_profile;
+			};
+		}
+
+		/* Returns the contention profiles of the currently existing (profiled) mutexes, and of (a limited number of)
+		destroyed ones that experienced contention, in order of decreasing total wait time. */
+		inline std::vector<lock_profile_t> lock_profiles() { return impl::lock_profile_registry().profiles(); }
+		inline void dump_lock_profiles(std::ostream& os) {
+			for (const auto& profile : lock_profiles()) {
+				profile.dump(os);
+			}
+		}
+	}
+
+#endif // MSE_ENABLE_LOCK_PROFILING
+
+	namespace impl {
+		/* The (recursive) access mutex built on the given (non-recursive) shared mutex. */
+		template<class _TSharedMutex> struct async_access_mutex { typedef TRecursiveSharedTimedMutex<_TSharedMutex> type; };
+		template<> struct async_access_mutex<std::shared_timed_mutex> { typedef recursive_shared_timed_mutex type; };
+
+#ifdef MSE_ENABLE_LOCK_PROFILING
+		template<class _TSharedMutex>
+		using TAsyncAccessMutex = mse::stats::impl::TLockProfilingMutex<typename async_access_mutex<_TSharedMutex>::type>;
+#else // MSE_ENABLE_LOCK_PROFILING
+		template<class _TSharedMutex>
+		using TAsyncAccessMutex = typename async_access_mutex<_TSharedMutex>::type;
+#endif // MSE_ENABLE_LOCK_PROFILING
+
+		/* An access lease type can specify the shared mutex its access mutex is to be built on via a member type named
+		"async_shared_mutex_type". Otherwise std::shared_timed_mutex is used. */
+		template<class _TAccessLease, class = void>
+		struct access_lease_shared_mutex { typedef std::shared_timed_mutex type; };
+		template<class _TAccessLease>
+		struct access_lease_shared_mutex<_TAccessLease, typename std::conditional<true, void, typename _TAccessLease::async_shared_mutex_type>::type> {
+			typedef typename _TAccessLease::async_shared_mutex_type type;
+		};
+	}
+
+	//typedef std::shared_timed_mutex async_shared_timed_mutex_type;
+	typedef impl::TAsyncAccessMutex<std::shared_timed_mutex> async_shared_timed_mutex_type;
+
+
+	/* nii_vector<> qualifies as safely shareable, but its corresponding make_xscope_vector_size_change_lock_guard() function
+	only supports non-const reference arguments. So we provide mtnii_vector<> whose corresponding
+	make_xscope_vector_size_change_lock_guard() function does support const reference arguments. But in order to achieve this
+	while maintaining thread safety (and maximal performance), it needs a partially thread safe shared mutex. */
+	typedef T_shared_mutex<bool, std::atomic<size_t> > mtnii_vector_shared_mutex;
+
+	template<class _Ty, class _A = std::allocator<_Ty>, class _TStateMutex = mse::mtnii_vector_shared_mutex>
+	class mtnii_vector : public mse::us::impl::gnii_vector<_Ty, _A, mse::mtnii_vector_shared_mutex> {
+	public:
+		typedef mse::us::impl::gnii_vector<_Ty, _A, mse::mtnii_vector_shared_mutex> base_class;
+
 		typedef typename base_class::allocator_type allocator_type;
 		typedef typename base_class::value_type value_type;
 		typedef typename base_class::size_type size_type;
@@ -787,17 +2074,23 @@ namespace mse {
 	class TAsyncSharedXWPAccessLeaseObj {
 	public:
 		TAsyncSharedXWPAccessLeaseObj(_TAccessLease&& access_lease)
-			: m_access_lease(std::forward<_TAccessLease>(access_lease)) {}
+			: m_access_lease(std::forward<_TAccessLease>(access_lease)) {
+#ifdef MSE_ENABLE_LOCK_PROFILING
+			m_mutex1.set_profile_name(typeid(_TAccessLease).name());
+#endif // MSE_ENABLE_LOCK_PROFILING
+		}
 		const _TAccessLease& cref() const {
 			return m_access_lease;
 		}
-		async_shared_timed_mutex_type& mutex_ref() const {
+		typedef mse::impl::TAsyncAccessMutex<typename mse::impl::access_lease_shared_mutex<_TAccessLease>::type> mutex_t;
+
+		mutex_t& mutex_ref() const {
 			return m_mutex1;
 		}
 	private:
 		_TAccessLease m_access_lease;
 
-		mutable async_shared_timed_mutex_type m_mutex1;
+		mutable mutex_t m_mutex1;
 
 		friend class mse::us::impl::TAsyncSharedV2ReadWritePointerBase<_TAccessLease>;
 		friend class mse::us::impl::TAsyncSharedV2ReadWriteConstPointerBase<_TAccessLease>;
@@ -860,7 +2153,7 @@ namespace mse {
 				}
 
 				std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> m_shptr;
-				std::unique_lock<async_shared_timed_mutex_type> m_unique_lock;
+				std::unique_lock<typename TAsyncSharedXWPAccessLeaseObj<_TAccessLease>::mutex_t> m_unique_lock;
 
 				friend class mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease>;
 				friend class TXScopeAsyncSharedV2ReadWritePointer<_TAccessLease>;
@@ -942,6 +2235,9 @@ namespace mse {
 				void async_not_passable_tag() const {}
 			private:
 				TAsyncSharedV2ReadWriteConstPointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr) : m_shptr(shptr), m_shared_lock(shptr->m_mutex1) {}
+#ifdef MSE_HAS_CXX20_COROUTINES
+				TAsyncSharedV2ReadWriteConstPointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr, std::adopt_lock_t) : m_shptr(shptr), m_shared_lock(shptr->m_mutex1, std::adopt_lock) {}
+#endif // MSE_HAS_CXX20_COROUTINES
 				TAsyncSharedV2ReadWriteConstPointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr, std::try_to_lock_t) : m_shptr(shptr), m_shared_lock(shptr->m_mutex1, std::defer_lock) {
 					if (!m_shared_lock.try_lock()) {
 						m_shptr = nullptr;
@@ -970,7 +2266,7 @@ namespace mse {
 				}
 
 				std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> m_shptr;
-				std::shared_lock<async_shared_timed_mutex_type> m_shared_lock;
+				std::shared_lock<typename TAsyncSharedXWPAccessLeaseObj<_TAccessLease>::mutex_t> m_shared_lock;
 
 				friend class TXScopeAsyncSharedV2ReadWriteConstPointer<_TAccessLease>;
 				friend class TAsyncSharedV2ReadWriteConstPointer<_TAccessLease>;
@@ -1019,10 +2315,16 @@ namespace mse {
 		TAsyncSharedV2ReadWriteConstPointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::duration<_Rep, _Period>& _Rel_time) : base_class(shptr, ttl, _Rel_time) {}
 		template<class _Clock, class _Duration>
 		TAsyncSharedV2ReadWriteConstPointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::time_point<_Clock, _Duration>& _Abs_time) : base_class(shptr, ttl, _Abs_time) {}
+#ifdef MSE_HAS_CXX20_COROUTINES
+		TAsyncSharedV2ReadWriteConstPointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::adopt_lock_t& al) : base_class(shptr, al) {}
+#endif // MSE_HAS_CXX20_COROUTINES
 
 		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
 
 		friend class mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease>;
+#ifdef MSE_HAS_CXX20_COROUTINES
+		template<typename _TAccessLease2, bool _Exclusive2> friend class mse::impl::ns_co::TAsyncSharedV2LockAwaiter;
+#endif // MSE_HAS_CXX20_COROUTINES
 	};
 
 	namespace us {
@@ -1050,6 +2352,9 @@ namespace mse {
 				void async_shareable_and_passable_tag() const {}
 			private:
 				TAsyncSharedV2ExclusiveReadWritePointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr) : m_shptr(shptr), m_unique_lock(shptr->m_mutex1) {}
+#ifdef MSE_HAS_CXX20_COROUTINES
+				TAsyncSharedV2ExclusiveReadWritePointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr, std::adopt_lock_t) : m_shptr(shptr), m_unique_lock(shptr->m_mutex1, std::adopt_lock) {}
+#endif // MSE_HAS_CXX20_COROUTINES
 				TAsyncSharedV2ExclusiveReadWritePointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr, std::try_to_lock_t) : m_shptr(shptr), m_unique_lock(shptr->m_mutex1, std::defer_lock) {
 					if (!m_unique_lock.try_lock()) {
 						m_shptr = nullptr;
@@ -1078,7 +2383,7 @@ namespace mse {
 				}
 
 				std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> m_shptr;
-				unique_nonrecursive_lock<async_shared_timed_mutex_type> m_unique_lock;
+				unique_nonrecursive_lock<typename TAsyncSharedXWPAccessLeaseObj<_TAccessLease>::mutex_t> m_unique_lock;
 
 				friend class TXScopeAsyncSharedV2ExclusiveReadWritePointer<_TAccessLease>;
 				friend class TAsyncSharedV2ExclusiveReadWritePointer<_TAccessLease>;
@@ -1127,12 +2432,129 @@ namespace mse {
 		TAsyncSharedV2ExclusiveReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::duration<_Rep, _Period>& _Rel_time) : base_class(shptr, ttl, _Rel_time) {}
 		template<class _Clock, class _Duration>
 		TAsyncSharedV2ExclusiveReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::time_point<_Clock, _Duration>& _Abs_time) : base_class(shptr, ttl, _Abs_time) {}
+#ifdef MSE_HAS_CXX20_COROUTINES
+		TAsyncSharedV2ExclusiveReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::adopt_lock_t& al) : base_class(shptr, al) {}
+#endif // MSE_HAS_CXX20_COROUTINES
 
 		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
 
 		friend class mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease>;
+#ifdef MSE_HAS_CXX20_COROUTINES
+		template<typename _TAccessLease2, bool _Exclusive2> friend class mse::impl::ns_co::TAsyncSharedV2LockAwaiter;
+#endif // MSE_HAS_CXX20_COROUTINES
 	};
 
+#ifdef MSE_HAS_CXX20_COROUTINES
+	namespace impl {
+		namespace ns_co {
+			/* A record (in the task's CCoTaskHeldLocks) that the task holds the given lock. Copies (which accompany copies of
+			the lock pointer) are also recorded. */
+			class CCoTaskHeldLockRecord {
+			public:
+				CCoTaskHeldLockRecord(const std::shared_ptr<CCoTaskHeldLocks>& held_locks_shptr, const void* mutex_id, bool exclusive)
+					: m_held_locks_shptr(held_locks_shptr), m_mutex_id(mutex_id), m_exclusive(exclusive) {
+					m_held_locks_shptr->add(m_mutex_id, m_exclusive);
+				}
+				CCoTaskHeldLockRecord(const CCoTaskHeldLockRecord& src)
+					: m_held_locks_shptr(src.m_held_locks_shptr), m_mutex_id(src.m_mutex_id), m_exclusive(src.m_exclusive) {
+					if (m_held_locks_shptr) {
+						m_held_locks_shptr->add(m_mutex_id, m_exclusive);
+					}
+				}
+				CCoTaskHeldLockRecord(CCoTaskHeldLockRecord&& src) = default;
+				~CCoTaskHeldLockRecord() {
+					if (m_held_locks_shptr) {
+						m_held_locks_shptr->remove(m_mutex_id, m_exclusive);
+					}
+				}
+
+			private:
+				CCoTaskHeldLockRecord& operator=(const CCoTaskHeldLockRecord&) = delete;
+
+				std::shared_ptr<CCoTaskHeldLocks> m_held_locks_shptr;
+				const void* m_mutex_id = nullptr;
+				bool m_exclusive = false;
+			};
+
+			/* A lock pointer obtained by a task via an awaitable, accompanied by its held lock record. */
+			template<typename _TLockPtr>
+			class TCoTaskLockPointer : public _TLockPtr {
+			public:
+				typedef _TLockPtr base_class;
+
+				TCoTaskLockPointer(const TCoTaskLockPointer& src) = default;
+				TCoTaskLockPointer(TCoTaskLockPointer&& src) = default;
+				TCoTaskLockPointer(_TLockPtr&& src, CCoTaskHeldLockRecord&& held_lock_record)
+					: base_class(std::forward<_TLockPtr>(src)), m_held_lock_record(std::forward<CCoTaskHeldLockRecord>(held_lock_record)) {}
+
+			private:
+				CCoTaskHeldLockRecord m_held_lock_record;
+			};
+
+			/* The awaitable returned by the access requesters' async_writelock_ptr() and async_readlock_ptr() member functions.
+			If the lock isn't immediately available, the awaiting task is suspended (freeing its scheduler thread to run other
+			tasks) and registered as a waiter with the mutex. When woken, it retries on its own scheduler thread. A request for
+			a lock that the task would have to wait for itself to release (an exclusive lock on an object it already holds any
+			lock on, or any lock on an object it holds an exclusive lock on) results in a
+			std::system_error(resource_deadlock_would_occur) exception, as with exclusive_writelock_ptr(). */
+			template<typename _TAccessLease, bool _Exclusive>
+			class TAsyncSharedV2LockAwaiter {
+			public:
+				typedef typename std::conditional<_Exclusive, TAsyncSharedV2ExclusiveReadWritePointer<_TAccessLease>
+					, TAsyncSharedV2ReadWriteConstPointer<_TAccessLease> >::type base_pointer_t;
+				typedef TCoTaskLockPointer<base_pointer_t> pointer_t;
+
+				TAsyncSharedV2LockAwaiter(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : m_shptr(shptr) {}
+
+				/* (The task's held locks need to be checked before any attempt to obtain the lock, and the task is only
+				available to await_suspend().) */
+				bool await_ready() const noexcept { return false; }
+				bool await_suspend(std::coroutine_handle<mse::co_task::promise_type> handle) {
+					m_handle = handle;
+					m_queue_ptr = handle.promise().queue_ptr();
+					if (!m_queue_ptr) { MSE_THROW(asyncshared_runtime_error("task not associated with a scheduler - TAsyncSharedV2LockAwaiter")); }
+					m_held_locks_shptr = handle.promise().held_locks_shptr();
+					if (m_held_locks_shptr->would_wait_for_self(mutex_id(), _Exclusive)) {
+						MSE_THROW(std::system_error(std::make_error_code(std::errc::resource_deadlock_would_occur)));
+					}
+					/* If the lock is obtained, the task is not suspended after all. */
+					return !try_lock_or_add_waiter(false);
+				}
+				pointer_t await_resume() {
+					/* (If recording the lock fails, the lock is released along with the (adopting) lock pointer.) */
+					base_pointer_t base_pointer(m_shptr, std::adopt_lock);
+					return pointer_t(std::move(base_pointer), CCoTaskHeldLockRecord(m_held_locks_shptr, mutex_id(), _Exclusive));
+				}
+
+			private:
+				const void* mutex_id() const {
+					return std::addressof(m_shptr->mutex_ref());
+				}
+				bool try_lock_or_add_waiter(bool is_retry) {
+					const CLockWaiter waiter{ &s_wake, this, _Exclusive };
+					auto& mutex_ref = m_shptr->mutex_ref();
+					return _Exclusive ? mutex_ref.try_nonrecursive_lock_or_add_waiter(waiter, is_retry)
+						: mutex_ref.try_lock_shared_or_add_waiter(waiter, is_retry);
+				}
+				/* Called (from whichever thread released the lock) when the lock may have become available. */
+				static void s_wake(void* context) {
+					auto& awaiter_ref = *static_cast<TAsyncSharedV2LockAwaiter*>(context);
+					awaiter_ref.m_queue_ptr->post(CCoTaskQueue::CRunnable{ awaiter_ref.m_handle, &s_retry, context });
+				}
+				/* Called on the task's own scheduler thread. Returns true if the lock has been obtained. */
+				static bool s_retry(void* context) {
+					return static_cast<TAsyncSharedV2LockAwaiter*>(context)->try_lock_or_add_waiter(true);
+				}
+
+				std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> m_shptr;
+				std::coroutine_handle<> m_handle;
+				CCoTaskQueue* m_queue_ptr = nullptr;
+				std::shared_ptr<CCoTaskHeldLocks> m_held_locks_shptr;
+			};
+		}
+	}
+#endif // MSE_HAS_CXX20_COROUTINES
+
 	namespace us {
 		namespace impl {
 			template<typename _TAccessLease>
@@ -1277,6 +2699,14 @@ namespace mse {
 				auto exclusive_pointer() const {
 					return exclusive_writelock_ptr();
 				}
+#ifdef MSE_HAS_CXX20_COROUTINES
+				mse::impl::ns_co::TAsyncSharedV2LockAwaiter<_TAccessLease, true> async_writelock_ptr() const {
+					return mse::impl::ns_co::TAsyncSharedV2LockAwaiter<_TAccessLease, true>(m_shptr);
+				}
+				mse::impl::ns_co::TAsyncSharedV2LockAwaiter<_TAccessLease, false> async_readlock_ptr() const {
+					return mse::impl::ns_co::TAsyncSharedV2LockAwaiter<_TAccessLease, false>(m_shptr);
+				}
+#endif // MSE_HAS_CXX20_COROUTINES
 
 			private:
 				TAsyncSharedV2XWPReadWriteAccessRequesterBase(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : m_shptr(shptr) {}
@@ -1425,6 +2855,19 @@ namespace mse {
 		auto exclusive_pointer() const {
 			return exclusive_writelock_ptr();
 		}
+#ifdef MSE_HAS_CXX20_COROUTINES
+		/* These are the awaitable (in a co_task) counterparts of exclusive_writelock_ptr() and readlock_ptr(). For example,
+		"auto ptr = co_await ar.async_writelock_ptr();". Rather than blocking the thread while the lock is unavailable, the
+		awaiting task is suspended so that other tasks can run. Because the lock pointers must be released by the thread that
+		obtained them, a task holding one should only suspend on these awaitables (or another co_task), which always resume
+		the task on its own scheduler thread. */
+		auto async_writelock_ptr() const {
+			return base_class::async_writelock_ptr();
+		}
+		auto async_readlock_ptr() const {
+			return base_class::async_readlock_ptr();
+		}
+#endif // MSE_HAS_CXX20_COROUTINES
 
 		static TAsyncSharedV2XWPReadWriteAccessRequester make(_TAccessLease&& exclusive_write_pointer) {
 			return TAsyncSharedV2XWPReadWriteAccessRequester(std::make_shared<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>(std::forward<decltype(exclusive_write_pointer)>(exclusive_write_pointer)));
@@ -1557,7 +3000,7 @@ namespace mse {
 				}
 
 				std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> m_shptr;
-				std::shared_lock<async_shared_timed_mutex_type> m_shared_lock;
+				std::shared_lock<typename TAsyncSharedXWPAccessLeaseObj<_TAccessLease>::mutex_t> m_shared_lock;
 
 				friend class TXScopeAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>;
 				friend class TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>;
@@ -1829,30 +3272,34 @@ namespace mse {
 	}
 #endif // MSESCOPE_H_
 
-	template <typename _Ty> class TAsyncSharedV2ReadWriteAccessRequester;
-	template <typename _Ty> class TAsyncSharedV2ReadOnlyAccessRequester;
+	/* The _TSharedMutex template parameter of the following access requesters specifies the (non-recursive) shared mutex
+	that their access mutex is built on. It determines the order in which contending lock requests are granted. (See
+	reader_preferring_shared_timed_mutex, writer_preferring_shared_timed_mutex and fifo_shared_timed_mutex.) */
+	template <typename _Ty, class _TSharedMutex = std::shared_timed_mutex> class TAsyncSharedV2ReadWriteAccessRequester;
+	template <typename _Ty, class _TSharedMutex = std::shared_timed_mutex> class TAsyncSharedV2ReadOnlyAccessRequester;
 
 	namespace us {
 		namespace impl {
-			template <typename _Ty>
+			template <typename _Ty, class _TSharedMutex = std::shared_timed_mutex>
 			class TTaggedUniquePtr : public std::unique_ptr<_Ty>, public mse::us::impl::StrongExclusivePointerTagBase {
 			public:
+				typedef _TSharedMutex async_shared_mutex_type;
 			private:
 				typedef std::unique_ptr<_Ty> base_class;
 				TTaggedUniquePtr(std::unique_ptr<_Ty>&& uqptr) : base_class(std::forward<decltype(uqptr)>(uqptr)) {}
 
-				template <typename _Ty2> friend class mse::TAsyncSharedV2ReadWriteAccessRequester;
-				template <typename _Ty2> friend class mse::TAsyncSharedV2ReadOnlyAccessRequester;
+				template <typename _Ty2, class _TSharedMutex2> friend class mse::TAsyncSharedV2ReadWriteAccessRequester;
+				template <typename _Ty2, class _TSharedMutex2> friend class mse::TAsyncSharedV2ReadOnlyAccessRequester;
 			};
 		}
 	}
 
-	template<typename _Ty> class TAsyncSharedV2WeakReadWriteAccessRequester;
+	template<typename _Ty, class _TSharedMutex = std::shared_timed_mutex> class TAsyncSharedV2WeakReadWriteAccessRequester;
 
-	template <typename _Ty>
-	class TAsyncSharedV2ReadWriteAccessRequester : public TAsyncSharedV2XWPReadWriteAccessRequester<mse::us::impl::TTaggedUniquePtr<_Ty> > {
+	template <typename _Ty, class _TSharedMutex/* = std::shared_timed_mutex*/>
+	class TAsyncSharedV2ReadWriteAccessRequester : public TAsyncSharedV2XWPReadWriteAccessRequester<mse::us::impl::TTaggedUniquePtr<_Ty, _TSharedMutex> > {
 	public:
-		typedef TAsyncSharedV2XWPReadWriteAccessRequester<mse::us::impl::TTaggedUniquePtr<_Ty> > base_class;
+		typedef TAsyncSharedV2XWPReadWriteAccessRequester<mse::us::impl::TTaggedUniquePtr<_Ty, _TSharedMutex> > base_class;
 		typedef decltype(std::declval<base_class>().writelock_ptr()) writelock_ptr_t;
 		typedef decltype(std::declval<base_class>().readlock_ptr()) readlock_ptr_t;
 
@@ -1866,7 +3313,7 @@ namespace mse {
 
 		template <class... Args>
 		static TAsyncSharedV2ReadWriteAccessRequester make(Args&&... args) {
-			return TAsyncSharedV2ReadWriteAccessRequester(mse::us::impl::TTaggedUniquePtr<_Ty>(std::make_unique<_Ty>(std::forward<Args>(args)...)));
+			return TAsyncSharedV2ReadWriteAccessRequester(mse::us::impl::TTaggedUniquePtr<_Ty, _TSharedMutex>(std::make_unique<_Ty>(std::forward<Args>(args)...)));
 		}
 
 		void async_shareable_and_passable_tag() const {}
@@ -1883,12 +3330,12 @@ namespace mse {
 		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && (!std::is_base_of<mse::us::impl::XScopeTagBase, _Ty2>::value), void>::type>
 		void valid_if_Ty_is_not_an_xscope_type() const {}
 
-		TAsyncSharedV2ReadWriteAccessRequester(mse::us::impl::TTaggedUniquePtr<_Ty>&& uqptr) : base_class(make_asyncsharedv2xwpreadwrite(std::forward<decltype(uqptr)>(uqptr))) {}
+		TAsyncSharedV2ReadWriteAccessRequester(mse::us::impl::TTaggedUniquePtr<_Ty, _TSharedMutex>&& uqptr) : base_class(make_asyncsharedv2xwpreadwrite(std::forward<decltype(uqptr)>(uqptr))) {}
 		TAsyncSharedV2ReadWriteAccessRequester(const base_class& src) : base_class(src) {}
 
 		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
 
-		friend class TAsyncSharedV2WeakReadWriteAccessRequester<_Ty>;
+		friend class TAsyncSharedV2WeakReadWriteAccessRequester<_Ty, _TSharedMutex>;
 	};
 
 	template <class X, class... Args>
@@ -1896,23 +3343,23 @@ namespace mse {
 		return TAsyncSharedV2ReadWriteAccessRequester<X>::make(std::forward<Args>(args)...);
 	}
 
-	template<typename _Ty>
-	class TAsyncSharedV2WeakReadWriteAccessRequester : public TAsyncSharedV2XWPWeakReadWriteAccessRequester<mse::us::impl::TTaggedUniquePtr<_Ty> > {
+	template<typename _Ty, class _TSharedMutex/* = std::shared_timed_mutex*/>
+	class TAsyncSharedV2WeakReadWriteAccessRequester : public TAsyncSharedV2XWPWeakReadWriteAccessRequester<mse::us::impl::TTaggedUniquePtr<_Ty, _TSharedMutex> > {
 	public:
-		typedef TAsyncSharedV2XWPWeakReadWriteAccessRequester<mse::us::impl::TTaggedUniquePtr<_Ty> > base_class;
+		typedef TAsyncSharedV2XWPWeakReadWriteAccessRequester<mse::us::impl::TTaggedUniquePtr<_Ty, _TSharedMutex> > base_class;
 		TAsyncSharedV2WeakReadWriteAccessRequester(const TAsyncSharedV2WeakReadWriteAccessRequester&) = default;
-		TAsyncSharedV2WeakReadWriteAccessRequester(const TAsyncSharedV2ReadWriteAccessRequester<_Ty>& src) : base_class(src) {}
+		TAsyncSharedV2WeakReadWriteAccessRequester(const TAsyncSharedV2ReadWriteAccessRequester<_Ty, _TSharedMutex>& src) : base_class(src) {}
 
-		mse::mstd::optional<TAsyncSharedV2ReadWriteAccessRequester<_Ty>> try_strong_access_requester() const {
+		mse::mstd::optional<TAsyncSharedV2ReadWriteAccessRequester<_Ty, _TSharedMutex>> try_strong_access_requester() const {
 			return try_strong_access_requester_helper1(base_class::try_strong_access_requester());
 		}
 
 		void async_shareable_and_passable_tag() const {}
 
 	private:
-		mse::mstd::optional<TAsyncSharedV2ReadWriteAccessRequester<_Ty>> try_strong_access_requester_helper1(decltype(std::declval<base_class>().try_strong_access_requester())&& base_maybe_ar) const {
+		mse::mstd::optional<TAsyncSharedV2ReadWriteAccessRequester<_Ty, _TSharedMutex>> try_strong_access_requester_helper1(decltype(std::declval<base_class>().try_strong_access_requester())&& base_maybe_ar) const {
 			if (base_maybe_ar) {
-				return TAsyncSharedV2ReadWriteAccessRequester<_Ty>(std::forward<decltype(base_maybe_ar.value())>(base_maybe_ar.value()));
+				return TAsyncSharedV2ReadWriteAccessRequester<_Ty, _TSharedMutex>(std::forward<decltype(base_maybe_ar.value())>(base_maybe_ar.value()));
 			}
 			else {
 				return {};
@@ -1922,18 +3369,18 @@ namespace mse {
 
 #ifdef MSE_HAS_CXX17
 	/* deduction guide */
-	template<typename _TAccessLease>
-	TAsyncSharedV2WeakReadWriteAccessRequester(TAsyncSharedV2ReadWriteAccessRequester<_TAccessLease>)->TAsyncSharedV2WeakReadWriteAccessRequester<_TAccessLease>;
+	template<typename _Ty, class _TSharedMutex>
+	TAsyncSharedV2WeakReadWriteAccessRequester(TAsyncSharedV2ReadWriteAccessRequester<_Ty, _TSharedMutex>)->TAsyncSharedV2WeakReadWriteAccessRequester<_Ty, _TSharedMutex>;
 #endif /* MSE_HAS_CXX17 */
 
-	template <typename _Ty>
-	class TAsyncSharedV2ReadOnlyAccessRequester : public TAsyncSharedV2XWPReadOnlyAccessRequester<mse::us::impl::TTaggedUniquePtr<_Ty> > {
+	template <typename _Ty, class _TSharedMutex/* = std::shared_timed_mutex*/>
+	class TAsyncSharedV2ReadOnlyAccessRequester : public TAsyncSharedV2XWPReadOnlyAccessRequester<mse::us::impl::TTaggedUniquePtr<_Ty, _TSharedMutex> > {
 	public:
-		typedef TAsyncSharedV2XWPReadOnlyAccessRequester<mse::us::impl::TTaggedUniquePtr<_Ty> > base_class;
+		typedef TAsyncSharedV2XWPReadOnlyAccessRequester<mse::us::impl::TTaggedUniquePtr<_Ty, _TSharedMutex> > base_class;
 		typedef decltype(std::declval<base_class>().readlock_ptr()) readlock_ptr_t;
 
 		TAsyncSharedV2ReadOnlyAccessRequester(const TAsyncSharedV2ReadOnlyAccessRequester& src_cref) = default;
-		TAsyncSharedV2ReadOnlyAccessRequester(const TAsyncSharedV2ReadWriteAccessRequester<_Ty>& src_cref) : base_class(src_cref) {}
+		TAsyncSharedV2ReadOnlyAccessRequester(const TAsyncSharedV2ReadWriteAccessRequester<_Ty, _TSharedMutex>& src_cref) : base_class(src_cref) {}
 
 		~TAsyncSharedV2ReadOnlyAccessRequester() {
 			/* This is just a no-op function that will cause a compile error when _Ty is not an eligible type. */
@@ -1943,7 +3390,7 @@ namespace mse {
 
 		template <class... Args>
 		static TAsyncSharedV2ReadOnlyAccessRequester make(Args&&... args) {
-			return TAsyncSharedV2ReadOnlyAccessRequester(mse::us::impl::TTaggedUniquePtr<_Ty>(std::make_unique<_Ty>(std::forward<Args>(args)...)));
+			return TAsyncSharedV2ReadOnlyAccessRequester(mse::us::impl::TTaggedUniquePtr<_Ty, _TSharedMutex>(std::make_unique<_Ty>(std::forward<Args>(args)...)));
 		}
 
 		void async_shareable_and_passable_tag() const {}
@@ -1960,7 +3407,7 @@ namespace mse {
 		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && (!std::is_base_of<mse::us::impl::XScopeTagBase, _Ty2>::value), void>::type>
 		void valid_if_Ty_is_not_an_xscope_type() const {}
 
-		TAsyncSharedV2ReadOnlyAccessRequester(mse::us::impl::TTaggedUniquePtr<_Ty>&& uqptr) : base_class(make_asyncsharedv2xwpreadonly(std::forward<decltype(uqptr)>(uqptr))) {}
+		TAsyncSharedV2ReadOnlyAccessRequester(mse::us::impl::TTaggedUniquePtr<_Ty, _TSharedMutex>&& uqptr) : base_class(make_asyncsharedv2xwpreadonly(std::forward<decltype(uqptr)>(uqptr))) {}
 
 		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
 	};
@@ -1970,25 +3417,364 @@ namespace mse {
 		return TAsyncSharedV2ReadOnlyAccessRequester<X>::make(std::forward<Args>(args)...);
 	}
 
-	template <typename _Ty, class _TAccessMutex = non_thread_safe_recursive_shared_timed_mutex>
-	class TXScopeAsyncSharedV2ACOReadWriteAccessRequester
-		: public TXScopeAsyncSharedV2XWPReadWriteAccessRequester<decltype(std::declval<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> >().exclusive_pointer())> {
-	public:
-		typedef TXScopeAsyncSharedV2XWPReadWriteAccessRequester<decltype(std::declval<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> >().exclusive_pointer())> base_class;
-		typedef decltype(std::declval<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> >().exclusive_pointer()) _TExclusiveWritePointer;
-		typedef mse::TXScopeItemFixedPointer<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> > xsac_obj_xscpptr_t;
-		typedef mse::TXScopeItemFixedPointer<mse::TAccessControlledObj<_Ty, _TAccessMutex> > ac_obj_xscpptr_t;
-
-		TXScopeAsyncSharedV2ACOReadWriteAccessRequester(const TXScopeAsyncSharedV2ACOReadWriteAccessRequester& src_cref) = default;
-
-		~TXScopeAsyncSharedV2ACOReadWriteAccessRequester() {
-			/* This is just a no-op function that will cause a compile error when _Ty is not an eligible type. */
-			valid_if_Ty_is_marked_as_xscope_shareable();
-		}
-
-		static auto make(const xsac_obj_xscpptr_t& xscpptr) {
-			return TXScopeAsyncSharedV2ACOReadWriteAccessRequester((*xscpptr).exclusive_pointer());
-		}
+	namespace impl {
+		namespace striped {
+#ifndef NDEBUG
+			/* A (debug-mode) record that the current thread holds a lock on the given stripe (of the set of stripes
+			identified by the given id). Copies (which accompany copies of the lock pointer) are also recorded. */
+			class CHeldStripeRecord {
+			public:
+				typedef size_t size_type;
+				struct CUnorderedAcquisition {};
+
+				/* For blocking acquisitions. Throws if the thread holds a lock on a stripe (of the same set) with a
+				higher index. */
+				CHeldStripeRecord(const void* stripes_id, size_type index) : m_stripes_id(stripes_id), m_index(index) {
+					for (const auto& entry : tl_entries_ref()) {
+						if ((entry.m_stripes_id == stripes_id) && (entry.m_index > index)) {
+							MSE_THROW(std::system_error(std::make_error_code(std::errc::resource_deadlock_would_occur)));
+						}
+					}
+					tl_entries_ref().push_back({ m_stripes_id, m_index });
+				}
+				/* For non-blocking acquisitions. */
+				CHeldStripeRecord(const void* stripes_id, size_type index, CUnorderedAcquisition) : m_stripes_id(stripes_id), m_index(index) {
+					tl_entries_ref().push_back({ m_stripes_id, m_index });
+				}
+				CHeldStripeRecord(const CHeldStripeRecord& src) : m_stripes_id(src.m_stripes_id), m_index(src.m_index) {
+					if (m_stripes_id) {
+						tl_entries_ref().push_back({ m_stripes_id, m_index });
+					}
+				}
+				CHeldStripeRecord(CHeldStripeRecord&& src) : m_stripes_id(src.m_stripes_id), m_index(src.m_index) {
+					src.m_stripes_id = nullptr;
+				}
+				~CHeldStripeRecord() {
+					if (m_stripes_id) {
+						auto& entries_ref = tl_entries_ref();
+						/* (Lock pointers aren't passable to other threads, so the entry should be found.) */
+						for (auto rit = entries_ref.rbegin(); entries_ref.rend() != rit; ++rit) {
+							if (((*rit).m_stripes_id == m_stripes_id) && ((*rit).m_index == m_index)) {
+								entries_ref.erase(std::next(rit).base());
+								break;
+							}
+						}
+					}
+				}
+
+			private:
+				CHeldStripeRecord& operator=(const CHeldStripeRecord&) = delete;
+
+				struct CEntry {
+					const void* m_stripes_id;
+					size_type m_index;
+				};
+				static std::vector<CEntry>& tl_entries_ref() {
+					thread_local std::vector<CEntry> tl_entries;
+					return tl_entries;
+				}
+
+				const void* m_stripes_id = nullptr;
+				size_type m_index = 0;
+			};
+#else // !NDEBUG
+			class CHeldStripeRecord {
+			public:
+				typedef size_t size_type;
+				struct CUnorderedAcquisition {};
+
+				CHeldStripeRecord(const void*, size_type) {}
+				CHeldStripeRecord(const void*, size_type, CUnorderedAcquisition) {}
+			};
+#endif // !NDEBUG
+
+			/* A stripe's lock pointer, accompanied by its (debug-mode) held stripe record. */
+			template<typename _TLockPtr>
+			class TStripeLockPointer : public _TLockPtr {
+			public:
+				typedef _TLockPtr base_class;
+
+				TStripeLockPointer(const TStripeLockPointer& src) = default;
+				TStripeLockPointer(TStripeLockPointer&& src) = default;
+				TStripeLockPointer(_TLockPtr&& src, CHeldStripeRecord&& held_stripe_record)
+					: base_class(std::forward<_TLockPtr>(src)), m_held_stripe_record(std::forward<CHeldStripeRecord>(held_stripe_record)) {}
+
+			private:
+				CHeldStripeRecord m_held_stripe_record;
+			};
+		}
+	}
+
+	/* TAsyncSharedV2StripedReadWriteAccessRequester<> is an access requester for a collection of (a fixed number of)
+	"stripes", each an independently lockable object of type _Ty with its own access mutex. So for example, a shared table
+	can be partitioned into stripes (by key hash or index range) so that threads accessing different stripes don't
+	contend for the same lock. Each stripe is accessed via writelock_ptr(index) or readlock_ptr(index), which lock only the
+	given stripe. When multiple stripes need to be locked simultaneously, writelock_ptrs()/readlock_ptrs() acquire the
+	locks in ascending stripe index order, so that multi-stripe lock acquisitions can't deadlock each other.
+
+	A thread that already holds a lock on one stripe and (separately) requests a lock on a stripe with a lower index risks
+	deadlocking with another thread doing the same in the opposite order. So in debug builds (i.e. when NDEBUG is not
+	defined), the stripes locked by each thread are tracked, and such an out-of-order (blocking) lock request results in
+	an exception (before any blocking). (Non-blocking "try" lock requests can't deadlock, so they're not restricted.) Code
+	that needs more than one stripe at a time should request them all together. */
+	template <typename _Ty>
+	class TAsyncSharedV2StripedReadWriteAccessRequester {
+	public:
+		typedef TAsyncSharedV2ReadWriteAccessRequester<_Ty> stripe_access_requester_t;
+		typedef impl::striped::TStripeLockPointer<typename stripe_access_requester_t::writelock_ptr_t> writelock_ptr_t;
+		typedef impl::striped::TStripeLockPointer<typename stripe_access_requester_t::readlock_ptr_t> readlock_ptr_t;
+		typedef size_t size_type;
+
+		TAsyncSharedV2StripedReadWriteAccessRequester(const TAsyncSharedV2StripedReadWriteAccessRequester& src_cref) = default;
+
+		size_type num_stripes() const { return (*m_shptr).size(); }
+		/* Returns the index of the stripe that the given key maps to. */
+		template <class _TKey, class _THash = std::hash<_TKey> >
+		size_type stripe_index_of_key(const _TKey& key, const _THash& hasher = _THash()) const {
+			return size_type(hasher(key)) % num_stripes();
+		}
+
+		const stripe_access_requester_t& stripe_access_requester(size_type index) const {
+			return (*m_shptr).at(index);
+		}
+		/* In debug builds, these throw if the calling thread already holds a lock on a stripe with a higher index. */
+		writelock_ptr_t writelock_ptr(size_type index) const {
+			/* The held stripe record is created (and the acquisition order verified) before the lock is requested. */
+			held_stripe_record_t held_stripe_record(m_shptr.get(), index);
+			return writelock_ptr_t(stripe_access_requester(index).writelock_ptr(), std::move(held_stripe_record));
+		}
+		readlock_ptr_t readlock_ptr(size_type index) const {
+			held_stripe_record_t held_stripe_record(m_shptr.get(), index);
+			return readlock_ptr_t(stripe_access_requester(index).readlock_ptr(), std::move(held_stripe_record));
+		}
+		mse::mstd::optional<writelock_ptr_t> try_writelock_ptr(size_type index) const {
+			auto maybe_writelock_ptr = stripe_access_requester(index).try_writelock_ptr();
+			if (!maybe_writelock_ptr) {
+				return mse::mstd::optional<writelock_ptr_t>();
+			}
+			return mse::mstd::optional<writelock_ptr_t>(writelock_ptr_t(std::move(*maybe_writelock_ptr)
+				, held_stripe_record_t(m_shptr.get(), index, typename held_stripe_record_t::CUnorderedAcquisition())));
+		}
+		mse::mstd::optional<readlock_ptr_t> try_readlock_ptr(size_type index) const {
+			auto maybe_readlock_ptr = stripe_access_requester(index).try_readlock_ptr();
+			if (!maybe_readlock_ptr) {
+				return mse::mstd::optional<readlock_ptr_t>();
+			}
+			return mse::mstd::optional<readlock_ptr_t>(readlock_ptr_t(std::move(*maybe_readlock_ptr)
+				, held_stripe_record_t(m_shptr.get(), index, typename held_stripe_record_t::CUnorderedAcquisition())));
+		}
+		template <class _TKey>
+		writelock_ptr_t writelock_ptr_for_key(const _TKey& key) const {
+			return writelock_ptr(stripe_index_of_key(key));
+		}
+		template <class _TKey>
+		readlock_ptr_t readlock_ptr_for_key(const _TKey& key) const {
+			return readlock_ptr(stripe_index_of_key(key));
+		}
+
+		/* Locks each of the (distinct) specified stripes, in ascending index order. The returned lock pointers are in the
+		same (ascending) order. As with writelock_ptr()/readlock_ptr(), (in debug builds) an exception is thrown if the
+		calling thread already holds a lock on a stripe with a higher index than (the lowest of) those specified. */
+		std::vector<writelock_ptr_t> writelock_ptrs(std::vector<size_type> indices) const {
+			sort_and_remove_duplicates(indices);
+			std::vector<writelock_ptr_t> retval;
+			retval.reserve(indices.size());
+			for (const auto index : indices) {
+				retval.push_back(writelock_ptr(index));
+			}
+			return retval;
+		}
+		std::vector<readlock_ptr_t> readlock_ptrs(std::vector<size_type> indices) const {
+			sort_and_remove_duplicates(indices);
+			std::vector<readlock_ptr_t> retval;
+			retval.reserve(indices.size());
+			for (const auto index : indices) {
+				retval.push_back(readlock_ptr(index));
+			}
+			return retval;
+		}
+
+		template <class... Args>
+		static TAsyncSharedV2StripedReadWriteAccessRequester make(size_type num_stripes, const Args&... args) {
+			if (0 == num_stripes) { MSE_THROW(std::invalid_argument("the number of stripes must be non-zero - TAsyncSharedV2StripedReadWriteAccessRequester")); }
+			auto stripes_shptr = std::make_shared<std::vector<stripe_access_requester_t> >();
+			(*stripes_shptr).reserve(num_stripes);
+			for (size_type i = 0; i < num_stripes; i += 1) {
+				(*stripes_shptr).push_back(stripe_access_requester_t::make(args...));
+			}
+			return TAsyncSharedV2StripedReadWriteAccessRequester(std::move(stripes_shptr));
+		}
+
+		void async_shareable_and_passable_tag() const {}
+
+	private:
+		typedef impl::striped::CHeldStripeRecord held_stripe_record_t;
+
+		TAsyncSharedV2StripedReadWriteAccessRequester(std::shared_ptr<const std::vector<stripe_access_requester_t> >&& shptr) : m_shptr(std::move(shptr)) {}
+		TAsyncSharedV2StripedReadWriteAccessRequester& operator=(const TAsyncSharedV2StripedReadWriteAccessRequester& _Right_cref) = delete;
+
+		static void sort_and_remove_duplicates(std::vector<size_type>& indices) {
+			std::sort(indices.begin(), indices.end());
+			indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+		}
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		/* The set of stripes is fixed at construction, so the (immutable) vector itself can be shared without a lock. */
+		std::shared_ptr<const std::vector<stripe_access_requester_t> > m_shptr;
+	};
+
+	template <class X, class... Args>
+	TAsyncSharedV2StripedReadWriteAccessRequester<X> make_asyncsharedv2stripedreadwrite(size_t num_stripes, const Args&... args) {
+		return TAsyncSharedV2StripedReadWriteAccessRequester<X>::make(num_stripes, args...);
+	}
+
+	/* TAsyncSharedV2ConcurrentUnorderedMap<> is a (copyable) handle to an unordered map that can be shared among threads.
+	Its elements are partitioned among a fixed number of shards, each an nii_unordered_map<> protected by its own
+	(readers-writer) lock, so operations on keys in different shards don't contend with each other, and lookups only
+	take a shared lock on the relevant shard. Values are accessed either by copy (get()), via a function object invoked
+	while the shard is locked (visit()/cvisit()), or directly via a shard lock pointer (writelock_ptr_for_key()/
+	readlock_ptr_for_key()). */
+	template <class _Key, class _Ty, class _Hash = std::hash<_Key>, class _KeyEqual = std::equal_to<_Key> >
+	class TAsyncSharedV2ConcurrentUnorderedMap {
+	public:
+		typedef mse::nii_unordered_map<_Key, _Ty, _Hash, _KeyEqual> shard_t;
+		typedef TAsyncSharedV2StripedReadWriteAccessRequester<shard_t> striped_access_requester_t;
+		typedef typename striped_access_requester_t::writelock_ptr_t writelock_ptr_t;
+		typedef typename striped_access_requester_t::readlock_ptr_t readlock_ptr_t;
+		typedef _Key key_type;
+		typedef _Ty mapped_type;
+		typedef size_t size_type;
+
+		TAsyncSharedV2ConcurrentUnorderedMap(const TAsyncSharedV2ConcurrentUnorderedMap& src_cref) = default;
+
+		size_type num_shards() const { return m_striped_access_requester.num_stripes(); }
+		size_type shard_index_of_key(const _Key& key) const {
+			return m_striped_access_requester.template stripe_index_of_key<_Key, _Hash>(key);
+		}
+
+		/* Lock pointers to the shard containing the given key. */
+		writelock_ptr_t writelock_ptr_for_key(const _Key& key) const {
+			return m_striped_access_requester.writelock_ptr(shard_index_of_key(key));
+		}
+		readlock_ptr_t readlock_ptr_for_key(const _Key& key) const {
+			return m_striped_access_requester.readlock_ptr(shard_index_of_key(key));
+		}
+
+		bool contains(const _Key& key) const {
+			return (*readlock_ptr_for_key(key)).contains(key);
+		}
+		size_type count(const _Key& key) const {
+			return (*readlock_ptr_for_key(key)).count(key);
+		}
+		/* Returns a copy of the value associated with the key, if present. */
+		mse::mstd::optional<_Ty> get(const _Key& key) const {
+			auto readlock_ptr = readlock_ptr_for_key(key);
+			const shard_t& shard_cref = *readlock_ptr;
+			if (shard_cref.contains(key)) {
+				return mse::mstd::optional<_Ty>(shard_cref.at(key));
+			}
+			return mse::mstd::optional<_Ty>();
+		}
+		/* Invokes the given function object with a (non-const) reference to the value associated with the key (if present)
+		while the key's shard is write locked. Returns whether the key was present. Since the shard lock is recursive, the
+		function object could (via a copy of this handle) reenter the same shard, so structure changes to the shard are
+		disallowed for the duration. An attempt by the function object to insert or erase an element of the shard results
+		in an exception rather than a dangling reference. */
+		template<class _TFunction>
+		bool visit(const _Key& key, _TFunction&& func) const {
+			auto writelock_ptr = writelock_ptr_for_key(key);
+			shard_t& shard_ref = *writelock_ptr;
+			return shard_ref.visit(key, std::forward<_TFunction>(func));
+		}
+		/* Invokes the given function object with a const reference to the value associated with the key (if present)
+		while the key's shard is read locked. Returns whether the key was present. As with visit(), structure changes to
+		the shard are disallowed for the duration. */
+		template<class _TFunction>
+		bool cvisit(const _Key& key, _TFunction&& func) const {
+			auto readlock_ptr = readlock_ptr_for_key(key);
+			const shard_t& shard_cref = *readlock_ptr;
+			return shard_cref.visit(key, std::forward<_TFunction>(func));
+		}
+
+		template<class... _Valty>
+		bool try_emplace(const _Key& key, _Valty&&... _Val) const {
+			return (*writelock_ptr_for_key(key)).try_emplace(key, std::forward<_Valty>(_Val)...);
+		}
+		template<class _Ty2>
+		bool insert_or_assign(const _Key& key, _Ty2&& obj) const {
+			return (*writelock_ptr_for_key(key)).insert_or_assign(key, std::forward<_Ty2>(obj));
+		}
+		size_type erase(const _Key& key) const {
+			return (*writelock_ptr_for_key(key)).erase(key);
+		}
+
+		/* The following operations lock all the shards (in ascending order) for their duration. */
+		size_type size() const {
+			size_type retval = 0;
+			for (const auto& readlock_ptr : m_striped_access_requester.readlock_ptrs(all_shard_indices())) {
+				retval += (*readlock_ptr).size();
+			}
+			return retval;
+		}
+		bool empty() const {
+			return (0 == size());
+		}
+		void clear() const {
+			for (const auto& writelock_ptr : m_striped_access_requester.writelock_ptrs(all_shard_indices())) {
+				(*writelock_ptr).clear();
+			}
+		}
+
+		const striped_access_requester_t& striped_access_requester() const { return m_striped_access_requester; }
+
+		static TAsyncSharedV2ConcurrentUnorderedMap make(size_type num_shards = 16) {
+			return TAsyncSharedV2ConcurrentUnorderedMap(striped_access_requester_t::make(num_shards));
+		}
+
+		void async_shareable_and_passable_tag() const {}
+
+	private:
+		TAsyncSharedV2ConcurrentUnorderedMap(striped_access_requester_t&& src) : m_striped_access_requester(std::move(src)) {}
+		TAsyncSharedV2ConcurrentUnorderedMap& operator=(const TAsyncSharedV2ConcurrentUnorderedMap& _Right_cref) = delete;
+
+		std::vector<size_type> all_shard_indices() const {
+			std::vector<size_type> retval(num_shards());
+			for (size_type i = 0; i < retval.size(); i += 1) {
+				retval[i] = i;
+			}
+			return retval;
+		}
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		striped_access_requester_t m_striped_access_requester;
+	};
+
+	template <class _Key, class _Ty, class _Hash = std::hash<_Key>, class _KeyEqual = std::equal_to<_Key> >
+	TAsyncSharedV2ConcurrentUnorderedMap<_Key, _Ty, _Hash, _KeyEqual> make_asyncsharedv2concurrentunorderedmap(size_t num_shards = 16) {
+		return TAsyncSharedV2ConcurrentUnorderedMap<_Key, _Ty, _Hash, _KeyEqual>::make(num_shards);
+	}
+
+	template <typename _Ty, class _TAccessMutex = non_thread_safe_recursive_shared_timed_mutex>
+	class TXScopeAsyncSharedV2ACOReadWriteAccessRequester
+		: public TXScopeAsyncSharedV2XWPReadWriteAccessRequester<decltype(std::declval<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> >().exclusive_pointer())> {
+	public:
+		typedef TXScopeAsyncSharedV2XWPReadWriteAccessRequester<decltype(std::declval<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> >().exclusive_pointer())> base_class;
+		typedef decltype(std::declval<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> >().exclusive_pointer()) _TExclusiveWritePointer;
+		typedef mse::TXScopeItemFixedPointer<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> > xsac_obj_xscpptr_t;
+		typedef mse::TXScopeItemFixedPointer<mse::TAccessControlledObj<_Ty, _TAccessMutex> > ac_obj_xscpptr_t;
+
+		TXScopeAsyncSharedV2ACOReadWriteAccessRequester(const TXScopeAsyncSharedV2ACOReadWriteAccessRequester& src_cref) = default;
+
+		~TXScopeAsyncSharedV2ACOReadWriteAccessRequester() {
+			/* This is just a no-op function that will cause a compile error when _Ty is not an eligible type. */
+			valid_if_Ty_is_marked_as_xscope_shareable();
+		}
+
+		static auto make(const xsac_obj_xscpptr_t& xscpptr) {
+			return TXScopeAsyncSharedV2ACOReadWriteAccessRequester((*xscpptr).exclusive_pointer());
+		}
 		static auto make(const ac_obj_xscpptr_t& xscpptr) {
 			return TXScopeAsyncSharedV2ACOReadWriteAccessRequester((*xscpptr).exclusive_pointer());
 		}
@@ -2024,6 +3810,8 @@ namespace mse {
 #endif //!MSE_SCOPEPOINTER_DISABLED
 
 
+	template<typename _Ty> class TAsyncSharedV2AtomicSnapshot;
+
 	/* For situations where the shared object is immutable (i.e. is never modified), you don't even need locks or access requesters. */
 	template<typename _Ty>
 	class TAsyncSharedV2ImmutableFixedPointer : public mse::us::impl::AsyncSharedStrongPointerNeverNullTagBase {
@@ -2073,6 +3861,8 @@ namespace mse {
 		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
 
 		std::shared_ptr<const _Ty> m_shptr;
+
+		friend class TAsyncSharedV2AtomicSnapshot<_Ty>;
 	};
 
 	template <class X, class... Args>
@@ -2080,81 +3870,1034 @@ namespace mse {
 		return TAsyncSharedV2ImmutableFixedPointer<X>::make(std::forward<Args>(args)...);
 	}
 
-#ifdef MSESCOPE_H_
-	template<typename _Ty> using TXScopeAsyncSharedV2ImmutableFixedStore = TXScopeStrongNotNullConstPointerStore<TAsyncSharedV2ImmutableFixedPointer<_Ty> >;
+#ifdef MSESCOPE_H_
+	template<typename _Ty> using TXScopeAsyncSharedV2ImmutableFixedStore = TXScopeStrongNotNullConstPointerStore<TAsyncSharedV2ImmutableFixedPointer<_Ty> >;
+
+	template<typename _Ty>
+	TXScopeAsyncSharedV2ImmutableFixedStore<_Ty> make_xscope_strong_pointer_store(const TAsyncSharedV2ImmutableFixedPointer<_Ty>& stored_ptr) {
+		return TXScopeAsyncSharedV2ImmutableFixedStore<_Ty>(stored_ptr);
+	}
+#endif // MSESCOPE_H_
+
+	namespace us {
+		namespace impl {
+			namespace ns_epoch {
+				/* Each thread that reads through an epoch protected pointer is assigned one of these records. A thread only
+				ever writes to its own record, and the records are padded such that the (frequently written) fields of any
+				two records are at least a cache line apart, so readers don't contend with each other. (Padding is used
+				rather than alignas() because, prior to C++17, operator new doesn't honor over-alignment.) A pinned epoch of
+				zero indicates that the thread is not currently reading. */
+				struct CEpochReaderRecord {
+					std::atomic<std::uint64_t> m_pinned_epoch{ 0 };
+					std::atomic<bool> m_in_use{ false };
+					CEpochReaderRecord* m_next_ptr = nullptr;
+					/* only accessed by the owning thread */
+					size_t m_pin_depth = 0;
+					char m_padding[64];
+				};
+
+				/* CEpochDomain implements basic "epoch based reclamation". Writers don't delete replaced objects directly, they
+				"retire" them, tagged with the (incremented) global epoch. A retired object is deleted once every thread that
+				is currently reading has pinned an epoch at least as recent as the object's tag, as such threads can only have
+				obtained the object's replacement. */
+				class CEpochDomain {
+				public:
+					typedef void(*deleter_t)(const void*);
+
+					static CEpochDomain& instance() {
+						/* Intentionally never destroyed, as epoch protected pointers with static storage duration (which
+						retire their objects upon destruction) may be destroyed after it otherwise would be. Objects that
+						remain retired (but unreclaimed) at program exit are leaked. */
+						static CEpochDomain* s_domain_ptr = new CEpochDomain();
+						return *s_domain_ptr;
+					}
+
+					CEpochReaderRecord* acquire_record() {
+						for (auto record_ptr = m_records_head_ptr.load(std::memory_order_acquire); record_ptr; record_ptr = record_ptr->m_next_ptr) {
+							bool expected = false;
+							if ((!record_ptr->m_in_use.load(std::memory_order_relaxed)) && record_ptr->m_in_use.compare_exchange_strong(expected, true)) {
+								return record_ptr;
+							}
+						}
+						auto record_ptr = new CEpochReaderRecord();
+						record_ptr->m_in_use.store(true, std::memory_order_relaxed);
+						auto head_ptr = m_records_head_ptr.load(std::memory_order_relaxed);
+						do {
+							record_ptr->m_next_ptr = head_ptr;
+						} while (!m_records_head_ptr.compare_exchange_weak(head_ptr, record_ptr, std::memory_order_release, std::memory_order_relaxed));
+						return record_ptr;
+					}
+					void release_record(CEpochReaderRecord* record_ptr) {
+						assert(0 == record_ptr->m_pin_depth);
+						record_ptr->m_pinned_epoch.store(0, std::memory_order_release);
+						record_ptr->m_in_use.store(false, std::memory_order_release);
+					}
+
+					void pin(CEpochReaderRecord& record_ref) {
+						if (0 == record_ref.m_pin_depth) {
+							/* The epoch load must synchronize with the increment in retire(), so that if we observe the epoch
+							with which an object was retired, we also observe the (preceding) replacement of the pointer to
+							it. And this (sequentially consistent) store must be ordered before the reader's subsequent load
+							of the protected pointer. */
+							record_ref.m_pinned_epoch.store(m_global_epoch.load(std::memory_order_seq_cst));
+						}
+						record_ref.m_pin_depth += 1;
+					}
+					void unpin(CEpochReaderRecord& record_ref) {
+						assert(1 <= record_ref.m_pin_depth);
+						record_ref.m_pin_depth -= 1;
+						if (0 == record_ref.m_pin_depth) {
+							record_ref.m_pinned_epoch.store(0, std::memory_order_release);
+						}
+					}
+
+					/* The object must have already been made unreachable to new readers (i.e. the pointer to it must have
+					already been replaced) before it is retired. */
+					void retire(const void* obj_ptr, deleter_t deleter) {
+						if (!obj_ptr) { return; }
+						const auto tag = m_global_epoch.fetch_add(1) + 1;
+						{
+							std::lock_guard<std::mutex> lock(m_retired_items_mutex);
+							m_retired_items.push_back(CRetiredItem{ tag, obj_ptr, deleter });
+						}
+						reclaim();
+					}
+					/* Deletes the retired objects that are no longer reachable by any reader. */
+					void reclaim() {
+						std::vector<CRetiredItem> reclaimable_items;
+						{
+							std::lock_guard<std::mutex> lock(m_retired_items_mutex);
+							if (0 == m_retired_items.size()) { return; }
+							const auto min_pinned_epoch = min_pinned_epoch_of_active_readers();
+							auto it = m_retired_items.begin();
+							while (m_retired_items.end() != it) {
+								if ((*it).m_tag <= min_pinned_epoch) {
+									reclaimable_items.push_back(*it);
+									*it = m_retired_items.back();
+									m_retired_items.pop_back();
+								}
+								else {
+									++it;
+								}
+							}
+						}
+						/* The deleters are invoked outside of the lock in case the destructors themselves retire objects. */
+						for (auto& retired_item : reclaimable_items) {
+							retired_item.m_deleter(retired_item.m_obj_ptr);
+						}
+					}
+
+				private:
+					CEpochDomain() {}
+
+					struct CRetiredItem {
+						std::uint64_t m_tag;
+						const void* m_obj_ptr;
+						deleter_t m_deleter;
+					};
+
+					std::uint64_t min_pinned_epoch_of_active_readers() const {
+						auto retval = (std::numeric_limits<std::uint64_t>::max)();
+						for (auto record_ptr = m_records_head_ptr.load(std::memory_order_acquire); record_ptr; record_ptr = record_ptr->m_next_ptr) {
+							const auto pinned_epoch = record_ptr->m_pinned_epoch.load();
+							if ((0 != pinned_epoch) && (pinned_epoch < retval)) {
+								retval = pinned_epoch;
+							}
+						}
+						return retval;
+					}
+
+					/* The global epoch starts at one because a pinned epoch of zero means "not pinned". */
+					std::atomic<std::uint64_t> m_global_epoch{ 1 };
+					std::atomic<CEpochReaderRecord*> m_records_head_ptr{ nullptr };
+					std::mutex m_retired_items_mutex;
+					std::vector<CRetiredItem> m_retired_items;
+				};
+
+				class CEpochThreadRecordHolder {
+				public:
+					CEpochThreadRecordHolder() : m_record_ptr(CEpochDomain::instance().acquire_record()) {}
+					~CEpochThreadRecordHolder() { CEpochDomain::instance().release_record(m_record_ptr); }
+					CEpochReaderRecord* const m_record_ptr;
+				};
+				inline CEpochReaderRecord& tl_epoch_reader_record_ref() {
+					thread_local CEpochThreadRecordHolder tl_holder;
+					return *(tl_holder.m_record_ptr);
+				}
+
+				template<typename _Ty>
+				class TEpochImmutableState {
+				public:
+					TEpochImmutableState(const _Ty* obj_ptr) : m_obj_ptr(obj_ptr) {}
+					~TEpochImmutableState() {
+						/* There may still be readers of the current object, so we retire it rather than deleting it. */
+						CEpochDomain::instance().retire(m_obj_ptr.load(), &delete_obj);
+					}
+					void publish(const _Ty* new_obj_ptr) {
+						auto old_obj_ptr = m_obj_ptr.exchange(new_obj_ptr);
+						CEpochDomain::instance().retire(old_obj_ptr, &delete_obj);
+					}
+					const _Ty* load() const {
+						return m_obj_ptr.load();
+					}
+
+				private:
+					static void delete_obj(const void* obj_ptr) {
+						delete static_cast<const _Ty*>(obj_ptr);
+					}
+
+					std::atomic<const _Ty*> m_obj_ptr;
+				};
+			}
+		}
+	}
+
+	template<typename _Ty> class TAsyncSharedV2EpochImmutablePointer;
+
+	/* A TXScopeAsyncSharedV2EpochPinnedConstPointer<> "pins" the calling thread's epoch for as long as it exists, ensuring
+	that the snapshot it targets won't be reclaimed, even if a newer snapshot is published in the meantime. Obtaining one
+	writes only to the calling thread's own epoch record. */
+	template<typename _Ty>
+	class TXScopeAsyncSharedV2EpochPinnedConstPointer : public mse::us::impl::AsyncSharedStrongPointerNeverNullAsyncNotShareableAndNotPassableTagBase, public mse::us::impl::XScopeTagBase {
+	public:
+		TXScopeAsyncSharedV2EpochPinnedConstPointer(const TXScopeAsyncSharedV2EpochPinnedConstPointer& src) : m_record_ref(src.m_record_ref), m_obj_ptr(src.m_obj_ptr) {
+			mse::us::impl::ns_epoch::CEpochDomain::instance().pin(m_record_ref);
+		}
+		~TXScopeAsyncSharedV2EpochPinnedConstPointer() {
+			mse::us::impl::ns_epoch::CEpochDomain::instance().unpin(m_record_ref);
+		}
+
+		operator bool() const { return true; }
+		const _Ty& operator*() const {
+			return (*m_obj_ptr);
+		}
+		const _Ty* operator->() const {
+			return m_obj_ptr;
+		}
+
+		void async_not_shareable_and_not_passable_tag() const {}
+
+	private:
+		TXScopeAsyncSharedV2EpochPinnedConstPointer(const mse::us::impl::ns_epoch::TEpochImmutableState<_Ty>& state_cref)
+			: m_record_ref(mse::us::impl::ns_epoch::tl_epoch_reader_record_ref()) {
+			mse::us::impl::ns_epoch::CEpochDomain::instance().pin(m_record_ref);
+			m_obj_ptr = state_cref.load();
+		}
+		TXScopeAsyncSharedV2EpochPinnedConstPointer& operator=(const TXScopeAsyncSharedV2EpochPinnedConstPointer&) = delete;
+		void* operator new(size_t size) { return ::operator new(size); }
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		mse::us::impl::ns_epoch::CEpochReaderRecord& m_record_ref;
+		const _Ty* m_obj_ptr = nullptr;
+
+		friend class TAsyncSharedV2EpochImmutablePointer<_Ty>;
+	};
+
+	/* TAsyncSharedV2EpochImmutablePointer<> is a shared handle to an immutable object that can be atomically replaced
+	("published") with a new immutable version, "read-copy-update" style. Readers access the current version through a
+	TXScopeAsyncSharedV2EpochPinnedConstPointer<> obtained from xscope_pinned_ptr(). Unlike copying a
+	TAsyncSharedV2ImmutableFixedPointer<>, this doesn't modify any reference count shared with other threads. Replaced
+	versions are deleted once no reader could still be accessing them. */
+	template<typename _Ty>
+	class TAsyncSharedV2EpochImmutablePointer : public mse::us::impl::AsyncSharedStrongPointerNeverNullTagBase {
+	public:
+		typedef mse::us::impl::ns_epoch::TEpochImmutableState<_Ty> state_t;
+
+		TAsyncSharedV2EpochImmutablePointer(const TAsyncSharedV2EpochImmutablePointer& src_cref) = default;
+		virtual ~TAsyncSharedV2EpochImmutablePointer() {
+			/* This is just a no-op function that will cause a compile error when _Ty is not an eligible type. */
+			valid_if_Ty_is_marked_as_shareable();
+			valid_if_Ty_is_not_an_xscope_type();
+		}
+
+		operator bool() const {
+			return m_shptr.operator bool();
+		}
+
+		TXScopeAsyncSharedV2EpochPinnedConstPointer<_Ty> xscope_pinned_ptr() const {
+			return TXScopeAsyncSharedV2EpochPinnedConstPointer<_Ty>(*m_shptr);
+		}
+
+		/* Replaces the shared object with a new (immutable) one constructed from the given arguments. Readers holding
+		pinned pointers to the previous version can continue to safely use it. */
+		template <class... Args>
+		void publish(Args&&... args) const {
+			(*m_shptr).publish(new const _Ty(std::forward<Args>(args)...));
+		}
+
+		template <class... Args>
+		static TAsyncSharedV2EpochImmutablePointer make(Args&&... args) {
+			return TAsyncSharedV2EpochImmutablePointer(std::make_shared<state_t>(new const _Ty(std::forward<Args>(args)...)));
+		}
+
+		void async_shareable_and_passable_tag() const {}
+
+	private:
+		/* If _Ty is not "marked" as safe to share among threads (via the presence of the "async_shareable_tag()" member
+		function), then the following member function will not instantiate, causing an (intended) compile error. User-defined
+		objects can be marked safe to share by wrapping them with us::TUserDeclaredAsyncShareableObj<>. */
+		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && mse::impl::is_marked_as_shareable_msemsearray<_Ty2>::value, void>::type>
+		void valid_if_Ty_is_marked_as_shareable() const {}
+
+		/* If _Ty is an xscope type, then the following member function will not instantiate, causing an
+		(intended) compile error. */
+		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && (!std::is_base_of<mse::us::impl::XScopeTagBase, _Ty2>::value), void>::type>
+		void valid_if_Ty_is_not_an_xscope_type() const {}
+
+		TAsyncSharedV2EpochImmutablePointer(std::shared_ptr<state_t> shptr) : m_shptr(shptr) {}
+		TAsyncSharedV2EpochImmutablePointer<_Ty>& operator=(const TAsyncSharedV2EpochImmutablePointer<_Ty>& _Right_cref) = delete;
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		std::shared_ptr<state_t> m_shptr;
+	};
+
+	template <class X, class... Args>
+	TAsyncSharedV2EpochImmutablePointer<X> make_asyncsharedv2epochimmutable(Args&&... args) {
+		return TAsyncSharedV2EpochImmutablePointer<X>::make(std::forward<Args>(args)...);
+	}
+
+
+	/* For situations where the shared object is atomic, you don't need locks or access requesters. */
+	template<typename _Ty>
+	class TAsyncSharedV2AtomicFixedPointer : public mse::us::impl::AsyncSharedStrongPointerNeverNullTagBase {
+	public:
+		TAsyncSharedV2AtomicFixedPointer(const TAsyncSharedV2AtomicFixedPointer& src_cref) = default;
+		virtual ~TAsyncSharedV2AtomicFixedPointer() {
+			/* This is just a no-op function that will cause a compile error when _Ty is not an eligible type. */
+			//valid_if_Ty_is_marked_as_shareable();
+			mse::impl::T_valid_if_is_marked_as_shareable_msemsearray<_Ty>();
+			valid_if_Ty_is_not_an_xscope_type();
+		}
+
+		operator bool() const {
+			return m_shptr.operator bool();
+		}
+		auto& operator*() const {
+			return (*m_shptr);
+		}
+		auto operator->() const {
+			return std::addressof(*m_shptr);
+		}
+
+		/* This operator is just for compatibility with existing/legacy code. */
+		explicit operator std::shared_ptr<std::atomic<_Ty> >() const { return m_shptr; }
+
+		template <class... Args>
+		static TAsyncSharedV2AtomicFixedPointer make(Args&&... args) {
+			return TAsyncSharedV2AtomicFixedPointer(std::make_shared<std::atomic<_Ty> >(std::forward<Args>(args)...));
+		}
+
+		void async_shareable_and_passable_tag() const {}
+
+	private:
+		/* If _Ty is not "marked" as safe to share among threads (via the presence of the "async_shareable_tag()" member
+		function), then the following member function will not instantiate, causing an (intended) compile error. User-defined
+		objects can be marked safe to share by wrapping them with us::TUserDeclaredAsyncShareableObj<>. */
+		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && mse::impl::is_marked_as_shareable_and_passable_msemsearray<_Ty2>::value, void>::type>
+		void valid_if_Ty_is_marked_as_shareable() const {}
+
+		/* If _Ty is an xscope type, then the following member function will not instantiate, causing an
+		(intended) compile error. */
+		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && (!std::is_base_of<mse::us::impl::XScopeTagBase, _Ty2>::value), void>::type>
+		void valid_if_Ty_is_not_an_xscope_type() const {}
+
+		TAsyncSharedV2AtomicFixedPointer(std::shared_ptr<std::atomic<_Ty> > shptr) : m_shptr(shptr) {}
+		TAsyncSharedV2AtomicFixedPointer<_Ty>& operator=(const TAsyncSharedV2AtomicFixedPointer<_Ty>& _Right_cref) = delete;
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		std::shared_ptr<std::atomic<_Ty> > m_shptr;
+	};
+
+	template <class X, class... Args>
+	TAsyncSharedV2AtomicFixedPointer<X> make_asyncsharedv2atomic(Args&&... args) {
+		return TAsyncSharedV2AtomicFixedPointer<X>::make(std::forward<Args>(args)...);
+	}
+
+#ifdef MSESCOPE_H_
+	template<typename _Ty> using TXScopeAsyncSharedV2AtomicFixedStore = TXScopeStrongNotNullConstPointerStore<TAsyncSharedV2AtomicFixedPointer<_Ty> >;
+
+	template<typename _Ty>
+	TXScopeAsyncSharedV2AtomicFixedStore<_Ty> make_xscope_strong_pointer_store(const TAsyncSharedV2AtomicFixedPointer<_Ty>& stored_ptr) {
+		return TXScopeAsyncSharedV2AtomicFixedStore<_Ty>(stored_ptr);
+	}
+#endif // MSESCOPE_H_
+
+	namespace us {
+		namespace impl {
+			namespace ns_epoch {
+				template<typename _Ty>
+				class TAtomicSnapshotState {
+				public:
+					TAtomicSnapshotState(const std::shared_ptr<const _Ty>& shptr) : m_node_ptr(new CNode{ shptr }) {}
+					~TAtomicSnapshotState() {
+						/* No thread can be in the middle of a load() (as doing so requires a reference to this object). */
+						delete m_node_ptr.load();
+					}
+					std::shared_ptr<const _Ty> load() const {
+						/* Pinning the epoch ensures that the node won't be deleted before we're done copying its
+						shared_ptr<>, even if it has been replaced in the meantime. */
+						auto& domain_ref = CEpochDomain::instance();
+						auto& record_ref = tl_epoch_reader_record_ref();
+						domain_ref.pin(record_ref);
+						std::shared_ptr<const _Ty> retval = m_node_ptr.load()->m_shptr;
+						domain_ref.unpin(record_ref);
+						return retval;
+					}
+					void store(const std::shared_ptr<const _Ty>& shptr) {
+						auto old_node_ptr = m_node_ptr.exchange(new CNode{ shptr });
+						CEpochDomain::instance().retire(old_node_ptr, &delete_node);
+					}
+
+				private:
+					struct CNode {
+						std::shared_ptr<const _Ty> m_shptr;
+					};
+					static void delete_node(const void* node_ptr) {
+						delete static_cast<const CNode*>(node_ptr);
+					}
+
+					std::atomic<const CNode*> m_node_ptr;
+				};
+			}
+		}
+	}
+
+	/* TAsyncSharedV2AtomicSnapshot<> holds an immutable object that can be atomically replaced. Unlike
+	TAsyncSharedV2AtomicFixedPointer<>, the object doesn't need to be (trivially copyable and) eligible for std::atomic<>.
+	Readers obtain a TAsyncSharedV2ImmutableFixedPointer<> to the current version via snapshot(). This never blocks, even
+	while a writer is publishing a replacement, and costs an atomic load plus a reference count increment. */
+	template<typename _Ty>
+	class TAsyncSharedV2AtomicSnapshot : public mse::us::impl::AsyncSharedStrongPointerNeverNullTagBase {
+	public:
+		typedef mse::us::impl::ns_epoch::TAtomicSnapshotState<_Ty> state_t;
+
+		TAsyncSharedV2AtomicSnapshot(const TAsyncSharedV2AtomicSnapshot& src_cref) = default;
+		virtual ~TAsyncSharedV2AtomicSnapshot() {
+			/* This is just a no-op function that will cause a compile error when _Ty is not an eligible type. */
+			valid_if_Ty_is_marked_as_shareable();
+			valid_if_Ty_is_not_an_xscope_type();
+		}
+
+		operator bool() const {
+			return m_shptr.operator bool();
+		}
+
+		TAsyncSharedV2ImmutableFixedPointer<_Ty> snapshot() const {
+			return TAsyncSharedV2ImmutableFixedPointer<_Ty>((*m_shptr).load());
+		}
+
+		/* Replaces the shared object with a new (immutable) one constructed from the given arguments. Existing snapshots
+		continue to refer to the version that was current when they were obtained. */
+		template <class... Args>
+		void publish(Args&&... args) const {
+			(*m_shptr).store(std::make_shared<const _Ty>(std::forward<Args>(args)...));
+		}
+		/* Replaces the shared object with the target of the given immutable pointer. */
+		void store(const TAsyncSharedV2ImmutableFixedPointer<_Ty>& immptr) const {
+			(*m_shptr).store(immptr.m_shptr);
+		}
+
+		template <class... Args>
+		static TAsyncSharedV2AtomicSnapshot make(Args&&... args) {
+			return TAsyncSharedV2AtomicSnapshot(std::make_shared<state_t>(std::make_shared<const _Ty>(std::forward<Args>(args)...)));
+		}
+
+		void async_shareable_and_passable_tag() const {}
+
+	private:
+		/* If _Ty is not "marked" as safe to share among threads (via the presence of the "async_shareable_tag()" member
+		function), then the following member function will not instantiate, causing an (intended) compile error. User-defined
+		objects can be marked safe to share by wrapping them with us::TUserDeclaredAsyncShareableObj<>. */
+		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && mse::impl::is_marked_as_shareable_msemsearray<_Ty2>::value, void>::type>
+		void valid_if_Ty_is_marked_as_shareable() const {}
+
+		/* If _Ty is an xscope type, then the following member function will not instantiate, causing an
+		(intended) compile error. */
+		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && (!std::is_base_of<mse::us::impl::XScopeTagBase, _Ty2>::value), void>::type>
+		void valid_if_Ty_is_not_an_xscope_type() const {}
+
+		TAsyncSharedV2AtomicSnapshot(std::shared_ptr<state_t> shptr) : m_shptr(shptr) {}
+		TAsyncSharedV2AtomicSnapshot<_Ty>& operator=(const TAsyncSharedV2AtomicSnapshot<_Ty>& _Right_cref) = delete;
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		std::shared_ptr<state_t> m_shptr;
+	};
+
+	template <class X, class... Args>
+	TAsyncSharedV2AtomicSnapshot<X> make_asyncsharedv2atomicsnapshot(Args&&... args) {
+		return TAsyncSharedV2AtomicSnapshot<X>::make(std::forward<Args>(args)...);
+	}
+
+
+	namespace us {
+		namespace impl {
+			namespace ns_channel {
+				inline size_t rounded_up_to_power_of_two(size_t capacity) {
+					size_t retval = 1;
+					while (retval < capacity) {
+						retval <<= 1;
+					}
+					return retval;
+				}
+
+				/* Called (repeatedly) by a thread waiting for a channel to become non-full or non-empty. Returns false once
+				the thread has spun (and yielded) long enough that it should park (block) instead. */
+				inline bool backoff(size_t& attempt_count) {
+					attempt_count += 1;
+					if (64 >= attempt_count) {
+						return true;
+					}
+					else if ((64 + 16) >= attempt_count) {
+						std::this_thread::yield();
+						return true;
+					}
+					return false;
+				}
+
+				/* The state, common to both kinds of channel, used by threads to wait (block) for the channel to become
+				non-empty or non-full, and to determine whether the channel has been "closed". Each wait condition has an
+				"event" counter, which waiting threads park on (with the same wait/notify mechanism as
+				xscope_atomic_wait()), and a count of the threads parked on it. A side only has to bump the event counter and
+				notify when the (other side's) waiting count is non-zero, so in the common case the cost is just a fence and
+				a load. The channel is closed to receivers once all of its senders (including the channel object's ability
+				to vend new ones) are gone, and closed to senders once all of its receivers are. */
+				class CChannelSync {
+				public:
+					/* Called after an element is added. */
+					void notify_not_empty() { notify_if_waiting(m_not_empty_event, m_num_waiting_receivers); }
+					/* Called after an element is removed. */
+					void notify_not_full() { notify_if_waiting(m_not_full_event, m_num_waiting_senders); }
+
+					/* Repeatedly calls try_function until it returns true or abort_function does, spinning briefly before
+					parking on the given event counter. Returns the last result of try_function. */
+					template<typename _TTryFunction, typename _TAbortFunction>
+					static bool wait_until(std::atomic<int>& event_ref, std::atomic<int>& num_waiting_ref, const _TTryFunction& try_function, const _TAbortFunction& abort_function) {
+						size_t attempt_count = 0;
+						while (true) {
+							if (try_function()) {
+								return true;
+							}
+							if (abort_function()) {
+								/* Anything added (or removed) before the other side went away will be visible now. */
+								return try_function();
+							}
+							if (!backoff(attempt_count)) {
+								const auto event = event_ref.load();
+								/* This (sequentially consistent) increment must be ordered before the retry, so that either the
+								retry observes the other side's change, or the other side observes our waiting count. */
+								num_waiting_ref.fetch_add(1);
+								/* The result of the retry must not be discarded, as a successful try_function() call has
+								side effects (it has sent or received an element). */
+								if (try_function()) {
+									num_waiting_ref.fetch_sub(1);
+									return true;
+								}
+								if (!abort_function()) {
+									mse::impl::ns_atomic_wait::wait(static_cast<const std::atomic<int>&>(event_ref), event, std::memory_order_seq_cst);
+								}
+								num_waiting_ref.fetch_sub(1);
+							}
+						}
+					}
+
+					bool is_closed_to_receivers() const { return (0 == m_num_senders.load()); }
+					bool is_closed_to_senders() const { return (0 == m_num_receivers.load()); }
+
+					void add_sender() { m_num_senders.fetch_add(1); }
+					void release_sender() {
+						if (1 == m_num_senders.fetch_sub(1)) {
+							/* Wake any receivers waiting on the now closed channel. */
+							notify_unconditionally(m_not_empty_event);
+						}
+					}
+					void add_receiver() { m_num_receivers.fetch_add(1); }
+					void release_receiver() {
+						if (1 == m_num_receivers.fetch_sub(1)) {
+							notify_unconditionally(m_not_full_event);
+						}
+					}
+
+					std::atomic<int> m_not_empty_event{ 0 };
+					std::atomic<int> m_num_waiting_receivers{ 0 };
+					std::atomic<int> m_not_full_event{ 0 };
+					std::atomic<int> m_num_waiting_senders{ 0 };
+
+				private:
+					static void notify_if_waiting(std::atomic<int>& event_ref, const std::atomic<int>& num_waiting_ref) {
+						/* Pairs with the increment of the waiting count in wait_until(). */
+						std::atomic_thread_fence(std::memory_order_seq_cst);
+						if (0 != num_waiting_ref.load(std::memory_order_relaxed)) {
+							notify_unconditionally(event_ref);
+						}
+					}
+					static void notify_unconditionally(std::atomic<int>& event_ref) {
+						event_ref.fetch_add(1);
+						mse::impl::ns_atomic_wait::notify(static_cast<const std::atomic<int>&>(event_ref), true);
+					}
+
+					/* Both counts start at one, representing the channel object (which can vend new ends). */
+					std::atomic<size_t> m_num_senders{ 1 };
+					std::atomic<size_t> m_num_receivers{ 1 };
+				};
+
+				/* An index that is only written by one side (the producer or the consumer), along with that side's cached
+				copy of the other side's index. It's padded on both sides so that it doesn't share a cache line (or an
+				adjacent, possibly prefetched, one) with the other side's index, or with the (CChannelSync) members
+				preceding it, which both sides read. (Padding is used rather than alignas() because the states are allocated
+				via make_shared(), which, prior to C++17, doesn't honor over-alignment.) */
+				struct CPaddedIndex {
+					char m_leading_padding[128];
+					std::atomic<size_t> m_index{ 0 };
+					size_t m_cached_other_index = 0;
+					char m_trailing_padding[128 - sizeof(std::atomic<size_t>) - sizeof(size_t)];
+				};
+
+				/* TSPSCState<> is a bounded ring buffer for one producer thread and one consumer thread. try_emplace() and
+				try_pop() are wait-free, and in the common case neither side reads a cache line just written by the other. */
+				template<typename _Ty>
+				class TSPSCState : public CChannelSync {
+				public:
+					TSPSCState(size_t capacity) : m_mask(rounded_up_to_power_of_two(capacity) - 1), m_slots(new slot_t[m_mask + 1]) {}
+					TSPSCState(const TSPSCState&) = delete;
+					~TSPSCState() {
+						auto head = m_consumer.m_index.load(std::memory_order_relaxed);
+						const auto tail = m_producer.m_index.load(std::memory_order_relaxed);
+						for (; tail != head; head += 1) {
+							element_ptr(head)->~_Ty();
+						}
+					}
+
+					template<class... Args>
+					bool try_emplace(Args&&... args) {
+						const auto tail = m_producer.m_index.load(std::memory_order_relaxed);
+						if (m_mask < tail - m_producer.m_cached_other_index) {
+							m_producer.m_cached_other_index = m_consumer.m_index.load(std::memory_order_acquire);
+							if (m_mask < tail - m_producer.m_cached_other_index) {
+								return false;
+							}
+						}
+						::new (static_cast<void*>(std::addressof(m_slots[tail & m_mask]))) _Ty(std::forward<Args>(args)...);
+						m_producer.m_index.store(tail + 1, std::memory_order_release);
+						return true;
+					}
+					mse::mstd::optional<_Ty> try_pop() {
+						const auto head = m_consumer.m_index.load(std::memory_order_relaxed);
+						if (head == m_consumer.m_cached_other_index) {
+							m_consumer.m_cached_other_index = m_producer.m_index.load(std::memory_order_acquire);
+							if (head == m_consumer.m_cached_other_index) {
+								return mse::mstd::optional<_Ty>();
+							}
+						}
+						auto l_element_ptr = element_ptr(head);
+						mse::mstd::optional<_Ty> retval(std::move(*l_element_ptr));
+						l_element_ptr->~_Ty();
+						m_consumer.m_index.store(head + 1, std::memory_order_release);
+						return retval;
+					}
+					size_t capacity() const { return m_mask + 1; }
+
+				private:
+					typedef typename std::aligned_storage<sizeof(_Ty), alignof(_Ty)>::type slot_t;
+					_Ty* element_ptr(size_t index) const { return reinterpret_cast<_Ty*>(std::addressof(m_slots[index & m_mask])); }
+
+					CPaddedIndex m_producer; /* the tail */
+					CPaddedIndex m_consumer; /* the head */
+					const size_t m_mask;
+					std::unique_ptr<slot_t[]> m_slots;
+				};
+
+				/* TMPMCState<> is a bounded ring buffer that supports any number of producer and consumer threads. Each slot
+				has a sequence number that indicates whether it's ready to be written or read in the current "lap". Producers
+				(and consumers) only contend with each other on their shared index. try_emplace() and try_pop() are lock-free,
+				but not wait-free, as a thread whose compare-exchange on the shared index keeps losing to other threads must
+				retry. For the (queue) position pos, a slot's sequence number is 2 * pos when it's ready to be written and
+				2 * pos + 1 when it's ready to be read. (With the more common scheme of pos and pos + 1, a written slot of a
+				single slot buffer would look ready to be written at the next position.)
+				Once a thread has claimed a cell (by advancing the shared index), every later thread at that cell waits for
+				its sequence number to be published, so nothing that can throw may happen between claiming a cell and
+				publishing it. So elements are (copy) constructed before a cell is claimed and are only moved into and out
+				of cells, which requires that _Ty be nothrow move constructible. */
+				template<typename _Ty>
+				class TMPMCState : public CChannelSync {
+				public:
+					static_assert(std::is_nothrow_move_constructible<_Ty>::value, "the element type of an mpmc channel must be nothrow move constructible");
+
+					TMPMCState(size_t capacity) : m_mask(rounded_up_to_power_of_two(capacity) - 1), m_cells(new CCell[m_mask + 1]) {
+						for (size_t i = 0; m_mask >= i; i += 1) {
+							m_cells[i].m_sequence.store(2 * i, std::memory_order_relaxed);
+						}
+					}
+					TMPMCState(const TMPMCState&) = delete;
+					~TMPMCState() {
+						while (try_pop()) {}
+					}
+
+					/* Only moves from the given value if it is (successfully) inserted. */
+					bool try_emplace(_Ty&& value) {
+						return try_emplace_nothrow(std::move(value));
+					}
+					bool try_emplace(const _Ty& value) {
+						/* The copy is made before a cell is claimed, as the copy constructor might throw. */
+						_Ty value_copy(value);
+						return try_emplace_nothrow(std::move(value_copy));
+					}
+					mse::mstd::optional<_Ty> try_pop() {
+						auto pos = m_dequeue_pos.m_index.load(std::memory_order_relaxed);
+						CCell* cell_ptr = nullptr;
+						while (true) {
+							cell_ptr = std::addressof(m_cells[pos & m_mask]);
+							const auto sequence = cell_ptr->m_sequence.load(std::memory_order_acquire);
+							const auto diff = std::intptr_t(sequence) - std::intptr_t(2 * pos + 1);
+							if (0 == diff) {
+								if (m_dequeue_pos.m_index.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+									break;
+								}
+							}
+							else if (0 > diff) {
+								/* The cell hasn't been written in this lap, so the channel is empty. */
+								return mse::mstd::optional<_Ty>();
+							}
+							else {
+								pos = m_dequeue_pos.m_index.load(std::memory_order_relaxed);
+							}
+						}
+						auto l_element_ptr = reinterpret_cast<_Ty*>(std::addressof(cell_ptr->m_storage));
+						/* The element is (nothrow) moved out of the cell, and the cell released, before the (possibly
+						throwing) construction of the return value. */
+						_Ty value(std::move(*l_element_ptr));
+						l_element_ptr->~_Ty();
+						cell_ptr->m_sequence.store(2 * (pos + m_mask + 1), std::memory_order_release);
+						return mse::mstd::optional<_Ty>(std::move(value));
+					}
+					size_t capacity() const { return m_mask + 1; }
+
+				private:
+					bool try_emplace_nothrow(_Ty&& value) {
+						auto pos = m_enqueue_pos.m_index.load(std::memory_order_relaxed);
+						CCell* cell_ptr = nullptr;
+						while (true) {
+							cell_ptr = std::addressof(m_cells[pos & m_mask]);
+							const auto sequence = cell_ptr->m_sequence.load(std::memory_order_acquire);
+							const auto diff = std::intptr_t(sequence) - std::intptr_t(2 * pos);
+							if (0 == diff) {
+								if (m_enqueue_pos.m_index.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+									break;
+								}
+							}
+							else if (0 > diff) {
+								/* The cell still holds an element from the previous lap, so the channel is full. */
+								return false;
+							}
+							else {
+								pos = m_enqueue_pos.m_index.load(std::memory_order_relaxed);
+							}
+						}
+						::new (static_cast<void*>(std::addressof(cell_ptr->m_storage))) _Ty(std::move(value));
+						cell_ptr->m_sequence.store(2 * pos + 1, std::memory_order_release);
+						return true;
+					}
+
+					struct CCell {
+						std::atomic<size_t> m_sequence{ 0 };
+						typename std::aligned_storage<sizeof(_Ty), alignof(_Ty)>::type m_storage;
+					};
+
+					CPaddedIndex m_enqueue_pos;
+					CPaddedIndex m_dequeue_pos;
+					const size_t m_mask;
+					std::unique_ptr<CCell[]> m_cells;
+				};
+
+				/* The common implementation of the channel "end" handles. */
+				template<typename _Ty, typename _TState>
+				class TChannelEndBase {
+				public:
+					typedef _Ty value_type;
+
+					TChannelEndBase(const TChannelEndBase& src_cref) : m_state_shptr(src_cref.m_state_shptr), m_is_sender(src_cref.m_is_sender) {
+						add_end();
+					}
+					TChannelEndBase(TChannelEndBase&&) = default;
+					virtual ~TChannelEndBase() {
+						/* These are just no-op functions that will cause a compile error when _Ty is not an eligible type. */
+						valid_if_Ty_is_marked_as_passable();
+						valid_if_Ty_is_not_an_xscope_type();
+
+						release_end();
+					}
+
+					size_t capacity() const { return state_ref().capacity(); }
+
+				protected:
+					TChannelEndBase(const std::shared_ptr<_TState>& state_shptr, bool is_sender) : m_state_shptr(state_shptr), m_is_sender(is_sender) {
+						add_end();
+					}
+
+					_TState& state_ref() const {
+						if (!m_state_shptr) { MSE_THROW(std::logic_error("attempt to use an invalid (moved from?) channel handle")); }
+						return *m_state_shptr;
+					}
+
+					template<class _Ty2>
+					bool try_send_impl(_Ty2&& value) const {
+						auto& l_state_ref = state_ref();
+						const bool retval = l_state_ref.try_emplace(std::forward<_Ty2>(value));
+						if (retval) {
+							l_state_ref.notify_not_empty();
+						}
+						return retval;
+					}
+					template<class _Ty2>
+					bool send_impl(_Ty2&& value) const {
+						auto& l_state_ref = state_ref();
+						/* try_emplace() only moves from the value when it succeeds. */
+						const bool retval = CChannelSync::wait_until(l_state_ref.m_not_full_event, l_state_ref.m_num_waiting_senders
+							, [&l_state_ref, &value]() { return l_state_ref.try_emplace(std::forward<_Ty2>(value)); }
+							, [&l_state_ref]() { return l_state_ref.is_closed_to_senders(); });
+						if (retval) {
+							l_state_ref.notify_not_empty();
+						}
+						return retval;
+					}
+					mse::mstd::optional<_Ty> try_receive_impl() const {
+						auto& l_state_ref = state_ref();
+						auto retval = l_state_ref.try_pop();
+						if (retval) {
+							l_state_ref.notify_not_full();
+						}
+						return retval;
+					}
+					mse::mstd::optional<_Ty> receive_impl() const {
+						auto& l_state_ref = state_ref();
+						mse::mstd::optional<_Ty> retval;
+						CChannelSync::wait_until(l_state_ref.m_not_empty_event, l_state_ref.m_num_waiting_receivers
+							, [&l_state_ref, &retval]() {
+								auto maybe_value = l_state_ref.try_pop();
+								if (maybe_value) {
+									retval.emplace(std::move(maybe_value.value()));
+									return true;
+								}
+								return false;
+							}
+							, [&l_state_ref]() { return l_state_ref.is_closed_to_receivers(); });
+						if (retval) {
+							l_state_ref.notify_not_full();
+						}
+						return retval;
+					}
+
+				private:
+					/* If _Ty is not "marked" as safe to pass between threads (via the presence of the "async_passable_tag()"
+					member function), then the following member function will not instantiate, causing an (intended) compile
+					error. User-defined objects can be marked safe to pass by wrapping them with us::TUserDeclaredAsyncPassableObj<>. */
+					template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && mse::impl::is_marked_as_passable_msemsearray<_Ty2>::value, void>::type>
+					void valid_if_Ty_is_marked_as_passable() const {}
+
+					/* If _Ty is an xscope type, then the following member function will not instantiate, causing an
+					(intended) compile error. */
+					template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && (!std::is_base_of<mse::us::impl::XScopeTagBase, _Ty2>::value), void>::type>
+					void valid_if_Ty_is_not_an_xscope_type() const {}
+
+					void add_end() {
+						if (m_state_shptr) {
+							if (m_is_sender) { m_state_shptr->add_sender(); } else { m_state_shptr->add_receiver(); }
+						}
+					}
+					void release_end() {
+						/* (A moved-from end no longer holds the state.) */
+						if (m_state_shptr) {
+							if (m_is_sender) { m_state_shptr->release_sender(); } else { m_state_shptr->release_receiver(); }
+						}
+					}
+
+					std::shared_ptr<_TState> m_state_shptr;
+					bool m_is_sender = false;
+				};
+			}
+		}
+	}
+
+	template<typename _Ty> class spsc_channel;
+	template<typename _Ty> class mpmc_channel;
+
+	/* The sending end of an spsc_channel<>. There is only one, and it can't be copied, only moved (to the producer thread). */
+	template<typename _Ty>
+	class TSPSCChannelSender : public mse::us::impl::ns_channel::TChannelEndBase<_Ty, mse::us::impl::ns_channel::TSPSCState<_Ty> > {
+	public:
+		typedef mse::us::impl::ns_channel::TChannelEndBase<_Ty, mse::us::impl::ns_channel::TSPSCState<_Ty> > base_class;
+		TSPSCChannelSender(const TSPSCChannelSender&) = delete;
+		TSPSCChannelSender(TSPSCChannelSender&&) = default;
+
+		/* Returns false (without blocking) if the channel is full. */
+		bool try_send(const _Ty& value) const { return base_class::try_send_impl(value); }
+		bool try_send(_Ty&& value) const { return base_class::try_send_impl(std::forward<_Ty>(value)); }
+		/* Waits until there is room in the channel. Returns false (without sending) if the channel is (or becomes) closed
+		to senders, which happens when all of its receivers are gone. */
+		bool send(const _Ty& value) const { return base_class::send_impl(value); }
+		bool send(_Ty&& value) const { return base_class::send_impl(std::forward<_Ty>(value)); }
+
+		void async_passable_tag() const {} /* Indication that this type is eligible to be passed between threads. */
+
+	private:
+		TSPSCChannelSender(const std::shared_ptr<typename mse::us::impl::ns_channel::TSPSCState<_Ty> >& state_shptr) : base_class(state_shptr, true) {}
+		TSPSCChannelSender& operator=(const TSPSCChannelSender&) = delete;
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		friend class spsc_channel<_Ty>;
+	};
 
+	/* The receiving end of an spsc_channel<>. There is only one, and it can't be copied, only moved (to the consumer thread). */
 	template<typename _Ty>
-	TXScopeAsyncSharedV2ImmutableFixedStore<_Ty> make_xscope_strong_pointer_store(const TAsyncSharedV2ImmutableFixedPointer<_Ty>& stored_ptr) {
-		return TXScopeAsyncSharedV2ImmutableFixedStore<_Ty>(stored_ptr);
-	}
-#endif // MSESCOPE_H_
+	class TSPSCChannelReceiver : public mse::us::impl::ns_channel::TChannelEndBase<_Ty, mse::us::impl::ns_channel::TSPSCState<_Ty> > {
+	public:
+		typedef mse::us::impl::ns_channel::TChannelEndBase<_Ty, mse::us::impl::ns_channel::TSPSCState<_Ty> > base_class;
+		TSPSCChannelReceiver(const TSPSCChannelReceiver&) = delete;
+		TSPSCChannelReceiver(TSPSCChannelReceiver&&) = default;
 
+		/* Returns an empty optional (without blocking) if the channel is empty. */
+		mse::mstd::optional<_Ty> try_receive() const { return base_class::try_receive_impl(); }
+		/* Waits until there is an element in the channel. Returns an empty optional if the channel is (or becomes) closed
+		to receivers, which happens when all of its senders are gone, and no elements remain. */
+		mse::mstd::optional<_Ty> receive() const { return base_class::receive_impl(); }
 
-	/* For situations where the shared object is atomic, you don't need locks or access requesters. */
+		void async_passable_tag() const {} /* Indication that this type is eligible to be passed between threads. */
+
+	private:
+		TSPSCChannelReceiver(const std::shared_ptr<typename mse::us::impl::ns_channel::TSPSCState<_Ty> >& state_shptr) : base_class(state_shptr, false) {}
+		TSPSCChannelReceiver& operator=(const TSPSCChannelReceiver&) = delete;
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		friend class spsc_channel<_Ty>;
+	};
+
+	/* spsc_channel<> is a bounded (lock-free and wait-free) queue for passing elements from one thread to another. Its
+	sending and receiving "ends", obtained (once each) via the sender() and receiver() member functions, are (move-only)
+	handles that can be passed to the producer and consumer threads respectively. The capacity is rounded up to a power of
+	two. The element type must be recognized as safe to pass between threads. */
 	template<typename _Ty>
-	class TAsyncSharedV2AtomicFixedPointer : public mse::us::impl::AsyncSharedStrongPointerNeverNullTagBase {
+	class spsc_channel {
 	public:
-		TAsyncSharedV2AtomicFixedPointer(const TAsyncSharedV2AtomicFixedPointer& src_cref) = default;
-		virtual ~TAsyncSharedV2AtomicFixedPointer() {
-			/* This is just a no-op function that will cause a compile error when _Ty is not an eligible type. */
-			//valid_if_Ty_is_marked_as_shareable();
-			mse::impl::T_valid_if_is_marked_as_shareable_msemsearray<_Ty>();
-			valid_if_Ty_is_not_an_xscope_type();
-		}
-
-		operator bool() const {
-			return m_shptr.operator bool();
-		}
-		auto& operator*() const {
-			return (*m_shptr);
+		typedef TSPSCChannelSender<_Ty> sender_t;
+		typedef TSPSCChannelReceiver<_Ty> receiver_t;
+
+		spsc_channel(size_t capacity) : m_state_shptr(std::make_shared<state_t>(capacity)) {}
+		spsc_channel(const spsc_channel&) = delete;
+		~spsc_channel() {
+			if (!m_sender_has_been_obtained) { m_state_shptr->release_sender(); }
+			if (!m_receiver_has_been_obtained) { m_state_shptr->release_receiver(); }
+		}
+
+		sender_t sender() {
+			if (m_sender_has_been_obtained) { MSE_THROW(std::logic_error("the sender of an spsc_channel<> can only be obtained once - mse::spsc_channel<>")); }
+			sender_t retval(m_state_shptr);
+			/* The channel's (potential) sender is handed off to the obtained one. */
+			m_sender_has_been_obtained = true;
+			m_state_shptr->release_sender();
+			return retval;
 		}
-		auto operator->() const {
-			return std::addressof(*m_shptr);
+		receiver_t receiver() {
+			if (m_receiver_has_been_obtained) { MSE_THROW(std::logic_error("the receiver of an spsc_channel<> can only be obtained once - mse::spsc_channel<>")); }
+			receiver_t retval(m_state_shptr);
+			m_receiver_has_been_obtained = true;
+			m_state_shptr->release_receiver();
+			return retval;
 		}
+		size_t capacity() const { return m_state_shptr->capacity(); }
 
-		/* This operator is just for compatibility with existing/legacy code. */
-		explicit operator std::shared_ptr<std::atomic<_Ty> >() const { return m_shptr; }
+	private:
+		typedef mse::us::impl::ns_channel::TSPSCState<_Ty> state_t;
 
-		template <class... Args>
-		static TAsyncSharedV2AtomicFixedPointer make(Args&&... args) {
-			return TAsyncSharedV2AtomicFixedPointer(std::make_shared<std::atomic<_Ty> >(std::forward<Args>(args)...));
-		}
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		std::shared_ptr<state_t> m_state_shptr;
+		bool m_sender_has_been_obtained = false;
+		bool m_receiver_has_been_obtained = false;
+	};
+
+	/* A sending end of an mpmc_channel<>. Any number of copies can be used concurrently from any number of threads. */
+	template<typename _Ty>
+	class TMPMCChannelSender : public mse::us::impl::ns_channel::TChannelEndBase<_Ty, mse::us::impl::ns_channel::TMPMCState<_Ty> > {
+	public:
+		typedef mse::us::impl::ns_channel::TChannelEndBase<_Ty, mse::us::impl::ns_channel::TMPMCState<_Ty> > base_class;
+		TMPMCChannelSender(const TMPMCChannelSender&) = default;
+		TMPMCChannelSender(TMPMCChannelSender&&) = default;
+
+		/* Returns false (without blocking) if the channel is full. */
+		bool try_send(const _Ty& value) const { return base_class::try_send_impl(value); }
+		bool try_send(_Ty&& value) const { return base_class::try_send_impl(std::forward<_Ty>(value)); }
+		/* Waits until there is room in the channel. Returns false (without sending) if the channel is (or becomes) closed
+		to senders, which happens when all of its receivers are gone. */
+		bool send(const _Ty& value) const { return base_class::send_impl(value); }
+		bool send(_Ty&& value) const { return base_class::send_impl(std::forward<_Ty>(value)); }
 
 		void async_shareable_and_passable_tag() const {}
 
 	private:
-		/* If _Ty is not "marked" as safe to share among threads (via the presence of the "async_shareable_tag()" member
-		function), then the following member function will not instantiate, causing an (intended) compile error. User-defined
-		objects can be marked safe to share by wrapping them with us::TUserDeclaredAsyncShareableObj<>. */
-		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && mse::impl::is_marked_as_shareable_and_passable_msemsearray<_Ty2>::value, void>::type>
-		void valid_if_Ty_is_marked_as_shareable() const {}
+		TMPMCChannelSender(const std::shared_ptr<typename mse::us::impl::ns_channel::TMPMCState<_Ty> >& state_shptr) : base_class(state_shptr, true) {}
+		TMPMCChannelSender& operator=(const TMPMCChannelSender&) = delete;
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
 
-		/* If _Ty is an xscope type, then the following member function will not instantiate, causing an
-		(intended) compile error. */
-		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && (!std::is_base_of<mse::us::impl::XScopeTagBase, _Ty2>::value), void>::type>
-		void valid_if_Ty_is_not_an_xscope_type() const {}
+		friend class mpmc_channel<_Ty>;
+	};
 
-		TAsyncSharedV2AtomicFixedPointer(std::shared_ptr<std::atomic<_Ty> > shptr) : m_shptr(shptr) {}
-		TAsyncSharedV2AtomicFixedPointer<_Ty>& operator=(const TAsyncSharedV2AtomicFixedPointer<_Ty>& _Right_cref) = delete;
+	/* A receiving end of an mpmc_channel<>. Any number of copies can be used concurrently from any number of threads. Each
+	element is received by exactly one receiver. */
+	template<typename _Ty>
+	class TMPMCChannelReceiver : public mse::us::impl::ns_channel::TChannelEndBase<_Ty, mse::us::impl::ns_channel::TMPMCState<_Ty> > {
+	public:
+		typedef mse::us::impl::ns_channel::TChannelEndBase<_Ty, mse::us::impl::ns_channel::TMPMCState<_Ty> > base_class;
+		TMPMCChannelReceiver(const TMPMCChannelReceiver&) = default;
+		TMPMCChannelReceiver(TMPMCChannelReceiver&&) = default;
+
+		/* Returns an empty optional (without blocking) if the channel is empty. */
+		mse::mstd::optional<_Ty> try_receive() const { return base_class::try_receive_impl(); }
+		/* Waits until there is an element in the channel. Returns an empty optional if the channel is (or becomes) closed
+		to receivers, which happens when all of its senders are gone, and no elements remain. */
+		mse::mstd::optional<_Ty> receive() const { return base_class::receive_impl(); }
+
+		void async_shareable_and_passable_tag() const {}
 
+	private:
+		TMPMCChannelReceiver(const std::shared_ptr<typename mse::us::impl::ns_channel::TMPMCState<_Ty> >& state_shptr) : base_class(state_shptr, false) {}
+		TMPMCChannelReceiver& operator=(const TMPMCChannelReceiver&) = delete;
 		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
 
-		std::shared_ptr<std::atomic<_Ty> > m_shptr;
+		friend class mpmc_channel<_Ty>;
 	};
 
-	template <class X, class... Args>
-	TAsyncSharedV2AtomicFixedPointer<X> make_asyncsharedv2atomic(Args&&... args) {
-		return TAsyncSharedV2AtomicFixedPointer<X>::make(std::forward<Args>(args)...);
-	}
+	/* mpmc_channel<> is a bounded (lock-free, but not wait-free) queue for passing elements between any number of producer
+	and consumer threads. Its sending and receiving "ends", obtained via the sender() and receiver() member functions,
+	are copyable handles that can be passed to (and shared between) threads. The capacity is rounded up to a power of
+	two. The element type must be recognized as safe to pass between threads. */
+	template<typename _Ty>
+	class mpmc_channel {
+	public:
+		typedef TMPMCChannelSender<_Ty> sender_t;
+		typedef TMPMCChannelReceiver<_Ty> receiver_t;
 
-#ifdef MSESCOPE_H_
-	template<typename _Ty> using TXScopeAsyncSharedV2AtomicFixedStore = TXScopeStrongNotNullConstPointerStore<TAsyncSharedV2AtomicFixedPointer<_Ty> >;
+		mpmc_channel(size_t capacity) : m_state_shptr(std::make_shared<state_t>(capacity)) {}
+		mpmc_channel(const mpmc_channel&) = delete;
+		/* Once the channel object is gone, it's closed to receivers when (the last of) its senders are, and vice versa. */
+		~mpmc_channel() {
+			m_state_shptr->release_sender();
+			m_state_shptr->release_receiver();
+		}
 
-	template<typename _Ty>
-	TXScopeAsyncSharedV2AtomicFixedStore<_Ty> make_xscope_strong_pointer_store(const TAsyncSharedV2AtomicFixedPointer<_Ty>& stored_ptr) {
-		return TXScopeAsyncSharedV2AtomicFixedStore<_Ty>(stored_ptr);
-	}
-#endif // MSESCOPE_H_
+		sender_t sender() const { return sender_t(m_state_shptr); }
+		receiver_t receiver() const { return receiver_t(m_state_shptr); }
+		size_t capacity() const { return m_state_shptr->capacity(); }
+
+	private:
+		typedef mse::us::impl::ns_channel::TMPMCState<_Ty> state_t;
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		std::shared_ptr<state_t> m_state_shptr;
+	};
 
 
 #if defined(MSEPOINTERBASICS_H)
@@ -2729,6 +5472,475 @@ namespace mse {
 #endif /* MSE_HAS_CXX17 */
 
 
+	/* The result of a when_any() combinator. index is the (zero-based) position of the first (input) future to become
+	ready, and value is its value. */
+	template<class _Ty>
+	class when_any_result {
+	public:
+		size_t index = 0;
+		_Ty value;
+	};
+
+	namespace impl {
+		namespace ns_continuation {
+			/* CExecutor is the (fixed size) set of threads on which the library runs future continuations. Jobs run here
+			should not block for any significant length of time. Jobs that do need to block (i.e. wait on a future) can
+			instead be run on a "waiter" thread of their own. The executor owns its waiter threads and joins them before
+			it's destroyed, so they never outlive it. */
+			class CExecutor {
+			public:
+				static CExecutor& s_default() {
+					static CExecutor s_executor;
+					return s_executor;
+				}
+				void post(std::function<void()> job) {
+					{
+						std::lock_guard<std::mutex> lock1(m_mutex);
+						m_jobs.push_back(std::move(job));
+					}
+					m_cv.notify_one();
+				}
+				void run_on_waiter_thread(std::function<void()> job) {
+					join_finished_waiters();
+					std::lock_guard<std::mutex> lock1(m_mutex);
+					m_waiters.emplace_back();
+					auto waiter_it = std::prev(m_waiters.end());
+					/* The waiter thread can't mark itself finished until this lock is released, by which time its entry
+					has been fully set. */
+					(*waiter_it).m_thread = std::thread([this, waiter_it, job = std::move(job)]() {
+						job();
+						std::lock_guard<std::mutex> lock2(m_mutex);
+						(*waiter_it).m_is_finished = true;
+					});
+				}
+				~CExecutor() {
+					/* Jobs run on waiter threads may post jobs to the pool threads, so they're joined first. */
+					join_waiters();
+					{
+						std::lock_guard<std::mutex> lock1(m_mutex);
+						m_stop_requested = true;
+					}
+					m_cv.notify_all();
+					for (auto& thread_ref : m_threads) {
+						thread_ref.join();
+					}
+					/* Any waiter threads started, or jobs posted, while the pool threads were finishing up are handled
+					here. */
+					while (true) {
+						join_waiters();
+						std::unique_lock<std::mutex> lock1(m_mutex);
+						if (m_jobs.empty()) {
+							if (m_waiters.empty()) { break; }
+							continue;
+						}
+						auto job = std::move(m_jobs.front());
+						m_jobs.pop_front();
+						lock1.unlock();
+						job();
+					}
+				}
+
+			private:
+				CExecutor() {
+					const size_t num_threads = (std::max)(size_t(std::thread::hardware_concurrency()), size_t(2));
+					for (size_t i = 0; num_threads > i; i += 1) {
+						m_threads.emplace_back([this]() { run(); });
+					}
+				}
+				CExecutor(const CExecutor&) = delete;
+				CExecutor& operator=(const CExecutor&) = delete;
+
+				/* Runs jobs until a stop is requested and there are no jobs left. */
+				void run() {
+					std::unique_lock<std::mutex> lock1(m_mutex);
+					while (true) {
+						m_cv.wait(lock1, [&]() { return (!m_jobs.empty()) || m_stop_requested; });
+						if (m_jobs.empty()) {
+							break;
+						}
+						auto job = std::move(m_jobs.front());
+						m_jobs.pop_front();
+						lock1.unlock();
+						job();
+						lock1.lock();
+					}
+				}
+
+				void join_finished_waiters() {
+					std::vector<std::thread> finished_threads;
+					{
+						std::lock_guard<std::mutex> lock1(m_mutex);
+						for (auto it = m_waiters.begin(); m_waiters.end() != it;) {
+							if ((*it).m_is_finished) {
+								finished_threads.push_back(std::move((*it).m_thread));
+								it = m_waiters.erase(it);
+							}
+							else {
+								++it;
+							}
+						}
+					}
+					for (auto& thread_ref : finished_threads) {
+						thread_ref.join();
+					}
+				}
+				void join_waiters() {
+					while (true) {
+						std::list<CWaiter> waiters;
+						{
+							std::lock_guard<std::mutex> lock1(m_mutex);
+							/* Entries are only ever removed by this thread (or by join_finished_waiters()), so they can be
+							moved out of the list while their threads are still running. */
+							waiters.splice(waiters.end(), m_waiters);
+						}
+						if (waiters.empty()) { break; }
+						for (auto& waiter_ref : waiters) {
+							waiter_ref.m_thread.join();
+						}
+					}
+				}
+
+				class CWaiter {
+				public:
+					std::thread m_thread;
+					bool m_is_finished = false;
+				};
+
+				std::mutex m_mutex;
+				std::condition_variable m_cv;
+				std::deque<std::function<void()> > m_jobs;
+				bool m_stop_requested = false;
+				std::vector<std::thread> m_threads;
+				std::list<CWaiter> m_waiters;
+			};
+
+			/* The list of callbacks to be posted to the executor once the associated future becomes ready. */
+			class CReadyCallbackList {
+			public:
+				void add(std::function<void()> callback) {
+					{
+						std::lock_guard<std::mutex> lock1(m_mutex);
+						if (!m_is_ready) {
+							m_callbacks.push_back(std::move(callback));
+							return;
+						}
+					}
+					CExecutor::s_default().post(std::move(callback));
+				}
+				void set_ready() {
+					std::vector<std::function<void()> > callbacks;
+					{
+						std::lock_guard<std::mutex> lock1(m_mutex);
+						m_is_ready = true;
+						std::swap(callbacks, m_callbacks);
+					}
+					for (auto& callback : callbacks) {
+						CExecutor::s_default().post(std::move(callback));
+					}
+				}
+
+			private:
+				std::mutex m_mutex;
+				bool m_is_ready = false;
+				std::vector<std::function<void()> > m_callbacks;
+			};
+
+			/* This function object wraps the function passed to (x)async() so that the future's ready callbacks are
+			triggered when the function returns (or throws). */
+			template<class _TFunction>
+			class TReadyNotifyingFunction {
+			public:
+				TReadyNotifyingFunction(const std::shared_ptr<CReadyCallbackList>& ready_callbacks_shptr, _TFunction&& function1)
+					: m_ready_callbacks_shptr(ready_callbacks_shptr), m_function(std::forward<_TFunction>(function1)) {}
+				template<class... _TArgs>
+				decltype(auto) operator()(_TArgs&&... args) {
+					CSetReadyOnDestruction set_ready_on_destruction{ m_ready_callbacks_shptr };
+					return m_function(std::forward<_TArgs>(args)...);
+				}
+
+			private:
+				class CSetReadyOnDestruction {
+				public:
+					~CSetReadyOnDestruction() { m_ready_callbacks_shptr->set_ready(); }
+					std::shared_ptr<CReadyCallbackList> m_ready_callbacks_shptr;
+				};
+
+				std::shared_ptr<CReadyCallbackList> m_ready_callbacks_shptr;
+				typename std::decay<_TFunction>::type m_function;
+			};
+
+			/* Arranges for the given callback to be run once the future becomes ready. The callback should start by
+			wait()ing on the future. Futures that don't have a (ready callback) list (and aren't already ready), and deferred
+			futures, would have to be waited on (or run) by the thread running the callback. Since jobs run by the executor
+			should not block, in these cases the callback is run on one of the executor's waiter threads instead. (The
+			callback shares ownership of the state that contains the future, so the future outlives the thread's use of it.)
+			Note that this means a deferred future's function is run on that (waiter) thread, not on the thread that called
+			then(), when_all() or when_any(). */
+			template<class _Ty>
+			void when_ready(const std::future<_Ty>& future_cref, const std::shared_ptr<CReadyCallbackList>& ready_callbacks_shptr, std::function<void()> callback) {
+				if (!future_cref.valid()) { MSE_THROW(std::future_error(std::future_errc::no_state)); }
+				const auto status = future_cref.wait_for(std::chrono::seconds(0));
+				if (std::future_status::ready == status) {
+					CExecutor::s_default().post(std::move(callback));
+				}
+				else if (ready_callbacks_shptr && (std::future_status::deferred != status)) {
+					ready_callbacks_shptr->add(std::move(callback));
+				}
+				else {
+					CExecutor::s_default().run_on_waiter_thread(std::move(callback));
+				}
+			}
+
+			/* The value produced by a continuation is held here until the continuation's function object and source
+			future(s) have been destroyed, and only then is the result (promise) set. This ensures that nothing associated
+			with the continuation outlives the (scope) future that waits for it. */
+			template<class _TResult>
+			class TPendingResult {
+			public:
+				template<class _TCallable>
+				void compute(_TCallable&& callable) {
+					m_value_uqptr = std::make_unique<_TResult>(callable());
+				}
+				void set(std::promise<_TResult>& promise_ref) {
+					promise_ref.set_value(std::move(*m_value_uqptr));
+				}
+			private:
+				std::unique_ptr<_TResult> m_value_uqptr;
+			};
+			template<>
+			class TPendingResult<void> {
+			public:
+				template<class _TCallable>
+				void compute(_TCallable&& callable) {
+					callable();
+				}
+				void set(std::promise<void>& promise_ref) {
+					promise_ref.set_value();
+				}
+			};
+
+			template<class _TFunction, class _TSource>
+			auto invoke_with_value(_TFunction& function_ref, std::future<_TSource>& source_ref) -> decltype(function_ref(source_ref.get())) {
+				return function_ref(source_ref.get());
+			}
+			template<class _TFunction>
+			auto invoke_with_value(_TFunction& function_ref, std::future<void>& source_ref) -> decltype(function_ref()) {
+				source_ref.get();
+				return function_ref();
+			}
+			template<class _TFunction, class _TSource>
+			struct continuation_result {
+				typedef typename std::decay<decltype(invoke_with_value(std::declval<typename std::decay<_TFunction>::type&>(), std::declval<std::future<_TSource>&>()))>::type type;
+			};
+
+			/* The parts from which a continuation's (or combinator's) resulting future is constructed. m_all_done becomes
+			ready once all the input futures have been disposed of. */
+			template<class _TResult>
+			class TContinuationParts {
+			public:
+				std::future<_TResult> m_future;
+				std::shared_ptr<CReadyCallbackList> m_ready_callbacks_shptr;
+				std::shared_future<void> m_all_done;
+			};
+
+			template<class _TResult>
+			class TContinuationStateBase {
+			public:
+				TContinuationParts<_TResult> parts() {
+					TContinuationParts<_TResult> retval;
+					retval.m_future = m_promise.get_future();
+					retval.m_ready_callbacks_shptr = m_ready_callbacks_shptr;
+					retval.m_all_done = m_all_done_promise.get_future().share();
+					return retval;
+				}
+			protected:
+				void set_result(TPendingResult<_TResult>& pending_result, std::exception_ptr eptr) {
+					if (eptr) {
+						m_promise.set_exception(eptr);
+					}
+					else {
+						pending_result.set(m_promise);
+					}
+					m_ready_callbacks_shptr->set_ready();
+				}
+
+				std::promise<_TResult> m_promise;
+				std::shared_ptr<CReadyCallbackList> m_ready_callbacks_shptr = std::make_shared<CReadyCallbackList>();
+				std::promise<void> m_all_done_promise;
+			};
+
+			/* "then" */
+			template<class _TSource, class _TFunction>
+			class TThenState : public TContinuationStateBase<typename continuation_result<_TFunction, _TSource>::type> {
+			public:
+				typedef typename continuation_result<_TFunction, _TSource>::type result_t;
+				TThenState(std::future<_TSource>&& source, _TFunction&& function1)
+					: m_source(std::move(source)), m_function_uqptr(std::make_unique<typename std::decay<_TFunction>::type>(std::forward<_TFunction>(function1))) {}
+
+				static TContinuationParts<result_t> s_make(std::future<_TSource>&& source, const std::shared_ptr<CReadyCallbackList>& source_ready_callbacks_shptr, _TFunction&& function1) {
+					auto state_shptr = std::make_shared<TThenState>(std::move(source), std::forward<_TFunction>(function1));
+					auto retval = state_shptr->parts();
+					when_ready(state_shptr->m_source, source_ready_callbacks_shptr, [state_shptr]() { state_shptr->run(); });
+					return retval;
+				}
+
+			private:
+				void run() {
+					m_source.wait();
+					TPendingResult<result_t> pending_result;
+					std::exception_ptr eptr;
+					try {
+						pending_result.compute([this]() { return invoke_with_value(*m_function_uqptr, m_source); });
+					}
+					catch (...) {
+						eptr = std::current_exception();
+					}
+					m_function_uqptr.reset();
+					m_source = std::future<_TSource>();
+					(*this).m_all_done_promise.set_value();
+					(*this).set_result(pending_result, eptr);
+				}
+
+				std::future<_TSource> m_source;
+				std::unique_ptr<typename std::decay<_TFunction>::type> m_function_uqptr;
+			};
+
+			/* "when_all" of futures of (possibly) different types */
+			template<class... _Tys>
+			class TWhenAllTupleState : public TContinuationStateBase<std::tuple<_Tys...> > {
+			public:
+				typedef std::tuple<_Tys...> result_t;
+				TWhenAllTupleState(std::future<_Tys>&&... sources) : m_sources(std::move(sources)...) {}
+
+				static TContinuationParts<result_t> s_make(std::array<std::shared_ptr<CReadyCallbackList>, sizeof...(_Tys)> ready_callbacks_shptrs, std::future<_Tys>&&... sources) {
+					auto state_shptr = std::make_shared<TWhenAllTupleState>(std::move(sources)...);
+					auto retval = state_shptr->parts();
+					s_register_callbacks(state_shptr, ready_callbacks_shptrs, std::index_sequence_for<_Tys...>());
+					return retval;
+				}
+
+			private:
+				template<size_t... _Is>
+				static void s_register_callbacks(const std::shared_ptr<TWhenAllTupleState>& state_shptr
+					, const std::array<std::shared_ptr<CReadyCallbackList>, sizeof...(_Tys)>& ready_callbacks_shptrs, std::index_sequence<_Is...>) {
+					int dummy[] = { 0, (when_ready(std::get<_Is>(state_shptr->m_sources), ready_callbacks_shptrs[_Is], [state_shptr]() {
+						std::get<_Is>(state_shptr->m_sources).wait();
+						if (1 == state_shptr->m_num_remaining.fetch_sub(1)) {
+							state_shptr->complete(std::index_sequence_for<_Tys...>());
+						}
+					}), 0)... };
+					(void)dummy;
+				}
+				template<size_t... _Is>
+				void complete(std::index_sequence<_Is...>) {
+					TPendingResult<result_t> pending_result;
+					std::exception_ptr eptr;
+					try {
+						pending_result.compute([this]() { return result_t{ std::get<_Is>(m_sources).get()... }; });
+					}
+					catch (...) {
+						eptr = std::current_exception();
+					}
+					m_sources = std::tuple<std::future<_Tys>...>();
+					(*this).m_all_done_promise.set_value();
+					(*this).set_result(pending_result, eptr);
+				}
+
+				std::tuple<std::future<_Tys>...> m_sources;
+				std::atomic<size_t> m_num_remaining{ sizeof...(_Tys) };
+			};
+
+			/* "when_all" and "when_any" of a sequence of futures of the same type */
+			template<class _Ty, bool _IsWhenAny>
+			class TWhenAllOrAnySequenceState : public TContinuationStateBase<typename std::conditional<_IsWhenAny, when_any_result<_Ty>, std::vector<_Ty> >::type> {
+			public:
+				typedef typename std::conditional<_IsWhenAny, when_any_result<_Ty>, std::vector<_Ty> >::type result_t;
+				TWhenAllOrAnySequenceState(std::vector<std::future<_Ty> >&& sources) : m_sources(std::move(sources)), m_num_remaining(m_sources.size()) {}
+
+				static TContinuationParts<result_t> s_make(std::vector<std::future<_Ty> >&& sources, const std::vector<std::shared_ptr<CReadyCallbackList> >& ready_callbacks_shptrs) {
+					assert(sources.size() == ready_callbacks_shptrs.size());
+					auto state_shptr = std::make_shared<TWhenAllOrAnySequenceState>(std::move(sources));
+					auto retval = state_shptr->parts();
+					/* Once the last callback has been registered, the sources may be disposed of at any time. */
+					const size_t num_sources = state_shptr->m_sources.size();
+					if (0 == num_sources) {
+						state_shptr->complete_empty();
+					}
+					for (size_t i = 0; num_sources > i; i += 1) {
+						when_ready(state_shptr->m_sources[i], ready_callbacks_shptrs[i], [state_shptr, i]() { state_shptr->source_ready(i); });
+					}
+					return retval;
+				}
+
+			private:
+				void source_ready(size_t index) {
+					m_sources[index].wait();
+					source_ready(index, std::integral_constant<bool, _IsWhenAny>());
+				}
+				/* when_any */
+				void source_ready(size_t index, std::true_type) {
+					if (!m_result_is_claimed.exchange(true)) {
+						TPendingResult<result_t> pending_result;
+						std::exception_ptr eptr;
+						try {
+							pending_result.compute([&]() { return result_t{ index, m_sources[index].get() }; });
+						}
+						catch (...) {
+							eptr = std::current_exception();
+						}
+						m_sources[index] = std::future<_Ty>();
+						(*this).set_result(pending_result, eptr);
+					}
+					if (1 == m_num_remaining.fetch_sub(1)) {
+						m_sources.clear();
+						(*this).m_all_done_promise.set_value();
+					}
+				}
+				/* when_all */
+				void source_ready(size_t, std::false_type) {
+					if (1 == m_num_remaining.fetch_sub(1)) {
+						TPendingResult<result_t> pending_result;
+						std::exception_ptr eptr;
+						try {
+							pending_result.compute([this]() {
+								result_t retval;
+								retval.reserve(m_sources.size());
+								for (auto& source_ref : m_sources) {
+									retval.push_back(source_ref.get());
+								}
+								return retval;
+							});
+						}
+						catch (...) {
+							eptr = std::current_exception();
+						}
+						m_sources.clear();
+						(*this).m_all_done_promise.set_value();
+						(*this).set_result(pending_result, eptr);
+					}
+				}
+				void complete_empty() {
+					complete_empty(std::integral_constant<bool, _IsWhenAny>());
+				}
+				void complete_empty(std::true_type) {
+					TPendingResult<result_t> pending_result;
+					(*this).m_all_done_promise.set_value();
+					(*this).set_result(pending_result, std::make_exception_ptr(std::invalid_argument("no futures - when_any()")));
+				}
+				void complete_empty(std::false_type) {
+					TPendingResult<result_t> pending_result;
+					pending_result.compute([]() { return result_t(); });
+					(*this).m_all_done_promise.set_value();
+					(*this).set_result(pending_result, std::exception_ptr());
+				}
+
+				std::vector<std::future<_Ty> > m_sources;
+				std::atomic<size_t> m_num_remaining;
+				std::atomic<bool> m_result_is_claimed{ false };
+			};
+		}
+	}
+
 	namespace mstd {
 		/* thread is currently publicly derived from std::thread for reasons of implementation convenience. Expect that
 		in the future it will not be. */
@@ -2762,25 +5974,135 @@ namespace mse {
 			static void s_valid_if_passable() {}
 		};
 
-		template<class _Ty> using future = std::future<_Ty>;
+		template<class _Ty> class future;
+		template<class _Fty, class... _ArgTypes> auto async(std::launch _Policy, _Fty&& _Fnarg, _ArgTypes&&... _Args) -> future<decltype(std::async(_Policy, std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get())>;
+		template<class _Fty, class... _ArgTypes> auto async(_Fty&& _Fnarg, _ArgTypes&&... _Args) -> future<decltype(std::async(std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get())>;
+
+		/* future is currently publicly derived from std::future for reasons of implementation convenience. Expect that
+		in the future it will not be. In addition to the std::future interface, it supports continuations via its then()
+		member function. */
+		template<class _Ty>
+		class future : public std::future<_Ty> {
+		public:
+			typedef std::future<_Ty> base_class;
+			typedef _Ty value_type;
+
+			future() _NOEXCEPT {}
+			future(future&& _Other) _NOEXCEPT = default;
+			future(base_class&& _Other) _NOEXCEPT : base_class(std::forward<decltype(_Other)>(_Other)) {}
+			future& operator=(future&& _Right) _NOEXCEPT = default;
+
+			/* Returns a future of the result of the given function applied to this future's value (or, if this future's
+			value type is void, of the given function called with no arguments). The function is run on a library
+			executor thread once this future becomes ready, without occupying a thread in the meantime. If this
+			future holds an exception, the function is not called and the exception is propagated to the returned future.
+			This future is no longer valid after the call. As with async(), the function object and its return value
+			are required to be of a type that's safely passable to other threads. */
+			template<class _Fn>
+			future<typename mse::impl::ns_continuation::continuation_result<_Fn, _Ty>::type> then(_Fn&& _Fx) {
+				typedef typename mse::impl::ns_continuation::continuation_result<_Fn, _Ty>::type result_t;
+				thread::s_valid_if_passable(_Fx);
+				mse::impl::T_valid_if_is_marked_as_passable_or_shareable_msemsearray<result_t>();
+				return future<result_t>(mse::impl::ns_continuation::TThenState<_Ty, _Fn>::s_make(
+					std::move(static_cast<base_class&>(*this)), m_ready_callbacks_shptr, std::forward<_Fn>(_Fx)));
+			}
+
+		private:
+			future(mse::impl::ns_continuation::TContinuationParts<_Ty>&& parts) _NOEXCEPT
+				: base_class(std::move(parts.m_future)), m_ready_callbacks_shptr(std::move(parts.m_ready_callbacks_shptr)) {}
+			future(base_class&& _Other, const std::shared_ptr<mse::impl::ns_continuation::CReadyCallbackList>& ready_callbacks_shptr) _NOEXCEPT
+				: base_class(std::forward<decltype(_Other)>(_Other)), m_ready_callbacks_shptr(ready_callbacks_shptr) {}
+
+			/* Futures that don't have a ready callback list (i.e. ones converted from std::futures) are supported, but
+			the executor has to dedicate a thread to waiting for them. */
+			std::shared_ptr<mse::impl::ns_continuation::CReadyCallbackList> m_ready_callbacks_shptr;
+
+			template<class _Ty2> friend class future;
+			template<class _Fty, class... _ArgTypes>
+			friend auto async(std::launch _Policy, _Fty&& _Fnarg, _ArgTypes&&... _Args) -> future<decltype(std::async(_Policy, std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get())>;
+			template<class _Fty, class... _ArgTypes>
+			friend auto async(_Fty&& _Fnarg, _ArgTypes&&... _Args) -> future<decltype(std::async(std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get())>;
+			template<class... _Tys>
+			friend future<std::tuple<_Tys...> > when_all(future<_Tys>&&... futures);
+			template<class _TInputIt>
+			friend auto when_all(_TInputIt first, _TInputIt last)->future<std::vector<typename std::iterator_traits<_TInputIt>::value_type::value_type> >;
+			template<class _Ty2, class... _Tys>
+			friend future<when_any_result<_Ty2> > when_any(future<_Ty2>&& future1, future<_Tys>&&... futures);
+			template<class _TInputIt>
+			friend auto when_any(_TInputIt first, _TInputIt last)->future<when_any_result<typename std::iterator_traits<_TInputIt>::value_type::value_type> >;
+		};
 
 		template<class _Fty, class... _ArgTypes>
-		inline auto async(std::launch _Policy, _Fty&& _Fnarg, _ArgTypes&&... _Args) {
+		inline auto async(std::launch _Policy, _Fty&& _Fnarg, _ArgTypes&&... _Args) -> future<decltype(std::async(_Policy, std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get())> {
 			// ensure that the function arguments are of a safely passable type
 			thread::s_valid_if_passable(_Args...);
 			// ensure that the function return value is of a safely passable type
 			mse::impl::T_valid_if_is_marked_as_passable_or_shareable_msemsearray<decltype(_Fnarg(std::forward<_ArgTypes>(_Args)...))>();
 			thread::s_valid_if_passable(_Fnarg);
-			return (std::async(_Policy, std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...));
+			typedef decltype(std::async(_Policy, std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get()) future_element_t;
+			auto ready_callbacks_shptr = std::make_shared<mse::impl::ns_continuation::CReadyCallbackList>();
+			return future<future_element_t>(std::async(_Policy, mse::impl::ns_continuation::TReadyNotifyingFunction<_Fty>(ready_callbacks_shptr, std::forward<_Fty>(_Fnarg))
+				, std::forward<_ArgTypes>(_Args)...), ready_callbacks_shptr);
 		}
 
 		template<class _Fty, class... _ArgTypes>
-		inline auto async(_Fty&& _Fnarg, _ArgTypes&&... _Args) {
+		inline auto async(_Fty&& _Fnarg, _ArgTypes&&... _Args) -> future<decltype(std::async(std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get())> {
 			// ensure that the function arguments are of a safely passable type
 			thread::s_valid_if_passable(_Args...);
 			// ensure that the function return value is of a safely passable type
 			mse::impl::T_valid_if_is_marked_as_passable_or_shareable_msemsearray<decltype(_Fnarg(std::forward<_ArgTypes>(_Args)...))>();
-			return (std::async(std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...));
+			typedef decltype(std::async(std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get()) future_element_t;
+			auto ready_callbacks_shptr = std::make_shared<mse::impl::ns_continuation::CReadyCallbackList>();
+			return future<future_element_t>(std::async(mse::impl::ns_continuation::TReadyNotifyingFunction<_Fty>(ready_callbacks_shptr, std::forward<_Fty>(_Fnarg))
+				, std::forward<_ArgTypes>(_Args)...), ready_callbacks_shptr);
+		}
+
+		/* Returns a future of a tuple of the values of the given futures, which becomes ready once all of them are. If any of
+		them holds an exception, (the first such) exception is propagated instead. The given futures are no longer valid after
+		the call. */
+		template<class... _Tys>
+		future<std::tuple<_Tys...> > when_all(future<_Tys>&&... futures) {
+			std::array<std::shared_ptr<mse::impl::ns_continuation::CReadyCallbackList>, sizeof...(_Tys)> ready_callbacks_shptrs{ { futures.m_ready_callbacks_shptr... } };
+			return future<std::tuple<_Tys...> >(mse::impl::ns_continuation::TWhenAllTupleState<_Tys...>::s_make(ready_callbacks_shptrs
+				, std::move(static_cast<std::future<_Tys>&>(futures))...));
+		}
+		/* Returns a future of a vector of the values of the futures in the given range (whose elements are moved from). */
+		template<class _TInputIt>
+		auto when_all(_TInputIt first, _TInputIt last) -> future<std::vector<typename std::iterator_traits<_TInputIt>::value_type::value_type> > {
+			typedef typename std::iterator_traits<_TInputIt>::value_type::value_type element_t;
+			static_assert(!std::is_void<element_t>::value, "futures of void are not supported by when_all() - mse::mstd::when_all()");
+			std::vector<std::future<element_t> > sources;
+			std::vector<std::shared_ptr<mse::impl::ns_continuation::CReadyCallbackList> > ready_callbacks_shptrs;
+			for (; last != first; ++first) {
+				ready_callbacks_shptrs.push_back((*first).m_ready_callbacks_shptr);
+				sources.push_back(std::move(static_cast<std::future<element_t>&>(*first)));
+			}
+			return future<std::vector<element_t> >(mse::impl::ns_continuation::TWhenAllOrAnySequenceState<element_t, false>::s_make(std::move(sources), ready_callbacks_shptrs));
+		}
+
+		/* Returns a future of the index and value of the first of the given futures to become ready. The given futures (which
+		must be of the same type) are no longer valid after the call. The ones that weren't first continue to run. */
+		template<class _Ty, class... _Tys>
+		future<when_any_result<_Ty> > when_any(future<_Ty>&& future1, future<_Tys>&&... futures) {
+			static_assert(!std::is_void<_Ty>::value, "futures of void are not supported by when_any() - mse::mstd::when_any()");
+			std::vector<std::future<_Ty> > sources;
+			sources.push_back(std::move(static_cast<std::future<_Ty>&>(future1)));
+			int dummy[] = { 0, (sources.push_back(std::move(static_cast<std::future<_Ty>&>(futures))), 0)... };
+			(void)dummy;
+			std::vector<std::shared_ptr<mse::impl::ns_continuation::CReadyCallbackList> > ready_callbacks_shptrs{ future1.m_ready_callbacks_shptr, futures.m_ready_callbacks_shptr... };
+			return future<when_any_result<_Ty> >(mse::impl::ns_continuation::TWhenAllOrAnySequenceState<_Ty, true>::s_make(std::move(sources), ready_callbacks_shptrs));
+		}
+		template<class _TInputIt>
+		auto when_any(_TInputIt first, _TInputIt last) -> future<when_any_result<typename std::iterator_traits<_TInputIt>::value_type::value_type> > {
+			typedef typename std::iterator_traits<_TInputIt>::value_type::value_type element_t;
+			static_assert(!std::is_void<element_t>::value, "futures of void are not supported by when_any() - mse::mstd::when_any()");
+			std::vector<std::future<element_t> > sources;
+			std::vector<std::shared_ptr<mse::impl::ns_continuation::CReadyCallbackList> > ready_callbacks_shptrs;
+			for (; last != first; ++first) {
+				ready_callbacks_shptrs.push_back((*first).m_ready_callbacks_shptr);
+				sources.push_back(std::move(static_cast<std::future<element_t>&>(*first)));
+			}
+			return future<when_any_result<element_t> >(mse::impl::ns_continuation::TWhenAllOrAnySequenceState<element_t, true>::s_make(std::move(sources), ready_callbacks_shptrs));
 		}
 	}
 
@@ -2873,11 +6195,14 @@ namespace mse {
 	template<class _Fty, class... _ArgTypes> auto xscope_async(std::launch _Policy, _Fty&& _Fnarg, _ArgTypes&&... _Args) -> xscope_future<decltype(std::async(_Policy, std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get())>;
 	template<class _Fty, class... _ArgTypes> auto xscope_async(_Fty&& _Fnarg, _ArgTypes&&... _Args) -> xscope_future<decltype(std::async(std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get())>;
 	template<class _Ty> class xscope_future_carrier;
+	template<class... _Tys> xscope_future<std::tuple<_Tys...> > xscope_when_all(xscope_future<_Tys>&... futures);
+	template<class _Ty, class... _Tys> xscope_future<when_any_result<_Ty> > xscope_when_any(xscope_future<_Ty>& future1, xscope_future<_Tys>&... futures);
 
 	template<class _Ty>
 	class xscope_future : public std::future<_Ty>, public mse::us::impl::XScopeTagBase {
 	public:
 		typedef std::future<_Ty> base_class;
+		typedef _Ty value_type;
 
 		xscope_future() _NOEXCEPT {}
 
@@ -2887,6 +6212,11 @@ namespace mse {
 			if (valid()) {
 				wait();
 			}
+			/* Any (unfinished) tasks this future was derived from (via then() or xscope_when_any() for example) are also
+			waited for. */
+			for (auto& dependent_ref : m_dependents) {
+				dependent_ref.wait();
+			}
 		}
 
 		_Ty get() {
@@ -2916,12 +6246,41 @@ namespace mse {
 			return base_class::wait_until(_Abs_time);
 		}
 
+		/* The scope counterpart of mstd::future<>::then(). The function object and its return value are required to be of
+		a type that's safely passable to other scope threads. This future is no longer valid after the call. */
+		template<class _Fn>
+		xscope_future<typename mse::impl::ns_continuation::continuation_result<_Fn, _Ty>::type> then(_Fn&& _Fx) {
+			typedef typename mse::impl::ns_continuation::continuation_result<_Fn, _Ty>::type result_t;
+			xscope_thread::s_valid_if_xscope_passable(_Fx);
+			mse::impl::T_valid_if_is_marked_as_xscope_passable_msemsearray<result_t>();
+			auto dependents = std::move(m_dependents);
+			m_dependents.clear();
+			return xscope_future<result_t>(mse::impl::ns_continuation::TThenState<_Ty, _Fn>::s_make(
+				std::move(static_cast<base_class&>(*this)), m_ready_callbacks_shptr, std::forward<_Fn>(_Fx)), std::move(dependents));
+		}
+
 	private:
-		xscope_future(xscope_future&& _Other) _NOEXCEPT : base_class(std::forward<decltype(_Other)>(_Other)) {}
+		xscope_future(xscope_future&& _Other) _NOEXCEPT : base_class(std::forward<decltype(_Other)>(_Other))
+			, m_ready_callbacks_shptr(std::move(_Other.m_ready_callbacks_shptr)), m_dependents(std::move(_Other.m_dependents)) {}
 		xscope_future(base_class&& _Other) _NOEXCEPT : base_class(std::forward<decltype(_Other)>(_Other)) {}
+		xscope_future(base_class&& _Other, const std::shared_ptr<mse::impl::ns_continuation::CReadyCallbackList>& ready_callbacks_shptr) _NOEXCEPT
+			: base_class(std::forward<decltype(_Other)>(_Other)), m_ready_callbacks_shptr(ready_callbacks_shptr) {}
+		xscope_future(mse::impl::ns_continuation::TContinuationParts<_Ty>&& parts, std::vector<std::shared_future<void> >&& dependents)
+			: base_class(std::move(parts.m_future)), m_ready_callbacks_shptr(std::move(parts.m_ready_callbacks_shptr)), m_dependents(std::move(dependents)) {
+			m_dependents.push_back(std::move(parts.m_all_done));
+		}
 
 		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
 
+		std::shared_ptr<mse::impl::ns_continuation::CReadyCallbackList> m_ready_callbacks_shptr;
+		std::vector<std::shared_future<void> > m_dependents;
+
+		template<class _Ty2> friend class xscope_future;
+		template<class... _Tys>
+		friend xscope_future<std::tuple<_Tys...> > xscope_when_all(xscope_future<_Tys>&... futures);
+		template<class _Ty2, class... _Tys>
+		friend xscope_future<when_any_result<_Ty2> > xscope_when_any(xscope_future<_Ty2>& future1, xscope_future<_Tys>&... futures);
+
 		template<class _Fty, class... _ArgTypes>
 		friend auto xscope_async(std::launch _Policy, _Fty&& _Fnarg, _ArgTypes&&... _Args) -> xscope_future<decltype(std::async(_Policy, std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get())>;
 		template<class _Fty, class... _ArgTypes>
@@ -2938,7 +6297,9 @@ namespace mse {
 		// ensure that the function return value is of a safely passable type
 		mse::impl::T_valid_if_is_marked_as_xscope_passable_msemsearray<decltype(_Fnarg(std::forward<_ArgTypes>(_Args)...))>();
 		typedef decltype(std::async(_Policy, std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get()) future_element_t;
-		return xscope_future<future_element_t>(std::async(_Policy, std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...));
+		auto ready_callbacks_shptr = std::make_shared<mse::impl::ns_continuation::CReadyCallbackList>();
+		return xscope_future<future_element_t>(std::async(_Policy, mse::impl::ns_continuation::TReadyNotifyingFunction<_Fty>(ready_callbacks_shptr, std::forward<_Fty>(_Fnarg))
+			, std::forward<_ArgTypes>(_Args)...), ready_callbacks_shptr);
 	}
 
 	template<class _Fty, class... _ArgTypes>
@@ -2948,7 +6309,48 @@ namespace mse {
 		// ensure that the function return value is of a safely passable type
 		mse::impl::T_valid_if_is_marked_as_xscope_passable_msemsearray<decltype(_Fnarg(std::forward<_ArgTypes>(_Args)...))>();
 		typedef decltype(std::async(std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get()) future_element_t;
-		return xscope_future<future_element_t>(std::async(std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...));
+		auto ready_callbacks_shptr = std::make_shared<mse::impl::ns_continuation::CReadyCallbackList>();
+		return xscope_future<future_element_t>(std::async(mse::impl::ns_continuation::TReadyNotifyingFunction<_Fty>(ready_callbacks_shptr, std::forward<_Fty>(_Fnarg))
+			, std::forward<_ArgTypes>(_Args)...), ready_callbacks_shptr);
+	}
+
+	namespace impl {
+		namespace ns_continuation {
+			inline void append_dependents(std::vector<std::shared_future<void> >& dependents, std::vector<std::shared_future<void> >& source_dependents) {
+				for (auto& dependent_ref : source_dependents) {
+					dependents.push_back(std::move(dependent_ref));
+				}
+				source_dependents.clear();
+			}
+		}
+	}
+
+	/* The scope counterpart of mstd::when_all(). The given futures are no longer valid after the call. */
+	template<class... _Tys>
+	xscope_future<std::tuple<_Tys...> > xscope_when_all(xscope_future<_Tys>&... futures) {
+		std::vector<std::shared_future<void> > dependents;
+		int dummy[] = { 0, (mse::impl::ns_continuation::append_dependents(dependents, futures.m_dependents), 0)... };
+		(void)dummy;
+		std::array<std::shared_ptr<mse::impl::ns_continuation::CReadyCallbackList>, sizeof...(_Tys)> ready_callbacks_shptrs{ { futures.m_ready_callbacks_shptr... } };
+		return xscope_future<std::tuple<_Tys...> >(mse::impl::ns_continuation::TWhenAllTupleState<_Tys...>::s_make(ready_callbacks_shptrs
+			, std::move(static_cast<std::future<_Tys>&>(futures))...), std::move(dependents));
+	}
+	/* The scope counterpart of mstd::when_any(). The given futures are no longer valid after the call. The returned
+	future's destructor waits for all of them (not just the first) to finish. */
+	template<class _Ty, class... _Tys>
+	xscope_future<when_any_result<_Ty> > xscope_when_any(xscope_future<_Ty>& future1, xscope_future<_Tys>&... futures) {
+		static_assert(!std::is_void<_Ty>::value, "futures of void are not supported by xscope_when_any() - mse::xscope_when_any()");
+		std::vector<std::shared_future<void> > dependents;
+		mse::impl::ns_continuation::append_dependents(dependents, future1.m_dependents);
+		int dummy[] = { 0, (mse::impl::ns_continuation::append_dependents(dependents, futures.m_dependents), 0)... };
+		(void)dummy;
+		std::vector<std::shared_ptr<mse::impl::ns_continuation::CReadyCallbackList> > ready_callbacks_shptrs{ future1.m_ready_callbacks_shptr, futures.m_ready_callbacks_shptr... };
+		std::vector<std::future<_Ty> > sources;
+		sources.push_back(std::move(static_cast<std::future<_Ty>&>(future1)));
+		int dummy2[] = { 0, (sources.push_back(std::move(static_cast<std::future<_Ty>&>(futures))), 0)... };
+		(void)dummy2;
+		return xscope_future<when_any_result<_Ty> >(mse::impl::ns_continuation::TWhenAllOrAnySequenceState<_Ty, true>::s_make(std::move(sources), ready_callbacks_shptrs)
+			, std::move(dependents));
 	}
 
 	template<class _Ty>
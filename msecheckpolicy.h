@@ -0,0 +1,105 @@
+// Copyright (c) 2015 Noah Lopez
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+/* The run-time checks performed by the nii_array<>, nii_vector<> (gnii_vector<>) and nii_basic_string<> containers, and
+their "ss" iterators, are governed by a "check policy". The policy of a given container type is carried by its
+"state mutex" template parameter, which its iterators already share. A state mutex of the form
+TCheckPolicyStateMutex<_TCheckPolicy, _TStateMutex> specifies the policy _TCheckPolicy, while any other state mutex
+indicates the default policy. Because the policy is part of the type (rather than being selected by a global macro),
+different containers in the same program can use different policies. Containers that differ only in their policy are
+convertible to each other.
+
+The policies only apply to the bounds checks of the element access operators (operator[] and the iterators'
+dereference operators) and the validity checks of iterator arithmetic and comparison. The at() member functions, and
+the containers' structural safety mechanisms (like gnii_vector<>'s structure change lock), are unaffected and always on.
+
+The policies in the mse::check_policy namespace (full and bounds_only) still catch every out-of-range element access.
+The policies that skip element access checks (none_but_structural and debug_only) can result in undefined behavior (just
+as with the standard containers) when an invalid access isn't validated, so, per the library's convention for unsafe
+elements, they reside in the mse::us::check_policy namespace. They're intended for (hot) code that has already been
+extensively tested with full checking.
+
+(There is intentionally no "sampled" policy that validates only some fraction of the accesses. The per-access sampling
+decision costs at least as much as the simple bounds checks it would be skipping.) */
+
+#pragma once
+#ifndef MSECHECKPOLICY_H_
+#define MSECHECKPOLICY_H_
+
+#include <type_traits>
+
+namespace mse {
+	namespace check_policy {
+		/* All checks are performed. */
+		class full {
+		public:
+			static bool element_access_checks() { return true; }
+			static bool iterator_checks() { return true; }
+		};
+		/* Element accesses are bounds checked, but iterator arithmetic and comparisons are not validated. Since the
+		iterators' dereference operators remain checked, an invalid iterator position is still caught when used. */
+		class bounds_only {
+		public:
+			static bool element_access_checks() { return true; }
+			static bool iterator_checks() { return false; }
+		};
+
+		typedef full default_policy;
+	}
+
+	namespace us {
+		namespace check_policy {
+			/* Only the structural safety mechanisms remain. Invalid element accesses result in undefined behavior. */
+			class none_but_structural {
+			public:
+				static bool element_access_checks() { return false; }
+				static bool iterator_checks() { return false; }
+			};
+			/* Full checking in debug builds (i.e. when NDEBUG is not defined), none_but_structural otherwise. */
+			class debug_only : public
+#ifndef NDEBUG
+				mse::check_policy::full
+#else // !NDEBUG
+				none_but_structural
+#endif // !NDEBUG
+			{};
+		}
+	}
+
+	/* A state mutex (the last template parameter of the nii containers) that specifies the check policy of the container
+	(and its iterators). */
+	template<class _TCheckPolicy, class _TStateMutex>
+	class TCheckPolicyStateMutex : public _TStateMutex {
+	public:
+		typedef _TCheckPolicy check_policy_type;
+	};
+
+	namespace impl {
+		template<class _TStateMutex, class = void>
+		struct check_policy_of {
+			typedef mse::check_policy::default_policy type;
+		};
+		template<class _TStateMutex>
+		struct check_policy_of<_TStateMutex, typename std::conditional<true, void, typename _TStateMutex::check_policy_type>::type> {
+			typedef typename _TStateMutex::check_policy_type type;
+		};
+
+		/* The given state mutex with any TCheckPolicyStateMutex<> wrappers removed. */
+		template<class _TStateMutex>
+		struct state_mutex_sans_check_policy {
+			typedef _TStateMutex type;
+		};
+		template<class _TCheckPolicy, class _TStateMutex>
+		struct state_mutex_sans_check_policy<mse::TCheckPolicyStateMutex<_TCheckPolicy, _TStateMutex> > {
+			typedef typename state_mutex_sans_check_policy<_TStateMutex>::type type;
+		};
+		/* Indicates whether the given (distinct) state mutexes differ only in the check policy they specify. */
+		template<class _TStateMutex1, class _TStateMutex2>
+		struct differ_only_by_check_policy : std::integral_constant<bool, (!std::is_same<_TStateMutex1, _TStateMutex2>::value)
+			&& std::is_same<typename state_mutex_sans_check_policy<_TStateMutex1>::type, typename state_mutex_sans_check_policy<_TStateMutex2>::type>::value> {};
+	}
+}
+
+#endif // MSECHECKPOLICY_H_
@@ -622,6 +622,7 @@ namespace mse {
 
 		/* todo: make these private */
 		void register_pointer(const mse::us::impl::CCRegisteredNode& node_cref) const {
+			MSE_STATS_INCREMENT(registered_link);
 			if (m_head_ptr) {
 				m_head_ptr->set_prev_next_ptr_ptr(node_cref.get_address_of_my_next_ptr());
 			}
@@ -630,6 +631,7 @@ namespace mse {
 			m_head_ptr = &node_cref;
 		}
 		static void unregister_pointer(const mse::us::impl::CCRegisteredNode& node_cref) {
+			MSE_STATS_INCREMENT(registered_unlink);
 			assert(node_cref.get_prev_next_ptr_ptr());
 			(*(node_cref.get_prev_next_ptr_ptr())) = node_cref.get_next_ptr();
 			if (node_cref.get_next_ptr()) {
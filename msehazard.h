@@ -0,0 +1,548 @@
+// Copyright (c) 2015 Noah Lopez
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+/* THazardPointers are thread-safe "norad" pointers. That is, the destruction of an object while a hazard pointer is
+still targeting it results in program termination. But where a thread-safe norad pointer (like the ones used by
+TStaticImmutableObj<> when runtime checks are enabled) maintains an atomic reference count in the target object, which
+must be modified by any thread that copies or destroys a pointer to it, hazard pointers register themselves in
+(counted) slots belonging to the thread copying the pointer. Only the target object's destructor has to visit (the slots
+of) every thread. So when many threads are copying pointers to the same (say, immutable) object, the threads aren't
+contending for (and bouncing between processor caches) the same cache line.
+
+Pointer copies made on the thread that "owns" the source pointer's slot just increment that slot's count. Pointer
+copies made on any other thread take a slot belonging to the copying thread. A pointer may be destroyed on a different
+thread than the one it was copied on (in which case it decrements the slot of the original thread).
+
+The destructor's scan of the slots isn't atomic with respect to the registration of new pointers. For example, a pointer
+could be copied into a slot that has already been scanned, and its source (registered in a slot not yet scanned)
+destroyed before the scan reaches it. So every registration of a pointer in a (previously unused) slot also increments
+a "registration count" kept in the registering thread's own record, and the destructor repeats its scan until the
+(total of the) records' registration counts is unchanged over the duration of a scan. Since each record's count is only
+written by the thread that owns the record, registrations by different threads don't contend for a shared cache line. */
+
+#pragma once
+#ifndef MSEHAZARD_H_
+#define MSEHAZARD_H_
+
+#include "msepointerbasics.h"
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <cassert>
+#include <exception>
+#include <memory>
+#include <new>
+
+#if defined(MSE_SAFER_SUBSTITUTES_DISABLED) || defined(MSE_SAFERPTR_DISABLED)
+#define MSE_HAZARDPOINTER_DISABLED
+#endif /*defined(MSE_SAFER_SUBSTITUTES_DISABLED) || defined(MSE_SAFERPTR_DISABLED)*/
+
+#ifdef _MSC_VER
+#pragma warning( push )
+#pragma warning( disable : 4100 4456 4189 )
+#endif /*_MSC_VER*/
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-function"
+#else /*__clang__*/
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#endif /*__GNUC__*/
+#endif /*__clang__*/
+
+#ifdef MSE_CUSTOM_THROW_DEFINITION
+#include <iostream>
+#define MSE_THROW(x) MSE_CUSTOM_THROW_DEFINITION(x)
+#else // MSE_CUSTOM_THROW_DEFINITION
+#define MSE_THROW(x) throw(x)
+#endif // MSE_CUSTOM_THROW_DEFINITION
+
+#ifndef _NOEXCEPT
+#define _NOEXCEPT
+#endif /*_NOEXCEPT*/
+
+namespace mse {
+
+#ifdef MSE_HAZARDPOINTER_DISABLED
+
+	template<typename _Ty> using THazardPointer = _Ty * ;
+	template<typename _Ty> using THazardConstPointer = const _Ty*;
+	template<typename _Ty> using THazardFixedPointer = _Ty * /*const*/;
+	template<typename _Ty> using THazardFixedConstPointer = const _Ty* /*const*/;
+	template<typename _TROFLy> using THazardObj = _TROFLy;
+
+#else /*MSE_HAZARDPOINTER_DISABLED*/
+
+	template<typename _Ty> class THazardObj;
+	template<typename _Ty> class THazardPointer;
+	template<typename _Ty> class THazardConstPointer;
+	template<typename _Ty> class THazardFixedPointer;
+	template<typename _Ty> class THazardFixedConstPointer;
+
+	namespace impl {
+		namespace ns_hazard {
+			class CHazardRecord;
+
+			/* A slot holds the address of a target object and the number of pointers (registered in the slot) targeting it.
+			Only the thread that owns the slot's record ever changes the slot's target or increments its count from zero. */
+			class CHazardSlot {
+			public:
+				std::atomic<const void*> m_target_ptr{ nullptr };
+				std::atomic<size_t> m_count{ 0 };
+				CHazardRecord* m_record_ptr = nullptr;
+			};
+
+			static const size_t sc_slots_per_record = 6;
+			static const size_t sc_cache_line_size = 64;
+
+			/* Records are cache line aligned so that a thread's slots don't share a cache line with another thread's. (Since,
+			prior to C++17, operator new doesn't honor over-alignment, records are allocated via allocate_record().) */
+			class alignas(sc_cache_line_size) CHazardRecord {
+			public:
+				CHazardRecord() {
+					for (auto& slot : m_slots) {
+						slot.m_record_ptr = this;
+					}
+				}
+
+				CHazardSlot m_slots[sc_slots_per_record];
+				/* Identifies the thread that currently owns this record (or is null). */
+				std::atomic<const void*> m_owner_token{ nullptr };
+				/* The list of all the records. Records are never deallocated. */
+				CHazardRecord* m_next_ptr = nullptr;
+				/* The list of records owned by the same thread. Only accessed by the owning thread. */
+				CHazardRecord* m_next_owned_ptr = nullptr;
+				/* The number of (new) slot registrations made in this record. Only modified by the owning thread. */
+				std::atomic<size_t> m_registration_count{ 0 };
+			};
+
+			/* Records are never deallocated, so the (unaligned) address of the allocation needn't be retained. */
+			inline CHazardRecord* allocate_record() {
+				size_t space = sizeof(CHazardRecord) + alignof(CHazardRecord);
+				void* storage_ptr = ::operator new(space);
+				void* aligned_ptr = std::align(alignof(CHazardRecord), sizeof(CHazardRecord), storage_ptr, space);
+				assert(aligned_ptr);
+				return ::new (aligned_ptr) CHazardRecord();
+			}
+
+			class CHazardRecordRegistry {
+			public:
+				constexpr CHazardRecordRegistry() {}
+
+				CHazardRecord* claim_record(const void* owner_token) {
+					for (auto record_ptr = m_head_ptr.load(std::memory_order_acquire); record_ptr; record_ptr = record_ptr->m_next_ptr) {
+						const void* expected = nullptr;
+						if ((nullptr == record_ptr->m_owner_token.load(std::memory_order_relaxed))
+							&& record_ptr->m_owner_token.compare_exchange_strong(expected, owner_token, std::memory_order_acq_rel)) {
+							record_ptr->m_next_owned_ptr = nullptr;
+							return record_ptr;
+						}
+					}
+					auto record_ptr = allocate_record();
+					record_ptr->m_owner_token.store(owner_token, std::memory_order_relaxed);
+					auto head_ptr = m_head_ptr.load(std::memory_order_relaxed);
+					do {
+						record_ptr->m_next_ptr = head_ptr;
+					} while (!m_head_ptr.compare_exchange_weak(head_ptr, record_ptr, std::memory_order_release, std::memory_order_relaxed));
+					return record_ptr;
+				}
+				void release_record(CHazardRecord* record_ptr) {
+					record_ptr->m_owner_token.store(nullptr, std::memory_order_release);
+				}
+
+				/* Returns whether any (counted) slot of any thread refers to the given target. */
+				bool is_targeted(const void* target_ptr) const {
+					auto registration_count = total_registration_count();
+					while (true) {
+						for (auto record_ptr = m_head_ptr.load(std::memory_order_acquire); record_ptr; record_ptr = record_ptr->m_next_ptr) {
+							for (const auto& slot : record_ptr->m_slots) {
+								if ((0 != slot.m_count.load(std::memory_order_acquire)) && (target_ptr == slot.m_target_ptr.load(std::memory_order_relaxed))) {
+									return true;
+								}
+							}
+						}
+						/* If no new slot registrations occurred during the scan, then no pointer could have moved from a slot
+						not yet scanned to one already scanned. Otherwise we scan again. */
+						const auto registration_count2 = total_registration_count();
+						if (registration_count2 == registration_count) {
+							return false;
+						}
+						registration_count = registration_count2;
+					}
+				}
+
+			private:
+				/* The records' registration counts only ever increase, so their total is unchanged only if none of them
+				changed. (Records added in the meantime start at zero, so they only contribute a change if they've had a
+				registration.) */
+				size_t total_registration_count() const {
+					size_t total = 0;
+					for (auto record_ptr = m_head_ptr.load(std::memory_order_acquire); record_ptr; record_ptr = record_ptr->m_next_ptr) {
+						total += record_ptr->m_registration_count.load();
+					}
+					return total;
+				}
+
+				std::atomic<CHazardRecord*> m_head_ptr{ nullptr };
+			};
+
+			/* The registry has a constexpr constructor and a trivial destructor, so it is constant initialized and remains
+			valid during the destruction of objects of static duration. */
+			inline CHazardRecordRegistry& registry_ref() {
+				static CHazardRecordRegistry s_registry;
+				return s_registry;
+			}
+
+			inline CHazardRecord*& tl_first_owned_record_ptr_ref() {
+				thread_local CHazardRecord* tl_first_owned_record_ptr = nullptr;
+				return tl_first_owned_record_ptr;
+			}
+			/* The (per thread) address of the thread local first owned record pointer serves as the thread's owner token. */
+			inline const void* this_thread_owner_token() {
+				return static_cast<const void*>(&tl_first_owned_record_ptr_ref());
+			}
+
+			/* Returns the thread's records to the registry when the thread exits. */
+			class CThreadRecordsReleaser {
+			public:
+				~CThreadRecordsReleaser() {
+					auto& first_ptr_ref = tl_first_owned_record_ptr_ref();
+					for (auto record_ptr = first_ptr_ref; record_ptr;) {
+						auto next_ptr = record_ptr->m_next_owned_ptr;
+						registry_ref().release_record(record_ptr);
+						record_ptr = next_ptr;
+					}
+					first_ptr_ref = nullptr;
+					tl_released_ref() = true;
+				}
+				static bool& tl_released_ref() {
+					thread_local bool tl_released = false;
+					return tl_released;
+				}
+			};
+
+			inline CHazardRecord* claim_record_for_this_thread() {
+				auto& first_ptr_ref = tl_first_owned_record_ptr_ref();
+				if ((!first_ptr_ref) && (!CThreadRecordsReleaser::tl_released_ref())) {
+					/* Records claimed after the releaser has run (i.e. during the destruction of thread local objects)
+					simply remain owned. */
+					thread_local CThreadRecordsReleaser tl_releaser;
+					(void)tl_releaser;
+				}
+				auto record_ptr = registry_ref().claim_record(this_thread_owner_token());
+				record_ptr->m_next_owned_ptr = first_ptr_ref;
+				first_ptr_ref = record_ptr;
+				return record_ptr;
+			}
+
+			/* Registers a (new) pointer to the given target in a slot owned by this thread. */
+			inline CHazardSlot* register_target(const void* target_ptr) {
+				CHazardSlot* free_slot_ptr = nullptr;
+				for (auto record_ptr = tl_first_owned_record_ptr_ref(); record_ptr; record_ptr = record_ptr->m_next_owned_ptr) {
+					for (auto& slot : record_ptr->m_slots) {
+						auto count = slot.m_count.load(std::memory_order_relaxed);
+						if ((0 != count) && (target_ptr == slot.m_target_ptr.load(std::memory_order_relaxed))) {
+							/* A slot is only reused while its count remains non-zero, as another thread (that a pointer
+							registered in the slot was moved to) may concurrently unregister the slot's last pointer. A slot
+							whose count goes from zero to one has to be (re)registered as new (below), so that the target's
+							destructor won't miss it. See is_targeted(). */
+							while (0 != count) {
+								if (slot.m_count.compare_exchange_weak(count, count + 1, std::memory_order_relaxed)) {
+									return &slot;
+								}
+							}
+						}
+						if ((0 == count) && (!free_slot_ptr)) {
+							free_slot_ptr = &slot;
+						}
+					}
+				}
+				while (!free_slot_ptr) {
+					/* A newly claimed (previously released) record may still have slots in use by pointers that were
+					moved to (and outlived) other threads. */
+					auto record_ptr = claim_record_for_this_thread();
+					for (auto& slot : record_ptr->m_slots) {
+						if (0 == slot.m_count.load(std::memory_order_relaxed)) {
+							free_slot_ptr = &slot;
+							break;
+						}
+					}
+				}
+				free_slot_ptr->m_target_ptr.store(target_ptr, std::memory_order_relaxed);
+				free_slot_ptr->m_count.store(1, std::memory_order_release);
+				/* This (sequentially consistent) increment also serves as the store-load fence that ensures that a target's
+				destructor, if it doesn't observe the new registration in its scan, observes the changed registration count
+				(by the time it observes the unregistration of the new pointer's source). See is_targeted(). It's made on the
+				(thread owned) record of the slot, so it doesn't contend with other threads. */
+				free_slot_ptr->m_record_ptr->m_registration_count.fetch_add(1);
+				return free_slot_ptr;
+			}
+			/* Registers a copy of a pointer registered in the given slot. If the slot is owned by this thread, this just
+			increments the slot's count. Otherwise the copy is registered in a slot owned by this thread. */
+			inline CHazardSlot* register_copy(CHazardSlot* src_slot_ptr) {
+				if (!src_slot_ptr) {
+					return nullptr;
+				}
+				if (this_thread_owner_token() == src_slot_ptr->m_record_ptr->m_owner_token.load(std::memory_order_relaxed)) {
+					src_slot_ptr->m_count.fetch_add(1, std::memory_order_relaxed);
+					return src_slot_ptr;
+				}
+				return register_target(src_slot_ptr->m_target_ptr.load(std::memory_order_relaxed));
+			}
+			inline void unregister(CHazardSlot* slot_ptr) {
+				if (slot_ptr) {
+					slot_ptr->m_count.fetch_sub(1, std::memory_order_release);
+				}
+			}
+		}
+	}
+
+	/* THazardPointer<> is a thread-safe pointer that (like TNoradPointer<>) causes program termination if its target
+	is destroyed while the pointer is still targeting it. See the comment at the top of this file. */
+	template<typename _Ty>
+	class THazardPointer : public mse::us::impl::StrongPointerTagBase {
+	public:
+		THazardPointer() {}
+		THazardPointer(std::nullptr_t) {}
+		THazardPointer(const THazardPointer& src_cref) : m_ptr(src_cref.m_ptr), m_slot_ptr(mse::impl::ns_hazard::register_copy(src_cref.m_slot_ptr)) {}
+		template<class _Ty2, class = typename std::enable_if<std::is_convertible<_Ty2 *, _Ty *>::value, void>::type>
+		THazardPointer(const THazardPointer<_Ty2>& src_cref) : m_ptr(src_cref.m_ptr), m_slot_ptr(mse::impl::ns_hazard::register_copy(src_cref.m_slot_ptr)) {}
+		THazardPointer(THazardPointer&& src_ref) : m_ptr(src_ref.m_ptr), m_slot_ptr(src_ref.m_slot_ptr) {
+			src_ref.m_ptr = nullptr;
+			src_ref.m_slot_ptr = nullptr;
+		}
+		virtual ~THazardPointer() {
+			mse::impl::ns_hazard::unregister(m_slot_ptr);
+		}
+		THazardPointer& operator=(const THazardPointer& _Right_cref) {
+			auto slot_ptr = mse::impl::ns_hazard::register_copy(_Right_cref.m_slot_ptr);
+			mse::impl::ns_hazard::unregister(m_slot_ptr);
+			m_ptr = _Right_cref.m_ptr;
+			m_slot_ptr = slot_ptr;
+			return (*this);
+		}
+		THazardPointer& operator=(THazardPointer&& _Right_ref) {
+			std::swap(m_ptr, _Right_ref.m_ptr);
+			std::swap(m_slot_ptr, _Right_ref.m_slot_ptr);
+			return (*this);
+		}
+		template<class _Ty2, class = typename std::enable_if<std::is_convertible<_Ty2 *, _Ty *>::value, void>::type>
+		THazardPointer& operator=(const THazardPointer<_Ty2>& _Right_cref) {
+			return (*this).operator=(THazardPointer(_Right_cref));
+		}
+
+		THazardObj<_Ty>& operator*() const {
+			if (!m_ptr) { MSE_THROW(primitives_null_dereference_error("attempt to dereference null pointer - mse::THazardPointer")); }
+			return *m_ptr;
+		}
+		THazardObj<_Ty>* operator->() const {
+			if (!m_ptr) { MSE_THROW(primitives_null_dereference_error("attempt to dereference null pointer - mse::THazardPointer")); }
+			return m_ptr;
+		}
+
+		operator bool() const { return !(!m_ptr); }
+		/* This native pointer cast operator is just for compatibility with existing/legacy code and ideally should never be used. */
+		explicit operator _Ty*() const {
+			return m_ptr;
+		}
+
+		/* A hazard pointer may be shared or passed among threads if its target type is safely shareable. */
+		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value)
+			&& (mse::impl::is_marked_as_shareable_msemsearray<_Ty2>::value), void>::type>
+		void async_shareable_and_passable_tag() const {}
+
+	private:
+		THazardPointer(THazardObj<_Ty>* ptr) : m_ptr(ptr), m_slot_ptr(mse::impl::ns_hazard::register_target(static_cast<const void*>(ptr))) {}
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		THazardObj<_Ty>* m_ptr = nullptr;
+		mse::impl::ns_hazard::CHazardSlot* m_slot_ptr = nullptr;
+
+		template<typename _Ty2> friend class THazardPointer;
+		template<typename _Ty2> friend class THazardConstPointer;
+		friend class THazardFixedPointer<_Ty>;
+		friend class THazardObj<_Ty>;
+	};
+
+	template<typename _Ty>
+	class THazardConstPointer : public mse::us::impl::StrongPointerTagBase {
+	public:
+		THazardConstPointer() {}
+		THazardConstPointer(std::nullptr_t) {}
+		THazardConstPointer(const THazardConstPointer& src_cref) : m_ptr(src_cref.m_ptr), m_slot_ptr(mse::impl::ns_hazard::register_copy(src_cref.m_slot_ptr)) {}
+		template<class _Ty2, class = typename std::enable_if<std::is_convertible<_Ty2 *, _Ty *>::value, void>::type>
+		THazardConstPointer(const THazardConstPointer<_Ty2>& src_cref) : m_ptr(src_cref.m_ptr), m_slot_ptr(mse::impl::ns_hazard::register_copy(src_cref.m_slot_ptr)) {}
+		THazardConstPointer(const THazardPointer<_Ty>& src_cref) : m_ptr(src_cref.m_ptr), m_slot_ptr(mse::impl::ns_hazard::register_copy(src_cref.m_slot_ptr)) {}
+		template<class _Ty2, class = typename std::enable_if<std::is_convertible<_Ty2 *, _Ty *>::value, void>::type>
+		THazardConstPointer(const THazardPointer<_Ty2>& src_cref) : m_ptr(src_cref.m_ptr), m_slot_ptr(mse::impl::ns_hazard::register_copy(src_cref.m_slot_ptr)) {}
+		THazardConstPointer(THazardConstPointer&& src_ref) : m_ptr(src_ref.m_ptr), m_slot_ptr(src_ref.m_slot_ptr) {
+			src_ref.m_ptr = nullptr;
+			src_ref.m_slot_ptr = nullptr;
+		}
+		virtual ~THazardConstPointer() {
+			mse::impl::ns_hazard::unregister(m_slot_ptr);
+		}
+		THazardConstPointer& operator=(const THazardConstPointer& _Right_cref) {
+			auto slot_ptr = mse::impl::ns_hazard::register_copy(_Right_cref.m_slot_ptr);
+			mse::impl::ns_hazard::unregister(m_slot_ptr);
+			m_ptr = _Right_cref.m_ptr;
+			m_slot_ptr = slot_ptr;
+			return (*this);
+		}
+		THazardConstPointer& operator=(THazardConstPointer&& _Right_ref) {
+			std::swap(m_ptr, _Right_ref.m_ptr);
+			std::swap(m_slot_ptr, _Right_ref.m_slot_ptr);
+			return (*this);
+		}
+		template<class _Ty2, class = typename std::enable_if<std::is_convertible<_Ty2 *, _Ty *>::value, void>::type>
+		THazardConstPointer& operator=(const THazardConstPointer<_Ty2>& _Right_cref) {
+			return (*this).operator=(THazardConstPointer(_Right_cref));
+		}
+
+		const THazardObj<_Ty>& operator*() const {
+			if (!m_ptr) { MSE_THROW(primitives_null_dereference_error("attempt to dereference null pointer - mse::THazardConstPointer")); }
+			return *m_ptr;
+		}
+		const THazardObj<_Ty>* operator->() const {
+			if (!m_ptr) { MSE_THROW(primitives_null_dereference_error("attempt to dereference null pointer - mse::THazardConstPointer")); }
+			return m_ptr;
+		}
+
+		operator bool() const { return !(!m_ptr); }
+		/* This native pointer cast operator is just for compatibility with existing/legacy code and ideally should never be used. */
+		explicit operator const _Ty*() const {
+			return m_ptr;
+		}
+
+		/* A hazard pointer may be shared or passed among threads if its target type is safely shareable. */
+		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value)
+			&& (mse::impl::is_marked_as_shareable_msemsearray<_Ty2>::value), void>::type>
+		void async_shareable_and_passable_tag() const {}
+
+	private:
+		THazardConstPointer(const THazardObj<_Ty>* ptr) : m_ptr(ptr), m_slot_ptr(mse::impl::ns_hazard::register_target(static_cast<const void*>(ptr))) {}
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		const THazardObj<_Ty>* m_ptr = nullptr;
+		mse::impl::ns_hazard::CHazardSlot* m_slot_ptr = nullptr;
+
+		template<typename _Ty2> friend class THazardConstPointer;
+		friend class THazardFixedConstPointer<_Ty>;
+		friend class THazardObj<_Ty>;
+	};
+
+	/* THazardFixedPointer<> is a THazardPointer<> that can only be obtained from (the "&" operator of) a THazardObj<>
+	(or another fixed pointer), and so is never null, and can't be retargeted. */
+	template<typename _Ty>
+	class THazardFixedPointer : public THazardPointer<_Ty> {
+	public:
+		typedef THazardPointer<_Ty> base_class;
+		THazardFixedPointer(const THazardFixedPointer& src_cref) : base_class(src_cref) {}
+		template<class _Ty2, class = typename std::enable_if<std::is_convertible<_Ty2 *, _Ty *>::value, void>::type>
+		THazardFixedPointer(const THazardFixedPointer<_Ty2>& src_cref) : base_class(src_cref) {}
+		virtual ~THazardFixedPointer() {}
+
+		/* This native pointer cast operator is just for compatibility with existing/legacy code and ideally should never be used. */
+		explicit operator _Ty*() const { return base_class::operator _Ty*(); }
+
+	private:
+		THazardFixedPointer(THazardObj<_Ty>* ptr) : base_class(ptr) {}
+		THazardFixedPointer& operator=(const THazardFixedPointer& _Right_cref) = delete;
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		friend class THazardObj<_Ty>;
+	};
+
+	template<typename _Ty>
+	class THazardFixedConstPointer : public THazardConstPointer<_Ty> {
+	public:
+		typedef THazardConstPointer<_Ty> base_class;
+		THazardFixedConstPointer(const THazardFixedConstPointer& src_cref) : base_class(src_cref) {}
+		template<class _Ty2, class = typename std::enable_if<std::is_convertible<_Ty2 *, _Ty *>::value, void>::type>
+		THazardFixedConstPointer(const THazardFixedConstPointer<_Ty2>& src_cref) : base_class(src_cref) {}
+		THazardFixedConstPointer(const THazardFixedPointer<_Ty>& src_cref) : base_class(src_cref) {}
+		template<class _Ty2, class = typename std::enable_if<std::is_convertible<_Ty2 *, _Ty *>::value, void>::type>
+		THazardFixedConstPointer(const THazardFixedPointer<_Ty2>& src_cref) : base_class(src_cref) {}
+		virtual ~THazardFixedConstPointer() {}
+
+		/* This native pointer cast operator is just for compatibility with existing/legacy code and ideally should never be used. */
+		explicit operator const _Ty*() const { return base_class::operator const _Ty*(); }
+
+	private:
+		THazardFixedConstPointer(const THazardObj<_Ty>* ptr) : base_class(ptr) {}
+		THazardFixedConstPointer& operator=(const THazardFixedConstPointer& _Right_cref) = delete;
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		friend class THazardObj<_Ty>;
+	};
+
+	/* THazardObj is intended as a transparent wrapper for other classes/objects. Its destructor verifies that no hazard
+	pointers targeting the object remain. */
+	template<typename _TROFLy>
+	class THazardObj : public _TROFLy {
+	public:
+		typedef _TROFLy base_class;
+
+		MSE_USING(THazardObj, _TROFLy);
+		THazardObj(const THazardObj& _X) : _TROFLy(_X) {}
+		THazardObj(THazardObj&& _X) : _TROFLy(std::forward<decltype(_X)>(_X)) {}
+		virtual ~THazardObj() {
+			if (mse::impl::ns_hazard::registry_ref().is_targeted(static_cast<const void*>(this))) {
+				/* It would be unsafe to allow this object to be destroyed as there are outstanding references to this object. */
+				std::cerr << "\n\nFatal Error: mse::THazardObj<> destructed with outstanding references \n\n";
+				assert(false); std::terminate();
+			}
+		}
+
+		template<class _Ty2>
+		THazardObj& operator=(_Ty2&& _X) { _TROFLy::operator=(std::forward<decltype(_X)>(_X)); return (*this); }
+		template<class _Ty2>
+		THazardObj& operator=(const _Ty2& _X) { _TROFLy::operator=(_X); return (*this); }
+
+		THazardFixedPointer<_TROFLy> operator&() {
+			return THazardFixedPointer<_TROFLy>(this);
+		}
+		THazardFixedConstPointer<_TROFLy> operator&() const {
+			return THazardFixedConstPointer<_TROFLy>(this);
+		}
+		THazardFixedPointer<_TROFLy> mse_hazard_fptr() { return THazardFixedPointer<_TROFLy>(this); }
+		THazardFixedConstPointer<_TROFLy> mse_hazard_fptr() const { return THazardFixedConstPointer<_TROFLy>(this); }
+
+		/* The (thread-safe) hazard pointer mechanism doesn't affect whether the object can be shared or passed among threads. */
+		template<class _Ty2 = _TROFLy, class = typename std::enable_if<(std::is_same<_Ty2, _TROFLy>::value)
+			&& (mse::impl::is_marked_as_shareable_msemsearray<_Ty2>::value), void>::type>
+		void async_shareable_tag() const {}
+		template<class _Ty2 = _TROFLy, class = typename std::enable_if<(std::is_same<_Ty2, _TROFLy>::value)
+			&& (mse::impl::is_marked_as_passable_msemsearray<_Ty2>::value), void>::type>
+		void async_passable_tag() const {}
+	};
+
+#endif /*MSE_HAZARDPOINTER_DISABLED*/
+
+}
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#else /*__clang__*/
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif /*__GNUC__*/
+#endif /*__clang__*/
+
+#ifdef _MSC_VER
+#pragma warning( pop )
+#endif /*_MSC_VER*/
+
+#undef MSE_THROW
+
+#endif // MSEHAZARD_H_
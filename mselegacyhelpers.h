@@ -15,6 +15,20 @@
 #ifndef MSE_LEGACYHELPERS_DISABLED
 #include "msepoly.h"
 #include <cstring>
+#include <algorithm>
+#include <functional>
+#include <vector>
+#include <string>
+#include <system_error>
+#include <cerrno>
+#include <limits>
+#if (defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__))) && !defined(MSE_LH_DISABLE_MMAP)
+#define MSE_LH_HAS_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif // (defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__))) && !defined(MSE_LH_DISABLE_MMAP)
 #else // !MSE_LEGACYHELPERS_DISABLED
 #include <stdlib.h>
 #include <stdio.h>
@@ -98,7 +112,7 @@ namespace mse {
 
 			TIPointerWithBundledVector() : TVectorRefcfptrWrapper<_Ty>(mse::make_refcounting<mse::us::msevector<_Ty>>())
 				, ipointer_base_class(*vector_refcptr()) {}
-			TIPointerWithBundledVector(const std::nullptr_t& src) : TIPointerWithBundledVector() {}
+			TIPointerWithBundledVector(const std::nullptr_t&) : TIPointerWithBundledVector() {}
 			TIPointerWithBundledVector(const TIPointerWithBundledVector& src) : TVectorRefcfptrWrapper<_Ty>(src.vector_refcptr())
 				, ipointer_base_class(*vector_refcptr()) {
 				ipointer_base_class::operator=(src);
@@ -118,15 +132,26 @@ namespace mse {
 			size_type size() const {
 				return (*vector_refcptr()).size();
 			}
+			/* Like realloc(), this leaves the pointer pointing to the beginning of the (resized) array. Rather than
+			allocating exactly the requested size each time, the capacity is grown geometrically (and only reduced when
+			the size drops well below it), so that C code that grows a buffer one element or chunk at a time via
+			realloc() doesn't end up reallocating (and copying) the whole buffer on every call. */
 			void resize(size_type _N, const _Ty& _X = _Ty()) {
-				auto old_size = size();
-
-				(*vector_refcptr()).resize(_N, _X);
-				(*vector_refcptr()).shrink_to_fit();
+				auto& vector_ref = (*vector_refcptr());
+				const auto old_capacity = size_type(vector_ref.capacity());
+				if (_N > old_capacity) {
+					vector_ref.reserve((std::max)(_N, 2 * old_capacity));
+				}
 
-				if (true || (0 == old_size)) {
-					(*this).set_to_beginning();
+				vector_ref.resize(_N, _X);
+				if (_N < size_type(vector_ref.capacity()) / 4) {
+					vector_ref.shrink_to_fit();
 				}
+
+				(*this).set_to_beginning();
+			}
+			size_type capacity() const {
+				return (*vector_refcptr()).capacity();
 			}
 
 			bool operator==(const std::nullptr_t& _Right_cref) const { return (0 == size()); }
@@ -267,39 +292,166 @@ namespace mse {
 		template<class _Ty>
 		class CFileF<mse::TNullableAnyRandomAccessIterator<_Ty>> {
 		public:
+			/* When the target is known to be in contiguous storage (and _Ty is trivially copyable), the bounds are checked
+			once up front and the data is read/written directly from/to the target. Otherwise the data goes through a
+			(per-call) intermediate buffer and is transferred element by element via the (bounds checked) iterator. */
 			static size_t fread(mse::TNullableAnyRandomAccessIterator<_Ty> ptr, size_t size, size_t count, FILE * stream) {
-				static std::vector<unsigned char> v;
-				v.resize(size * count);
-				auto num_bytes_read = ::fread(v.data(), size, count, stream);
-				auto num_items_read = num_bytes_read / sizeof(_Ty);
+				typedef typename std::remove_const<_Ty>::type non_const_Ty;
+				const auto num_bytes_requested = checked_num_bytes(size, count);
+				const auto span = direct_transfer_span(ptr, std::is_trivially_copyable<_Ty>());
+				if (span.first) {
+					if (num_bytes_requested > span.second * sizeof(_Ty)) {
+						MSE_THROW(std::out_of_range("out of bounds - fread() - CFileF<TNullableAnyRandomAccessIterator<>>"));
+					}
+					return ::fread(span.first, size, count, stream);
+				}
+				std::vector<unsigned char> v(num_bytes_requested);
+				auto num_elements_read = ::fread(v.data(), size, count, stream);
+				auto num_items_read = num_elements_read * size / sizeof(_Ty);
 				size_t uc_index = 0;
 				size_t Ty_index = 0;
 				for (; Ty_index < num_items_read; uc_index += sizeof(_Ty), Ty_index += 1) {
-					unsigned char* uc_ptr = &(v[uc_index]);
-					_Ty* Ty_ptr = reinterpret_cast<_Ty*>(uc_ptr);
-					ptr[Ty_index] = (*Ty_ptr);
+					/* The bytes are copied into (suitably aligned) raw storage rather than into a constructed _Ty, so
+					that _Ty isn't required to be default constructible. */
+					alignas(non_const_Ty) unsigned char item_storage[sizeof(non_const_Ty)];
+					std::memcpy(item_storage, &(v[uc_index]), sizeof(_Ty));
+					ptr[Ty_index] = *reinterpret_cast<const non_const_Ty*>(item_storage);
 				}
-				v.resize(0);
-				return num_bytes_read;
+				return num_elements_read;
 			}
 			static size_t fwrite(mse::TNullableAnyRandomAccessIterator<_Ty> ptr, size_t size, size_t count, FILE * stream) {
 				typedef typename std::remove_const<_Ty>::type non_const_Ty;
-				static std::vector<unsigned char> v;
-				v.resize(size * count);
-				auto num_items_to_write = size * count / sizeof(_Ty);
+				const auto num_bytes_requested = checked_num_bytes(size, count);
+				const auto span = direct_transfer_span(ptr, std::is_trivially_copyable<_Ty>());
+				if (span.first) {
+					if (num_bytes_requested > span.second * sizeof(_Ty)) {
+						MSE_THROW(std::out_of_range("out of bounds - fwrite() - CFileF<TNullableAnyRandomAccessIterator<>>"));
+					}
+					return ::fwrite(span.first, size, count, stream);
+				}
+				std::vector<unsigned char> v(num_bytes_requested);
+				auto num_items_to_write = num_bytes_requested / sizeof(_Ty);
 				size_t uc_index = 0;
 				size_t Ty_index = 0;
 				for (; Ty_index < num_items_to_write; uc_index += sizeof(_Ty), Ty_index += 1) {
-					unsigned char* uc_ptr = &(v[uc_index]);
-					non_const_Ty* Ty_ptr = reinterpret_cast<non_const_Ty*>(uc_ptr);
-					(*Ty_ptr) = ptr[Ty_index];
+					const non_const_Ty item = ptr[Ty_index];
+					std::memcpy(&(v[uc_index]), std::addressof(item), sizeof(_Ty));
+				}
+				return ::fwrite(v.data(), size, count, stream);
+			}
+
+		private:
+			/* A byte count that wrapped around would pass the bounds check and result in a short transfer. */
+			static size_t checked_num_bytes(size_t size, size_t count) {
+				if ((0 != size) && (count > (std::numeric_limits<size_t>::max)() / size)) {
+					MSE_THROW(std::overflow_error("size * count overflows - CFileF<TNullableAnyRandomAccessIterator<>>"));
+				}
+				return size * count;
+			}
+			static std::pair<_Ty*, size_t> direct_transfer_span(const mse::TNullableAnyRandomAccessIterator<_Ty>& ptr, std::true_type) {
+				return contiguous_storage_span(ptr);
+			}
+			static std::pair<_Ty*, size_t> direct_transfer_span(const mse::TNullableAnyRandomAccessIterator<_Ty>& ptr, std::false_type) {
+				return std::pair<_Ty*, size_t>(nullptr, 0);
+			}
+		};
+
+		/* CReadOnlyMappedFile provides read-only access to the contents of a file. Where supported (i.e. on POSIX
+		platforms) the file is memory mapped rather than read in. Its elements are accessed via (bounds checked)
+		operator[], or via a "random access section" (see make_xscope_mapped_file_const_section()). Since sections and
+		iterators obtained from a (scope) pointer to a CReadOnlyMappedFile can't outlive it, they can't outlive the
+		mapping.
+
+		Note that, when the file is memory mapped, the mapping reflects the file as it is on disk. If the file is truncated
+		(by this or another process) while it's mapped, accessing the part of the mapping beyond the new end of the file
+		raises a SIGBUS signal (which, by default, terminates the program), rather than an exception. The bounds checks
+		can't catch this, as they're against the size at the time the file was opened. So the type should only be used
+		with files that aren't modified while they're open. (Defining MSE_LH_DISABLE_MMAP causes the file to be read into
+		memory instead, on all platforms.) */
+		class CReadOnlyMappedFile {
+		public:
+			typedef unsigned char value_type;
+			typedef size_t size_type;
+			typedef std::ptrdiff_t difference_type;
+			typedef const value_type& const_reference;
+			typedef const value_type& reference;
+			typedef const value_type* const_pointer;
+			typedef const value_type* pointer;
+
+			explicit CReadOnlyMappedFile(const char* path) {
+#ifdef MSE_LH_HAS_MMAP
+				int fd = ::open(path, O_RDONLY);
+				if (0 > fd) {
+					MSE_THROW(std::system_error(errno, std::generic_category(), "failed to open file - CReadOnlyMappedFile"));
+				}
+				struct stat file_stat;
+				if (0 != ::fstat(fd, &file_stat)) {
+					const auto err = errno;
+					::close(fd);
+					MSE_THROW(std::system_error(err, std::generic_category(), "failed to stat file - CReadOnlyMappedFile"));
 				}
-				auto res = ::fwrite(v.data(), size, count, stream);
-				v.resize(0);
-				return res;
+				m_size = size_type(file_stat.st_size);
+				if (0 != m_size) {
+					void* addr = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+					if (MAP_FAILED == addr) {
+						const auto err = errno;
+						::close(fd);
+						MSE_THROW(std::system_error(err, std::generic_category(), "failed to map file - CReadOnlyMappedFile"));
+					}
+					m_data = static_cast<const value_type*>(addr);
+				}
+				/* The mapping remains valid after the file descriptor is closed. */
+				::close(fd);
+#else // MSE_LH_HAS_MMAP
+				FILE* stream = ::fopen(path, "rb");
+				if (!stream) {
+					MSE_THROW(std::system_error(errno, std::generic_category(), "failed to open file - CReadOnlyMappedFile"));
+				}
+				unsigned char buffer[4096];
+				size_t num_read = 0;
+				while (0 < (num_read = ::fread(buffer, 1, sizeof(buffer), stream))) {
+					m_buffer.insert(m_buffer.end(), buffer, buffer + num_read);
+				}
+				::fclose(stream);
+				m_size = m_buffer.size();
+				m_data = m_buffer.data();
+#endif // MSE_LH_HAS_MMAP
+			}
+			explicit CReadOnlyMappedFile(const std::string& path) : CReadOnlyMappedFile(path.c_str()) {}
+			CReadOnlyMappedFile(const CReadOnlyMappedFile&) = delete;
+			CReadOnlyMappedFile& operator=(const CReadOnlyMappedFile&) = delete;
+			~CReadOnlyMappedFile() {
+#ifdef MSE_LH_HAS_MMAP
+				if (m_data) {
+					::munmap(const_cast<value_type*>(m_data), m_size);
+				}
+#endif // MSE_LH_HAS_MMAP
 			}
+
+			size_type size() const { return m_size; }
+			bool empty() const { return (0 == m_size); }
+			const_reference operator[](size_type index) const {
+				if (m_size <= index) { MSE_THROW(std::out_of_range("index out of range - CReadOnlyMappedFile")); }
+				return m_data[index];
+			}
+			const_reference at(size_type index) const { return (*this)[index]; }
+			const value_type* data() const { return m_data; }
+
+			void async_not_shareable_and_not_passable_tag() const {}
+
+		private:
+			const value_type* m_data = nullptr;
+			size_type m_size = 0;
+#ifndef MSE_LH_HAS_MMAP
+			std::vector<value_type> m_buffer;
+#endif // !MSE_LH_HAS_MMAP
 		};
 
+		/* Returns a section spanning the (whole) contents of the file. */
+		inline mse::TXScopeAnyRandomAccessConstSection<unsigned char> make_xscope_mapped_file_const_section(const mse::TXScopeItemFixedConstPointer<CReadOnlyMappedFile>& xs_ptr) {
+			return mse::TXScopeAnyRandomAccessConstSection<unsigned char>(mse::make_xscope_random_access_const_section(xs_ptr));
+		}
+
 		template<class _Ty>
 		class CMemF {
 		public:
@@ -319,15 +471,65 @@ namespace mse {
 		template<class _Ty>
 		class CMemF<mse::TNullableAnyRandomAccessIterator<_Ty>> {
 		public:
+			/* When the element type is trivially copyable and both ranges are known to be in contiguous storage, the bounds
+			are checked once up front and the copy is done in bulk (with memmove() semantics, so overlapping ranges are
+			handled). Otherwise the copy is done element by element via the (bounds checked) iterators, as (user defined)
+			assignment operators could, for example, resize the containers out from under any raw pointers to their
+			storage. */
 			static void memcpy(mse::TNullableAnyRandomAccessIterator<_Ty> destination, mse::TNullableAnyRandomAccessIterator<_Ty> source, size_t num_bytes) {
 				auto num_items = num_bytes / sizeof(_Ty);
-				for (size_t i = 0; i < num_items; i += 1) {
-					destination[i] = source[i];
+				if (0 == num_items) {
+					return;
+				}
+				const auto dest_span = contiguous_storage_span(destination);
+				const auto src_span = contiguous_storage_span(source);
+				if (std::is_trivially_copyable<_Ty>::value && dest_span.first && src_span.first) {
+					if ((num_items > dest_span.second) || (num_items > src_span.second)) {
+						MSE_THROW(std::out_of_range("out of bounds - memcpy() - CMemF<TNullableAnyRandomAccessIterator<>>"));
+					}
+					::memmove(static_cast<void*>(dest_span.first), static_cast<const void*>(src_span.first), num_items * sizeof(_Ty));
+					return;
+				}
+				/* If the destination range starts within the source range, the elements are copied back to front (as with
+				memmove()). */
+				const bool back_to_front = dest_span.first && src_span.first && std::less<const _Ty*>()(src_span.first, dest_span.first)
+					&& std::less<const _Ty*>()(dest_span.first, src_span.first + (std::min)(num_items, src_span.second));
+				if (back_to_front) {
+					for (size_t i = num_items; 0 < i; i -= 1) {
+						destination[i - 1] = source[i - 1];
+					}
+				}
+				else {
+					for (size_t i = 0; i < num_items; i += 1) {
+						destination[i] = source[i];
+					}
 				}
 			}
+			/* As with memcpy(), the bulk operation is only used for trivially copyable element types. Element-wise, memset()
+			(in this context) sets each element to _Ty(value). For (non-bool) arithmetic types, that coincides with native
+			::memset() for single byte types, and for any size when the value is zero. */
 			static void memset(mse::TNullableAnyRandomAccessIterator<_Ty> ptr, int value, size_t num_bytes) {
 				auto Ty_value = _Ty(value);
 				auto num_items = num_bytes / sizeof(_Ty);
+				if (0 == num_items) {
+					return;
+				}
+				if (std::is_trivially_copyable<_Ty>::value) {
+					const auto span = contiguous_storage_span(ptr);
+					if (span.first) {
+						if (num_items > span.second) {
+							MSE_THROW(std::out_of_range("out of bounds - memset() - CMemF<TNullableAnyRandomAccessIterator<>>"));
+						}
+						if (std::is_arithmetic<_Ty>::value && (!std::is_same<bool, typename std::remove_cv<_Ty>::type>::value)
+							&& (((1 == sizeof(_Ty)) && std::is_integral<_Ty>::value) || (0 == value))) {
+							::memset(static_cast<void*>(span.first), value, num_items * sizeof(_Ty));
+						}
+						else {
+							std::fill_n(span.first, num_items, Ty_value);
+						}
+						return;
+					}
+				}
 				for (size_t i = 0; i < num_items; i += 1) {
 					ptr[i] = Ty_value;
 				}
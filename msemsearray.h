@@ -908,6 +908,9 @@ namespace mse {
 
 	template<class _Ty, size_t _Size, class _TStateMutex = default_state_mutex>
 	class nii_array;
+	/* An nii_array<> with the given check policy. (See msecheckpolicy.h.) */
+	template<class _Ty, size_t _Size, class _TCheckPolicy>
+	using nii_array_cp = nii_array<_Ty, _Size, mse::TCheckPolicyStateMutex<_TCheckPolicy, default_state_mutex> >;
 
 	namespace us {
 		template<class _Ty, size_t _Size, class _TStateMutex = default_state_mutex>
@@ -1580,6 +1583,7 @@ namespace mse {
 		typedef typename base_class::reference reference;
 		typedef const pointer const_pointer;
 		typedef const reference const_reference;
+		typedef typename mse::impl::check_policy_of<_TStateMutex>::type check_policy_type;
 
 		//template<class = typename std::enable_if<std::is_default_constructible<_TArrayConstPointer>::value, void>::type>
 		template<class _TArrayConstPointer2 = _TArrayConstPointer, class = typename std::enable_if<(std::is_same<_TArrayConstPointer2, _TArrayConstPointer>::value) && (std::is_default_constructible<_TArrayConstPointer>::value), void>::type>
@@ -1631,7 +1635,7 @@ namespace mse {
 			m_index = m_owner_cptr->size();
 		}
 		void set_to_next() {
-			if (points_to_an_item()) {
+			if ((!check_policy_type::iterator_checks()) || points_to_an_item()) {
 				m_index += 1;
 				assert(m_owner_cptr->size() >= m_index);
 			}
@@ -1640,7 +1644,7 @@ namespace mse {
 			}
 		}
 		void set_to_previous() {
-			if (has_previous()) {
+			if ((!check_policy_type::iterator_checks()) || has_previous()) {
 				m_index -= 1;
 			}
 			else {
@@ -1653,7 +1657,7 @@ namespace mse {
 		Tnii_array_ss_const_iterator_type operator--(int) { Tnii_array_ss_const_iterator_type _Tmp = *this; (*this).set_to_previous(); return (_Tmp); }
 		void advance(difference_type n) {
 			auto new_index = msear_int(m_index) + n;
-			if ((0 > new_index) || (m_owner_cptr->size() < msear_size_t(new_index))) {
+			if (check_policy_type::iterator_checks() && ((0 > new_index) || (m_owner_cptr->size() < msear_size_t(new_index)))) {
 				MSE_THROW(nii_array_range_error("index out of range - void advance(difference_type n) - Tnii_array_ss_const_iterator_type - nii_array"));
 			}
 			else {
@@ -1670,30 +1674,30 @@ namespace mse {
 		}
 		Tnii_array_ss_const_iterator_type operator-(difference_type n) const { return ((*this) + (-n)); }
 		difference_type operator-(const Tnii_array_ss_const_iterator_type &rhs) const {
-			if (rhs.m_owner_cptr != (*this).m_owner_cptr) { MSE_THROW(nii_array_range_error("invalid argument - difference_type operator-(const Tnii_array_ss_const_iterator_type &rhs) const - nii_array::Tnii_array_ss_const_iterator_type")); }
+			if (check_policy_type::iterator_checks() && (rhs.m_owner_cptr != (*this).m_owner_cptr)) { MSE_THROW(nii_array_range_error("invalid argument - difference_type operator-(const Tnii_array_ss_const_iterator_type &rhs) const - nii_array::Tnii_array_ss_const_iterator_type")); }
 			auto retval = difference_type((*this).m_index) - difference_type(rhs.m_index);
 			assert(difference_type((*m_owner_cptr).size()) >= retval);
 			return retval;
 		}
 		const_reference operator*() const {
-			return (*m_owner_cptr).at(msear_as_a_size_t((*this).m_index));
+			return (*m_owner_cptr)[msear_as_a_size_t((*this).m_index)];
 		}
 		const_reference item() const { return operator*(); }
 		const_reference previous_item() const {
 			return (*m_owner_cptr).at(msear_as_a_size_t((*this).m_index - 1));
 		}
 		const_pointer operator->() const {
-			return std::addressof((*m_owner_cptr).at(msear_as_a_size_t((*this).m_index)));
+			return std::addressof((*m_owner_cptr)[msear_as_a_size_t((*this).m_index)]);
 		}
-		const_reference operator[](difference_type _Off) const { return (*m_owner_cptr).at(msear_as_a_size_t(difference_type(m_index) + _Off)); }
+		const_reference operator[](difference_type _Off) const { return (*m_owner_cptr)[msear_as_a_size_t(difference_type(m_index) + _Off)]; }
 
 		bool operator==(const Tnii_array_ss_const_iterator_type& _Right_cref) const {
-			if (this->m_owner_cptr != _Right_cref.m_owner_cptr) { MSE_THROW(nii_array_range_error("invalid argument - Tnii_array_ss_const_iterator_type& operator==(const Tnii_array_ss_const_iterator_type& _Right) - Tnii_array_ss_const_iterator_type - nii_array")); }
+			if (check_policy_type::iterator_checks() && (this->m_owner_cptr != _Right_cref.m_owner_cptr)) { MSE_THROW(nii_array_range_error("invalid argument - Tnii_array_ss_const_iterator_type& operator==(const Tnii_array_ss_const_iterator_type& _Right) - Tnii_array_ss_const_iterator_type - nii_array")); }
 			return (_Right_cref.m_index == m_index);
 		}
 		bool operator!=(const Tnii_array_ss_const_iterator_type& _Right_cref) const { return (!(_Right_cref == (*this))); }
 		bool operator<(const Tnii_array_ss_const_iterator_type& _Right) const {
-			if (this->m_owner_cptr != _Right.m_owner_cptr) { MSE_THROW(nii_array_range_error("invalid argument - Tnii_array_ss_const_iterator_type& operator<(const Tnii_array_ss_const_iterator_type& _Right) - Tnii_array_ss_const_iterator_type - nii_array")); }
+			if (check_policy_type::iterator_checks() && (this->m_owner_cptr != _Right.m_owner_cptr)) { MSE_THROW(nii_array_range_error("invalid argument - Tnii_array_ss_const_iterator_type& operator<(const Tnii_array_ss_const_iterator_type& _Right) - Tnii_array_ss_const_iterator_type - nii_array")); }
 			return (m_index < _Right.m_index);
 		}
 		bool operator<=(const Tnii_array_ss_const_iterator_type& _Right) const { return (((*this) < _Right) || (_Right == (*this))); }
@@ -1759,6 +1763,7 @@ namespace mse {
 		typedef typename base_class::reference reference;
 		typedef const pointer const_pointer;
 		typedef const reference const_reference;
+		typedef typename mse::impl::check_policy_of<_TStateMutex>::type check_policy_type;
 
 		//template<class = typename std::enable_if<std::is_default_constructible<_TArrayPointer>::value, void>::type>
 		template<class _TArrayPointer2 = _TArrayPointer, class = typename std::enable_if<(std::is_same<_TArrayPointer2, _TArrayPointer>::value) && (std::is_default_constructible<_TArrayPointer>::value), void>::type>
@@ -1805,7 +1810,7 @@ namespace mse {
 			m_index = m_owner_ptr->size();
 		}
 		void set_to_next() {
-			if (points_to_an_item()) {
+			if ((!check_policy_type::iterator_checks()) || points_to_an_item()) {
 				m_index += 1;
 				assert(m_owner_ptr->size() >= m_index);
 			}
@@ -1814,7 +1819,7 @@ namespace mse {
 			}
 		}
 		void set_to_previous() {
-			if (has_previous()) {
+			if ((!check_policy_type::iterator_checks()) || has_previous()) {
 				m_index -= 1;
 			}
 			else {
@@ -1827,7 +1832,7 @@ namespace mse {
 		Tnii_array_ss_iterator_type operator--(int) { Tnii_array_ss_iterator_type _Tmp = *this; (*this).set_to_previous(); return (_Tmp); }
 		void advance(difference_type n) {
 			auto new_index = msear_int(m_index) + n;
-			if ((0 > new_index) || (m_owner_ptr->size() < msear_size_t(new_index))) {
+			if (check_policy_type::iterator_checks() && ((0 > new_index) || (m_owner_ptr->size() < msear_size_t(new_index)))) {
 				MSE_THROW(nii_array_range_error("index out of range - void advance(difference_type n) - Tnii_array_ss_iterator_type - nii_array"));
 			}
 			else {
@@ -1844,17 +1849,17 @@ namespace mse {
 		}
 		Tnii_array_ss_iterator_type operator-(difference_type n) const { return ((*this) + (-n)); }
 		difference_type operator-(const Tnii_array_ss_iterator_type& rhs) const {
-			if (rhs.m_owner_ptr != (*this).m_owner_ptr) { MSE_THROW(nii_array_range_error("invalid argument - difference_type operator-(const Tnii_array_ss_iterator_type& rhs) const - nii_array::Tnii_array_ss_iterator_type")); }
+			if (check_policy_type::iterator_checks() && (rhs.m_owner_ptr != (*this).m_owner_ptr)) { MSE_THROW(nii_array_range_error("invalid argument - difference_type operator-(const Tnii_array_ss_iterator_type& rhs) const - nii_array::Tnii_array_ss_iterator_type")); }
 			auto retval = difference_type((*this).m_index) - difference_type(rhs.m_index);
 			assert(difference_type((*m_owner_ptr).size()) >= retval);
 			return retval;
 		}
 		reference operator*() const {
-			return (*m_owner_ptr).at(msear_as_a_size_t((*this).m_index));
+			return (*m_owner_ptr)[msear_as_a_size_t((*this).m_index)];
 		}
 		reference item() const { return operator*(); }
 		reference previous_item() const {
-			if ((*this).has_previous()) {
+			if ((!check_policy_type::iterator_checks()) || (*this).has_previous()) {
 				return (*m_owner_ptr)[m_index - 1];
 			}
 			else {
@@ -1862,17 +1867,17 @@ namespace mse {
 			}
 		}
 		pointer operator->() const {
-			return std::addressof((*m_owner_ptr).at(msear_as_a_size_t((*this).m_index)));
+			return std::addressof((*m_owner_ptr)[msear_as_a_size_t((*this).m_index)]);
 		}
-		reference operator[](difference_type _Off) const { return (*m_owner_ptr).at(msear_as_a_size_t(difference_type(m_index) + _Off)); }
+		reference operator[](difference_type _Off) const { return (*m_owner_ptr)[msear_as_a_size_t(difference_type(m_index) + _Off)]; }
 
 		bool operator==(const Tnii_array_ss_iterator_type& _Right_cref) const {
-			if (this->m_owner_ptr != _Right_cref.m_owner_ptr) { MSE_THROW(nii_array_range_error("invalid argument - Tnii_array_ss_iterator_type& operator==(const Tnii_array_ss_iterator_type& _Right) - Tnii_array_ss_iterator_type - nii_array")); }
+			if (check_policy_type::iterator_checks() && (this->m_owner_ptr != _Right_cref.m_owner_ptr)) { MSE_THROW(nii_array_range_error("invalid argument - Tnii_array_ss_iterator_type& operator==(const Tnii_array_ss_iterator_type& _Right) - Tnii_array_ss_iterator_type - nii_array")); }
 			return (_Right_cref.m_index == m_index);
 		}
 		bool operator!=(const Tnii_array_ss_iterator_type& _Right_cref) const { return (!(_Right_cref == (*this))); }
 		bool operator<(const Tnii_array_ss_iterator_type& _Right) const {
-			if (this->m_owner_ptr != _Right.m_owner_ptr) { MSE_THROW(nii_array_range_error("invalid argument - Tnii_array_ss_iterator_type& operator<(const Tnii_array_ss_iterator_type& _Right) - Tnii_array_ss_iterator_type - nii_array")); }
+			if (check_policy_type::iterator_checks() && (this->m_owner_ptr != _Right.m_owner_ptr)) { MSE_THROW(nii_array_range_error("invalid argument - Tnii_array_ss_iterator_type& operator<(const Tnii_array_ss_iterator_type& _Right) - Tnii_array_ss_iterator_type - nii_array")); }
 			return (m_index < _Right.m_index);
 		}
 		bool operator<=(const Tnii_array_ss_iterator_type& _Right) const { return (((*this) < _Right) || (_Right == (*this))); }
@@ -2154,6 +2159,12 @@ namespace mse {
 		nii_array(const _MA& _X) : m_array(_X) {}
 		nii_array(_Myt&& _X) : m_array(std::forward<decltype(_X.contained_array())>(_X.contained_array())) {}
 		nii_array(const _Myt& _X) : m_array(_X.contained_array()) {}
+		/* Conversion from arrays that differ only in their check policy. Implicit conversion is only supported by move,
+		so that a copy isn't made inadvertently at, for example, an API boundary. */
+		template<class _TStateMutex2, class = typename std::enable_if<mse::impl::differ_only_by_check_policy<_TStateMutex2, _TStateMutex>::value>::type>
+		nii_array(nii_array<_Ty, _Size, _TStateMutex2>&& _X) : m_array(std::forward<decltype(_X.contained_array())>(_X.contained_array())) {}
+		template<class _TStateMutex2, class = typename std::enable_if<mse::impl::differ_only_by_check_policy<_TStateMutex2, _TStateMutex>::value>::type>
+		explicit nii_array(const nii_array<_Ty, _Size, _TStateMutex2>& _X) : m_array(_X.contained_array()) {}
 		//nii_array(_XSTD initializer_list<typename _MA::base_class::value_type> _Ilist) : m_array(_Ilist) {}
 		static std::array<_Ty, _Size> std_array_initial_value(std::true_type, _XSTD initializer_list<_Ty> _Ilist) {
 			/* _Ty is default constructible. */
@@ -2198,10 +2209,16 @@ namespace mse {
 		operator _MA() const { return contained_array(); }
 
 		typename std_array::const_reference operator[](msear_size_t _P) const {
-			return (*this).at(msear_as_a_size_t(_P));
+			if (mse::impl::check_policy_of<_TStateMutex>::type::element_access_checks()) {
+				return (*this).at(msear_as_a_size_t(_P));
+			}
+			return m_array[msear_as_a_size_t(_P)];
 		}
 		typename std_array::reference operator[](msear_size_t _P) {
-			return (*this).at(msear_as_a_size_t(_P));
+			if (mse::impl::check_policy_of<_TStateMutex>::type::element_access_checks()) {
+				return (*this).at(msear_as_a_size_t(_P));
+			}
+			return m_array[msear_as_a_size_t(_P)];
 		}
 		typename std_array::reference front() {	// return first element of mutable sequence
 			if (0 == (*this).size()) { MSE_THROW(nii_array_range_error("front() on empty - typename std_array::reference front() - nii_array")); }
@@ -2265,11 +2282,13 @@ namespace mse {
 
 		reference at(msear_size_t _Pos)
 		{	// subscript mutable sequence with checking
+			MSE_STATS_INCREMENT(bounds_check);
 			return m_array.at(msear_as_a_size_t(_Pos));
 		}
 
 		const_reference at(msear_size_t _Pos) const
 		{	// subscript nonmutable sequence with checking
+			MSE_STATS_INCREMENT(bounds_check);
 			return m_array.at(msear_as_a_size_t(_Pos));
 		}
 
@@ -2478,6 +2497,7 @@ namespace mse {
 		friend /*class */xscope_ss_const_iterator_type;
 		friend /*class */xscope_ss_iterator_type;
 		friend class us::msearray<_Ty, _Size, _TStateMutex>;
+		template<class _Ty2, size_t _Size2, class _TStateMutex2> friend class nii_array;
 
 		template<size_t _Idx, class _Tz, size_t _Size2>
 		friend _CONST_FUN _Tz& std::get(mse::nii_array<_Tz, _Size2>& _Arr) _NOEXCEPT;
@@ -3706,6 +3726,7 @@ namespace mse {
 					return std::addressof(m_ra_iterator[m_index]);
 				}
 				reference operator[](difference_type _Off) const {
+					MSE_STATS_INCREMENT(bounds_check);
 					bounds_check(_Off);
 					return m_ra_iterator[_Off];
 				}
@@ -3882,6 +3903,7 @@ namespace mse {
 					return std::addressof(m_ra_iterator[m_index]);
 				}
 				const_reference operator[](difference_type _Off) const {
+					MSE_STATS_INCREMENT(bounds_check);
 					bounds_check(_Off);
 					return m_ra_iterator[_Off];
 				}
@@ -4038,6 +4060,8 @@ namespace mse {
 		forward declare (the single parameter overload of) the make_xscope_random_access_const_section() function.
 		Specifically, they are needed to determine the return type of that function. The forward declaration needs to be
 		available before the definition of us::impl::TRandomAccessConstSectionBase<> as its implementation uses the function. */
+		struct ra_section_view_helpers;
+
 		struct ra_const_section_helpers {
 			/* construction helper functions */
 			template <typename _TRAPointer>
@@ -4185,6 +4209,7 @@ namespace mse {
 					, m_count(s_count_from_lone_param(param)) {}
 
 				const_reference operator[](size_type _P) const {
+					MSE_STATS_INCREMENT(bounds_check);
 					if (m_count <= _P) { MSE_THROW(msearray_range_error("out of bounds index - reference operator[](size_type _P) - TRandomAccessConstSectionBase")); }
 					return m_start_iter[difference_type(mse::msear_as_a_size_t(_P))];
 				}
@@ -4546,6 +4571,7 @@ namespace mse {
 				the private data members of this class. */
 				template<typename _TRAIterator1> friend class TRandomAccessSectionBase;
 				friend struct mse::impl::ra_const_section_helpers;
+				friend struct mse::impl::ra_section_view_helpers;
 			};
 		}
 	}
@@ -4674,6 +4700,7 @@ namespace mse {
 				TRandomAccessSectionBase(value_type(&native_array)[Tn]) : m_start_iter(native_array), m_count(Tn) {}
 
 				reference operator[](size_type _P) const {
+					MSE_STATS_INCREMENT(bounds_check);
 					if (m_count <= _P) { MSE_THROW(msearray_range_error("out of bounds index - reference operator[](size_type _P) - TRandomAccessSectionBase")); }
 					return m_start_iter[difference_type(mse::msear_as_a_size_t(_P))];
 				}
@@ -5113,6 +5140,7 @@ namespace mse {
 				template<typename _TRAIterator1> friend class TRandomAccessConstSectionBase;
 				template<typename _TRAIterator1> friend class TRandomAccessSectionBase;
 				friend struct mse::impl::ra_const_section_helpers;
+				friend struct mse::impl::ra_section_view_helpers;
 			};
 		}
 	}
@@ -5370,6 +5398,530 @@ namespace mse {
 		->TXScopeRandomAccessConstSection<typename decltype(make_xscope_random_access_const_section(std::declval<_TRALoneParam>()))::iterator_type>;
 #endif /* MSE_HAS_CXX17 */
 
+	namespace impl {
+		/* Indicates whether the elements referenced by the given (random access) iterator type reside in contiguous
+		storage that can't be relocated or deallocated for as long as the iterator exists. (Scope iterators to fixed-size
+		arrays qualify, while iterators to (resizable) vectors don't.) Once validated, element accesses via such an
+		iterator can be made via a raw pointer instead. */
+		template<typename _TRAIterator>
+		struct ra_iterator_has_stable_contiguous_storage : std::false_type {};
+		template<typename _TContainer>
+		struct is_fixed_storage_container : std::false_type {};
+		template<class _Ty, size_t _Size, class _TStateMutex>
+		struct is_fixed_storage_container<mse::nii_array<_Ty, _Size, _TStateMutex> > : std::true_type {};
+		template<class _Ty, size_t _Size>
+		struct is_fixed_storage_container<std::array<_Ty, _Size> > : std::true_type {};
+#if !defined(MSE_SCOPEPOINTER_RUNTIME_CHECKS_ENABLED)
+		/* (When scope pointers are checked at run-time, element accesses continue to go through them.) */
+		template<typename _TPointer>
+		struct is_xscope_pointer_to_fixed_storage_container : std::false_type {};
+#if !defined(MSE_SCOPEPOINTER_DISABLED)
+		template<typename _TContainer>
+		struct is_xscope_pointer_to_fixed_storage_container<mse::TXScopeFixedPointer<_TContainer> > : is_fixed_storage_container<typename std::remove_const<_TContainer>::type> {};
+		template<typename _TContainer>
+		struct is_xscope_pointer_to_fixed_storage_container<mse::TXScopeFixedConstPointer<_TContainer> > : is_fixed_storage_container<typename std::remove_const<_TContainer>::type> {};
+		template<typename _TContainer>
+		struct is_xscope_pointer_to_fixed_storage_container<mse::TXScopeItemFixedPointer<_TContainer> > : is_fixed_storage_container<typename std::remove_const<_TContainer>::type> {};
+		template<typename _TContainer>
+		struct is_xscope_pointer_to_fixed_storage_container<mse::TXScopeItemFixedConstPointer<_TContainer> > : is_fixed_storage_container<typename std::remove_const<_TContainer>::type> {};
+
+		template<typename _TRAContainerPointer>
+		struct ra_iterator_has_stable_contiguous_storage<mse::TXScopeRAIterator<_TRAContainerPointer> > : is_xscope_pointer_to_fixed_storage_container<_TRAContainerPointer> {};
+		template<typename _TRAContainerPointer>
+		struct ra_iterator_has_stable_contiguous_storage<mse::TXScopeRAConstIterator<_TRAContainerPointer> > : is_xscope_pointer_to_fixed_storage_container<_TRAContainerPointer> {};
+#else // !defined(MSE_SCOPEPOINTER_DISABLED)
+		/* With scope pointers disabled, scope views are constructed from (and their iterators hold) raw pointers to the
+		container, whose lifetime is no more assured than that of raw pointers to its elements. */
+		template<typename _TContainer>
+		struct is_xscope_pointer_to_fixed_storage_container<_TContainer*> : is_fixed_storage_container<typename std::remove_const<_TContainer>::type> {};
+
+		template<typename _TRAContainerPointer>
+		struct ra_iterator_has_stable_contiguous_storage<mse::TRAIterator<_TRAContainerPointer> > : is_xscope_pointer_to_fixed_storage_container<_TRAContainerPointer> {};
+		template<typename _TRAContainerPointer>
+		struct ra_iterator_has_stable_contiguous_storage<mse::TRAConstIterator<_TRAContainerPointer> > : is_xscope_pointer_to_fixed_storage_container<_TRAContainerPointer> {};
+#endif // !defined(MSE_SCOPEPOINTER_DISABLED)
+		template<class _Ty, size_t _Size, class _TStateMutex>
+		struct ra_iterator_has_stable_contiguous_storage<mse::Tnii_array_xscope_ss_iterator_type<_Ty, _Size, _TStateMutex> > : std::true_type {};
+		template<class _Ty, size_t _Size, class _TStateMutex>
+		struct ra_iterator_has_stable_contiguous_storage<mse::Tnii_array_xscope_ss_const_iterator_type<_Ty, _Size, _TStateMutex> > : std::true_type {};
+#endif // !defined(MSE_SCOPEPOINTER_RUNTIME_CHECKS_ENABLED)
+
+		/* This struct gives the strided and multi-dimensional section views access to the starting iterator of the
+		"random access section" they are constructed from, so that they can bypass the section's own (redundant)
+		per-element bounds check once their own bounds have been validated. */
+		struct ra_section_view_helpers {
+			/* For iterators with stable contiguous storage, the (validated) views resolve a raw pointer to their first
+			element (if any) upon construction, and access elements via that pointer. Otherwise they use the iterator. */
+			template <typename _TRawPointer, typename _TRAIterator>
+			static _TRawPointer start_raw_pointer(const _TRAIterator& start_iter, bool is_empty) {
+				return start_raw_pointer_helper<_TRawPointer>(typename ra_iterator_has_stable_contiguous_storage<_TRAIterator>::type(), start_iter, is_empty);
+			}
+			template <typename _TReference, typename _TRAIterator, typename _TRawPointer, typename difference_type>
+			static _TReference element_at(const _TRAIterator& start_iter, _TRawPointer start_raw_ptr, difference_type offset) {
+				return element_at_helper<_TReference>(typename ra_iterator_has_stable_contiguous_storage<_TRAIterator>::type(), start_iter, start_raw_ptr, offset);
+			}
+
+			template <typename _TRAIterator>
+			static const _TRAIterator& start_iter(const mse::us::impl::TRandomAccessSectionBase<_TRAIterator>& ra_section) {
+				return ra_section.m_start_iter;
+			}
+			template <typename _TRAIterator>
+			static const _TRAIterator& start_iter(const mse::us::impl::TRandomAccessConstSectionBase<_TRAIterator>& ra_section) {
+				return ra_section.m_start_iter;
+			}
+
+			/* Returns the (relative) index of the last element reachable from the given offset, extents and strides. Throws
+			if the computation would overflow. */
+			template <typename size_type, size_t Rank>
+			static size_type checked_last_element_index(size_type offset, const std::array<size_type, Rank>& extents, const std::array<size_type, Rank>& strides) {
+				size_type retval = offset;
+				for (size_t d = 0; Rank > d; d += 1) {
+					if (1 < extents[d]) {
+						const size_type last_index_in_dim = extents[d] - 1;
+						if ((0 != strides[d]) && (((std::numeric_limits<size_type>::max)() - retval) / strides[d] < last_index_in_dim)) {
+							MSE_THROW(msearray_range_error("index overflow - checked_last_element_index() - ra_section_view_helpers"));
+						}
+						retval += last_index_in_dim * strides[d];
+					}
+				}
+				return retval;
+			}
+			template <typename size_type, size_t Rank>
+			static void validate_bounds(size_type ra_section_size, size_type offset, const std::array<size_type, Rank>& extents, const std::array<size_type, Rank>& strides) {
+				for (size_t d = 0; Rank > d; d += 1) {
+					if (0 == extents[d]) {
+						/* The view is empty. */
+						if (offset > ra_section_size) { MSE_THROW(msearray_range_error("out of bounds offset - validate_bounds() - ra_section_view_helpers")); }
+						return;
+					}
+				}
+				if (checked_last_element_index(offset, extents, strides) >= ra_section_size) {
+					MSE_THROW(msearray_range_error("out of bounds view - validate_bounds() - ra_section_view_helpers"));
+				}
+			}
+
+		private:
+			template <typename _TRawPointer, typename _TRAIterator>
+			static _TRawPointer start_raw_pointer_helper(std::true_type, const _TRAIterator& start_iter, bool is_empty) {
+				return is_empty ? nullptr : std::addressof(start_iter[0]);
+			}
+			template <typename _TRawPointer, typename _TRAIterator>
+			static _TRawPointer start_raw_pointer_helper(std::false_type, const _TRAIterator&, bool) {
+				return nullptr;
+			}
+			template <typename _TReference, typename _TRAIterator, typename _TRawPointer, typename difference_type>
+			static _TReference element_at_helper(std::true_type, const _TRAIterator&, _TRawPointer start_raw_ptr, difference_type offset) {
+				return start_raw_ptr[offset];
+			}
+			template <typename _TReference, typename _TRAIterator, typename _TRawPointer, typename difference_type>
+			static _TReference element_at_helper(std::false_type, const _TRAIterator& start_iter, _TRawPointer, difference_type offset) {
+				return start_iter[offset];
+			}
+		};
+	}
+
+	namespace us {
+		namespace impl {
+			template <typename _TRAIterator, size_t Rank, bool _IsConst> class TXScopeMultiDimSectionImpl;
+
+			/* A scope view of every "stride"th element of a "random access section". */
+			template <typename _TRAIterator, bool _IsConst>
+			class TXScopeStridedSectionImpl : public mse::us::impl::XScopeContainsNonOwningScopeReferenceTagBase, public mse::us::impl::StrongPointerAsyncNotShareableAndNotPassableTagBase {
+			public:
+				typedef _TRAIterator iterator_type;
+				typedef typename TXScopeRandomAccessSection<_TRAIterator>::value_type value_type;
+				typedef typename TXScopeRandomAccessSection<_TRAIterator>::size_type size_type;
+				typedef typename TXScopeRandomAccessSection<_TRAIterator>::difference_type difference_type;
+				typedef typename std::conditional<_IsConst, typename TXScopeRandomAccessSection<_TRAIterator>::const_reference
+					, typename TXScopeRandomAccessSection<_TRAIterator>::reference>::type reference;
+				typedef typename TXScopeRandomAccessSection<_TRAIterator>::const_reference const_reference;
+				typedef typename std::remove_reference<reference>::type* raw_pointer_t;
+
+				/* The bounds of the view are validated (once) here. Element access need only check the index against the
+				element count (and, if the underlying storage is stable and contiguous, is done via a raw pointer). */
+				TXScopeStridedSectionImpl(const TRandomAccessSectionBase<_TRAIterator>& ra_section, size_type offset, size_type count, size_type stride = 1)
+					: TXScopeStridedSectionImpl(s_validated(ra_section.size(), offset, count, stride), mse::impl::ra_section_view_helpers::start_iter(ra_section), offset, count, stride) {}
+				template<bool _IsConst2 = _IsConst, class = typename std::enable_if<(_IsConst2 == _IsConst) && (_IsConst2), void>::type>
+				TXScopeStridedSectionImpl(const TRandomAccessConstSectionBase<_TRAIterator>& ra_section, size_type offset, size_type count, size_type stride = 1)
+					: TXScopeStridedSectionImpl(s_validated(ra_section.size(), offset, count, stride), mse::impl::ra_section_view_helpers::start_iter(ra_section), offset, count, stride) {}
+				TXScopeStridedSectionImpl(const TXScopeStridedSectionImpl& src) = default;
+				template<bool _IsConst2 = _IsConst, class = typename std::enable_if<(_IsConst2 == _IsConst) && (_IsConst2), void>::type>
+				TXScopeStridedSectionImpl(const TXScopeStridedSectionImpl<_TRAIterator, false>& src)
+					: m_start_iter(src.m_start_iter), m_start_raw_ptr(src.m_start_raw_ptr), m_count(src.m_count), m_stride(src.m_stride) {}
+
+				reference operator[](size_type _P) const {
+					MSE_STATS_INCREMENT(bounds_check);
+					if (m_count <= _P) { MSE_THROW(msearray_range_error("out of bounds index - reference operator[](size_type _P) - TXScopeStridedSection")); }
+					return element_at(difference_type(mse::msear_as_a_size_t(_P * m_stride)));
+				}
+				reference at(size_type _P) const { return (*this)[_P]; }
+				reference front() const { return (*this)[0]; }
+				reference back() const {
+					if (0 == m_count) { MSE_THROW(msearray_range_error("back() on empty - reference back() const - TXScopeStridedSection")); }
+					return (*this)[m_count - 1];
+				}
+				size_type size() const _NOEXCEPT { return m_count; }
+				bool empty() const _NOEXCEPT { return (0 == m_count); }
+				size_type stride() const _NOEXCEPT { return m_stride; }
+
+				/* Returns a view of (up to) n elements of this view, starting at element pos. */
+				TXScopeStridedSectionImpl xscope_subsection(size_type pos = 0, size_type n = size_type(-1)) const {
+					if (pos > m_count) { MSE_THROW(msearray_range_error("out of bounds index - xscope_subsection() - TXScopeStridedSection")); }
+					const auto count = (std::min)(n, m_count - pos);
+					return TXScopeStridedSectionImpl(unchecked_construction_tag(), m_start_iter, (0 == count) ? 0 : pos * m_stride, count, m_stride);
+				}
+
+				/* Calls the given function on each element in order. No per-element bounds checking (beyond any done by the
+				underlying iterator) is required. */
+				template<typename _TFunction>
+				void for_each(_TFunction&& func) const {
+					difference_type offset = 0;
+					for (size_type i = 0; m_count > i; i += 1, offset += difference_type(m_stride)) {
+						func(element_at(offset));
+					}
+				}
+
+				class xscope_iterator : public mse::us::impl::XScopeContainsNonOwningScopeReferenceTagBase, public mse::us::impl::StrongPointerAsyncNotShareableAndNotPassableTagBase {
+				public:
+					typedef std::random_access_iterator_tag iterator_category;
+					typedef typename TXScopeStridedSectionImpl::value_type value_type;
+					typedef typename TXScopeStridedSectionImpl::difference_type difference_type;
+					typedef typename TXScopeStridedSectionImpl::reference reference;
+					typedef typename std::remove_reference<reference>::type* pointer;
+
+					reference operator*() const { return (*this)[0]; }
+					pointer operator->() const { return std::addressof((*this)[0]); }
+					reference operator[](difference_type n) const {
+						const auto index = size_type(difference_type(m_index) + n);
+						MSE_STATS_INCREMENT(bounds_check);
+						if (m_count <= index) { MSE_THROW(msearray_range_error("out of bounds index - reference operator[](difference_type n) - TXScopeStridedSection::xscope_iterator")); }
+						return mse::impl::ra_section_view_helpers::element_at<reference>(m_start_iter, m_start_raw_ptr, difference_type(mse::msear_as_a_size_t(index * m_stride)));
+					}
+					xscope_iterator& operator++() { m_index += 1; return *this; }
+					xscope_iterator operator++(int) { auto retval = *this; m_index += 1; return retval; }
+					xscope_iterator& operator--() { m_index -= 1; return *this; }
+					xscope_iterator operator--(int) { auto retval = *this; m_index -= 1; return retval; }
+					xscope_iterator& operator+=(difference_type n) { m_index = size_type(difference_type(m_index) + n); return *this; }
+					xscope_iterator& operator-=(difference_type n) { return (*this) += (-n); }
+					xscope_iterator operator+(difference_type n) const { auto retval = *this; retval += n; return retval; }
+					xscope_iterator operator-(difference_type n) const { auto retval = *this; retval -= n; return retval; }
+					difference_type operator-(const xscope_iterator& _Right) const {
+						if ((m_stride != _Right.m_stride) || (m_start_iter != _Right.m_start_iter)) { MSE_THROW(msearray_range_error("iterators are from different views - TXScopeStridedSection::xscope_iterator")); }
+						return difference_type(m_index) - difference_type(_Right.m_index);
+					}
+					bool operator==(const xscope_iterator& _Right) const { return 0 == ((*this) - _Right); }
+					bool operator!=(const xscope_iterator& _Right) const { return !((*this) == _Right); }
+					bool operator<(const xscope_iterator& _Right) const { return 0 > ((*this) - _Right); }
+					bool operator>(const xscope_iterator& _Right) const { return _Right < (*this); }
+					bool operator<=(const xscope_iterator& _Right) const { return !((*this) > _Right); }
+					bool operator>=(const xscope_iterator& _Right) const { return !((*this) < _Right); }
+
+				private:
+					/* Like the iterators of the other sections, the iterator holds (a copy of) the view's start iterator, rather
+					than a reference to the view, so it remains valid after a (temporary) view is destroyed. */
+					xscope_iterator(const TXScopeStridedSectionImpl& view, size_type index)
+						: m_start_iter(view.m_start_iter), m_start_raw_ptr(view.m_start_raw_ptr), m_count(view.m_count), m_stride(view.m_stride), m_index(index) {}
+					_TRAIterator m_start_iter;
+					raw_pointer_t m_start_raw_ptr = nullptr;
+					size_type m_count = 0;
+					size_type m_stride = 1;
+					size_type m_index = 0;
+					friend class TXScopeStridedSectionImpl;
+				};
+				typedef xscope_iterator xscope_const_iterator;
+
+				/* These are here to support range-based for loops and standard algorithms. */
+				typedef xscope_iterator iterator;
+				typedef xscope_iterator const_iterator;
+				xscope_iterator xscope_begin() const { return xscope_iterator(*this, 0); }
+				xscope_iterator xscope_end() const { return xscope_iterator(*this, m_count); }
+				xscope_iterator begin() const { return xscope_begin(); }
+				xscope_iterator end() const { return xscope_end(); }
+				xscope_iterator cbegin() const { return xscope_begin(); }
+				xscope_iterator cend() const { return xscope_end(); }
+
+			private:
+				struct unchecked_construction_tag {};
+				TXScopeStridedSectionImpl(unchecked_construction_tag, const _TRAIterator& start_iter, size_type offset, size_type count, size_type stride)
+					: m_start_iter(start_iter + difference_type(mse::msear_as_a_size_t(offset)))
+					, m_start_raw_ptr(mse::impl::ra_section_view_helpers::start_raw_pointer<raw_pointer_t>(m_start_iter, (0 == count))), m_count(count), m_stride(stride) {}
+
+				reference element_at(difference_type offset) const {
+					return mse::impl::ra_section_view_helpers::element_at<reference>(m_start_iter, m_start_raw_ptr, offset);
+				}
+
+				static unchecked_construction_tag s_validated(size_type ra_section_size, size_type offset, size_type count, size_type stride) {
+					mse::impl::ra_section_view_helpers::validate_bounds(ra_section_size, offset, std::array<size_type, 1>{ { count } }, std::array<size_type, 1>{ { stride } });
+					return unchecked_construction_tag();
+				}
+
+				TXScopeStridedSectionImpl& operator=(const TXScopeStridedSectionImpl& _Right_cref) = delete;
+				MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
+
+				_TRAIterator m_start_iter;
+				/* (Only used if the underlying storage is stable and contiguous.) */
+				raw_pointer_t m_start_raw_ptr = nullptr;
+				size_type m_count = 0;
+				size_type m_stride = 1;
+
+				template<typename _TRAIterator1, bool _IsConst1> friend class TXScopeStridedSectionImpl;
+				template<typename _TRAIterator1, size_t Rank1, bool _IsConst1> friend class TXScopeMultiDimSectionImpl;
+			};
+
+			/* A scope view that presents (a subset of) the elements of a "random access section" as an n-dimensional array
+			(like std::mdspan). The view's bounds are validated once, upon construction. */
+			template <typename _TRAIterator, size_t Rank, bool _IsConst>
+			class TXScopeMultiDimSectionImpl : public mse::us::impl::XScopeContainsNonOwningScopeReferenceTagBase, public mse::us::impl::StrongPointerAsyncNotShareableAndNotPassableTagBase {
+			public:
+				static_assert(1 <= Rank, "TXScopeMultiDimSection<> requires a rank of at least one");
+
+				typedef _TRAIterator iterator_type;
+				typedef typename TXScopeRandomAccessSection<_TRAIterator>::value_type value_type;
+				typedef typename TXScopeRandomAccessSection<_TRAIterator>::size_type size_type;
+				typedef typename TXScopeRandomAccessSection<_TRAIterator>::difference_type difference_type;
+				typedef typename std::conditional<_IsConst, typename TXScopeRandomAccessSection<_TRAIterator>::const_reference
+					, typename TXScopeRandomAccessSection<_TRAIterator>::reference>::type reference;
+				typedef typename TXScopeRandomAccessSection<_TRAIterator>::const_reference const_reference;
+				typedef std::array<size_type, Rank> extents_type;
+				typedef std::array<size_type, Rank> strides_type;
+				typedef std::array<size_type, Rank> indices_type;
+				typedef TXScopeStridedSectionImpl<_TRAIterator, _IsConst> strided_section_t;
+				typedef typename std::remove_reference<reference>::type* raw_pointer_t;
+				static constexpr size_t rank() _NOEXCEPT { return Rank; }
+
+				/* Views the initial elements of the given section as a (dense) "row-major" array with the given extents. */
+				TXScopeMultiDimSectionImpl(const TRandomAccessSectionBase<_TRAIterator>& ra_section, const extents_type& extents)
+					: TXScopeMultiDimSectionImpl(ra_section, 0, extents, s_row_major_strides(extents)) {}
+				/* Views the elements of the given section at positions offset + sum(indices[d] * strides[d]). */
+				TXScopeMultiDimSectionImpl(const TRandomAccessSectionBase<_TRAIterator>& ra_section, size_type offset, const extents_type& extents, const strides_type& strides)
+					: TXScopeMultiDimSectionImpl(s_validated(ra_section.size(), offset, extents, strides), mse::impl::ra_section_view_helpers::start_iter(ra_section), offset, extents, strides) {}
+				template<bool _IsConst2 = _IsConst, class = typename std::enable_if<(_IsConst2 == _IsConst) && (_IsConst2), void>::type>
+				TXScopeMultiDimSectionImpl(const TRandomAccessConstSectionBase<_TRAIterator>& ra_section, const extents_type& extents)
+					: TXScopeMultiDimSectionImpl(ra_section, 0, extents, s_row_major_strides(extents)) {}
+				template<bool _IsConst2 = _IsConst, class = typename std::enable_if<(_IsConst2 == _IsConst) && (_IsConst2), void>::type>
+				TXScopeMultiDimSectionImpl(const TRandomAccessConstSectionBase<_TRAIterator>& ra_section, size_type offset, const extents_type& extents, const strides_type& strides)
+					: TXScopeMultiDimSectionImpl(s_validated(ra_section.size(), offset, extents, strides), mse::impl::ra_section_view_helpers::start_iter(ra_section), offset, extents, strides) {}
+				TXScopeMultiDimSectionImpl(const TXScopeMultiDimSectionImpl& src) = default;
+				template<bool _IsConst2 = _IsConst, class = typename std::enable_if<(_IsConst2 == _IsConst) && (_IsConst2), void>::type>
+				TXScopeMultiDimSectionImpl(const TXScopeMultiDimSectionImpl<_TRAIterator, Rank, false>& src)
+					: m_start_iter(src.m_start_iter), m_start_raw_ptr(src.m_start_raw_ptr), m_extents(src.m_extents), m_strides(src.m_strides) {}
+
+				template<typename... _TIndices>
+				reference operator()(const _TIndices&... indices) const {
+					static_assert(Rank == sizeof...(_TIndices), "the number of indices must match the rank of the view");
+					return at(indices_type{ { size_type(indices)... } });
+				}
+				reference at(const indices_type& indices) const {
+					difference_type offset = 0;
+					for (size_t d = 0; Rank > d; d += 1) {
+						if (m_extents[d] <= indices[d]) { MSE_THROW(msearray_range_error("out of bounds index - reference at(const indices_type& indices) - TXScopeMultiDimSection")); }
+						offset += difference_type(mse::msear_as_a_size_t(indices[d] * m_strides[d]));
+					}
+					return element_at(offset);
+				}
+
+				size_type extent(size_t dim) const {
+					if (Rank <= dim) { MSE_THROW(msearray_range_error("invalid dimension - extent() - TXScopeMultiDimSection")); }
+					return m_extents[dim];
+				}
+				size_type stride(size_t dim) const {
+					if (Rank <= dim) { MSE_THROW(msearray_range_error("invalid dimension - stride() - TXScopeMultiDimSection")); }
+					return m_strides[dim];
+				}
+				const extents_type& extents() const _NOEXCEPT { return m_extents; }
+				const strides_type& strides() const _NOEXCEPT { return m_strides; }
+				size_type size() const _NOEXCEPT {
+					size_type retval = 1;
+					for (size_t d = 0; Rank > d; d += 1) { retval *= m_extents[d]; }
+					return retval;
+				}
+				bool empty() const _NOEXCEPT { return (0 == size()); }
+
+				/* Returns a view of the (hyper-rectangular) "tile" that starts at the given indices and has the given extents.
+				Only O(Rank) validation is required. */
+				TXScopeMultiDimSectionImpl xscope_subview(const indices_type& offsets, const extents_type& extents) const {
+					difference_type offset = 0;
+					for (size_t d = 0; Rank > d; d += 1) {
+						if ((m_extents[d] < offsets[d]) || (m_extents[d] - offsets[d] < extents[d])) {
+							MSE_THROW(msearray_range_error("out of bounds subview - xscope_subview() - TXScopeMultiDimSection"));
+						}
+						offset += difference_type(mse::msear_as_a_size_t(offsets[d] * m_strides[d]));
+					}
+					/* The strides of an empty view were never validated, so an empty tile just starts where this view does. */
+					return TXScopeMultiDimSectionImpl(unchecked_construction_tag(), m_start_iter, s_is_empty(extents) ? 0 : offset, extents, m_strides);
+				}
+
+				/* Returns the (Rank - 1)-dimensional view obtained by fixing the index of the given dimension. */
+				template<size_t Rank2 = Rank, class = typename std::enable_if<(Rank2 == Rank) && (1 < Rank2), void>::type>
+				TXScopeMultiDimSectionImpl<_TRAIterator, Rank2 - 1, _IsConst> xscope_slice(size_t dim, size_type index) const {
+					if ((Rank <= dim) || (m_extents[dim] <= index)) { MSE_THROW(msearray_range_error("out of bounds slice - xscope_slice() - TXScopeMultiDimSection")); }
+					std::array<size_type, Rank - 1> extents;
+					std::array<size_type, Rank - 1> strides;
+					for (size_t d = 0, d2 = 0; Rank > d; d += 1) {
+						if (dim != d) {
+							extents[d2] = m_extents[d];
+							strides[d2] = m_strides[d];
+							d2 += 1;
+						}
+					}
+					return TXScopeMultiDimSectionImpl<_TRAIterator, Rank - 1, _IsConst>(typename TXScopeMultiDimSectionImpl<_TRAIterator, Rank - 1, _IsConst>::unchecked_construction_tag()
+						, m_start_iter, empty() ? 0 : difference_type(mse::msear_as_a_size_t(index * m_strides[dim])), extents, strides);
+				}
+
+				/* Returns the one-dimensional view along the given dimension, with the other indices fixed at the given values
+				(the value given for the chosen dimension is the starting index). */
+				strided_section_t xscope_line(size_t dim, const indices_type& indices) const {
+					if (Rank <= dim) { MSE_THROW(msearray_range_error("invalid dimension - xscope_line() - TXScopeMultiDimSection")); }
+					difference_type offset = 0;
+					for (size_t d = 0; Rank > d; d += 1) {
+						if ((dim == d) ? (m_extents[d] < indices[d]) : (m_extents[d] <= indices[d])) {
+							MSE_THROW(msearray_range_error("out of bounds index - xscope_line() - TXScopeMultiDimSection"));
+						}
+						offset += difference_type(mse::msear_as_a_size_t(indices[d] * m_strides[d]));
+					}
+					const size_type count = m_extents[dim] - indices[dim];
+					return strided_section_t(typename strided_section_t::unchecked_construction_tag(), m_start_iter, (0 == count) ? 0 : size_type(offset), count, m_strides[dim]);
+				}
+				/* For two-dimensional views, rows and columns are available as (one-dimensional) strided sections. */
+				template<size_t Rank2 = Rank, class = typename std::enable_if<(Rank2 == Rank) && (2 == Rank2), void>::type>
+				strided_section_t xscope_row(size_type row_index) const {
+					return xscope_line(1, indices_type{ { row_index, 0 } });
+				}
+				template<size_t Rank2 = Rank, class = typename std::enable_if<(Rank2 == Rank) && (2 == Rank2), void>::type>
+				strided_section_t xscope_column(size_type column_index) const {
+					return xscope_line(0, indices_type{ { 0, column_index } });
+				}
+
+				/* Calls the given function on each element in "row-major" order. The innermost dimension is traversed
+				without per-element bounds checking (beyond any done by the underlying iterator). */
+				template<typename _TFunction>
+				void for_each(_TFunction&& func) const {
+					if (empty()) { return; }
+					indices_type indices;
+					indices.fill(0);
+					const auto inner_extent = m_extents[Rank - 1];
+					const auto inner_stride = difference_type(m_strides[Rank - 1]);
+					while (true) {
+						difference_type offset = 0;
+						for (size_t d = 0; Rank - 1 > d; d += 1) {
+							offset += difference_type(mse::msear_as_a_size_t(indices[d] * m_strides[d]));
+						}
+						for (size_type i = 0; inner_extent > i; i += 1, offset += inner_stride) {
+							func(element_at(offset));
+						}
+						/* advance the outer indices */
+						size_t d = Rank - 1;
+						while (true) {
+							if (0 == d) { return; }
+							d -= 1;
+							indices[d] += 1;
+							if (m_extents[d] > indices[d]) { break; }
+							indices[d] = 0;
+						}
+					}
+				}
+
+			private:
+				struct unchecked_construction_tag {};
+				TXScopeMultiDimSectionImpl(unchecked_construction_tag, const _TRAIterator& start_iter, difference_type offset, const extents_type& extents, const strides_type& strides)
+					: m_start_iter(start_iter + offset), m_start_raw_ptr(mse::impl::ra_section_view_helpers::start_raw_pointer<raw_pointer_t>(m_start_iter, s_is_empty(extents)))
+					, m_extents(extents), m_strides(strides) {}
+
+				reference element_at(difference_type offset) const {
+					return mse::impl::ra_section_view_helpers::element_at<reference>(m_start_iter, m_start_raw_ptr, offset);
+				}
+				static bool s_is_empty(const extents_type& extents) {
+					for (size_t d = 0; Rank > d; d += 1) {
+						if (0 == extents[d]) { return true; }
+					}
+					return false;
+				}
+
+				static unchecked_construction_tag s_validated(size_type ra_section_size, size_type offset, const extents_type& extents, const strides_type& strides) {
+					mse::impl::ra_section_view_helpers::validate_bounds(ra_section_size, offset, extents, strides);
+					return unchecked_construction_tag();
+				}
+				static strides_type s_row_major_strides(const extents_type& extents) {
+					strides_type retval;
+					size_type stride = 1;
+					for (size_t d = Rank; 0 < d; d -= 1) {
+						retval[d - 1] = stride;
+						stride *= (std::max)(extents[d - 1], size_type(1));
+					}
+					return retval;
+				}
+
+				TXScopeMultiDimSectionImpl& operator=(const TXScopeMultiDimSectionImpl& _Right_cref) = delete;
+				MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
+
+				_TRAIterator m_start_iter;
+				/* (Only used if the underlying storage is stable and contiguous.) */
+				raw_pointer_t m_start_raw_ptr = nullptr;
+				extents_type m_extents;
+				strides_type m_strides;
+
+				template<typename _TRAIterator1, size_t Rank1, bool _IsConst1> friend class TXScopeMultiDimSectionImpl;
+			};
+		}
+	}
+
+	/* TXScopeStridedSection<> and TXScopeMultiDimSection<> are scope views over a "random access section" that present its
+	elements as, respectively, a (one-dimensional) sequence of every "stride"th element, and an n-dimensional array (for
+	things like images and matrices). Rows, columns and (rectangular) tiles of a multi-dimensional view are themselves
+	views, cheap to obtain. Bounds are validated when the view is constructed, so element access only needs to check
+	indices against the view's extents, and for_each() traversal needs no bounds checks of its own. */
+	template <typename _TRAIterator>
+	using TXScopeStridedSection = us::impl::TXScopeStridedSectionImpl<_TRAIterator, false>;
+	template <typename _TRAIterator>
+	using TXScopeStridedConstSection = us::impl::TXScopeStridedSectionImpl<_TRAIterator, true>;
+	template <typename _TRAIterator, size_t Rank>
+	using TXScopeMultiDimSection = us::impl::TXScopeMultiDimSectionImpl<_TRAIterator, Rank, false>;
+	template <typename _TRAIterator, size_t Rank>
+	using TXScopeMultiDimConstSection = us::impl::TXScopeMultiDimSectionImpl<_TRAIterator, Rank, true>;
+
+	/* The "lone parameter" can be a "random access section", or anything a "random access section" can be constructed
+	from (a scope pointer to a container, a container, a native array, etc.). */
+	template <typename _TRALoneParam>
+	auto make_xscope_strided_section(const _TRALoneParam& param, typename TXScopeRandomAccessSection<char*>::size_type offset
+		, typename TXScopeRandomAccessSection<char*>::size_type count, typename TXScopeRandomAccessSection<char*>::size_type stride = 1) {
+		auto ra_section = mse::make_xscope_random_access_section(param);
+		typedef typename decltype(ra_section)::iterator_type _TRAIterator;
+		return TXScopeStridedSection<_TRAIterator>(ra_section, offset, count, stride);
+	}
+	template <typename _TRALoneParam>
+	auto make_xscope_strided_const_section(const _TRALoneParam& param, typename TXScopeRandomAccessSection<char*>::size_type offset
+		, typename TXScopeRandomAccessSection<char*>::size_type count, typename TXScopeRandomAccessSection<char*>::size_type stride = 1) {
+		auto ra_section = mse::make_xscope_random_access_const_section(param);
+		typedef typename decltype(ra_section)::iterator_type _TRAIterator;
+		return TXScopeStridedConstSection<_TRAIterator>(ra_section, offset, count, stride);
+	}
+	template <typename _TRALoneParam, size_t Rank>
+	auto make_xscope_multi_dim_section(const _TRALoneParam& param, const std::array<typename TXScopeRandomAccessSection<char*>::size_type, Rank>& extents) {
+		auto ra_section = mse::make_xscope_random_access_section(param);
+		typedef typename decltype(ra_section)::iterator_type _TRAIterator;
+		return TXScopeMultiDimSection<_TRAIterator, Rank>(ra_section, extents);
+	}
+	template <typename _TRALoneParam, size_t Rank>
+	auto make_xscope_multi_dim_section(const _TRALoneParam& param, typename TXScopeRandomAccessSection<char*>::size_type offset
+		, const std::array<typename TXScopeRandomAccessSection<char*>::size_type, Rank>& extents, const std::array<typename TXScopeRandomAccessSection<char*>::size_type, Rank>& strides) {
+		auto ra_section = mse::make_xscope_random_access_section(param);
+		typedef typename decltype(ra_section)::iterator_type _TRAIterator;
+		return TXScopeMultiDimSection<_TRAIterator, Rank>(ra_section, offset, extents, strides);
+	}
+	template <typename _TRALoneParam, size_t Rank>
+	auto make_xscope_multi_dim_const_section(const _TRALoneParam& param, const std::array<typename TXScopeRandomAccessSection<char*>::size_type, Rank>& extents) {
+		auto ra_section = mse::make_xscope_random_access_const_section(param);
+		typedef typename decltype(ra_section)::iterator_type _TRAIterator;
+		return TXScopeMultiDimConstSection<_TRAIterator, Rank>(ra_section, extents);
+	}
+	template <typename _TRALoneParam, size_t Rank>
+	auto make_xscope_multi_dim_const_section(const _TRALoneParam& param, typename TXScopeRandomAccessSection<char*>::size_type offset
+		, const std::array<typename TXScopeRandomAccessSection<char*>::size_type, Rank>& extents, const std::array<typename TXScopeRandomAccessSection<char*>::size_type, Rank>& strides) {
+		auto ra_section = mse::make_xscope_random_access_const_section(param);
+		typedef typename decltype(ra_section)::iterator_type _TRAIterator;
+		return TXScopeMultiDimConstSection<_TRAIterator, Rank>(ra_section, offset, extents, strides);
+	}
+
 	/* TXScopeCagedRandomAccessConstSectionToRValue<> represents a "random access const section" that refers to a temporary
 	object. The "random access const section" is inaccessible ("caged") by default because it is, in general, unsafe. Its
 	copyability and movability are also restricted. The "random access const section" can only be accessed by certain types
@@ -2897,6 +2897,7 @@ namespace mse {
 		typedef typename base_class::reference reference;
 		typedef const pointer const_pointer;
 		typedef const reference const_reference;
+		typedef typename mse::impl::check_policy_of<_TStateMutex>::type check_policy_type;
 
 		//template<class = typename std::enable_if<std::is_default_constructible<_TBasicStringConstPointer>::value, void>::type>
 		template<class _TBasicStringConstPointer2 = _TBasicStringConstPointer, class = typename std::enable_if<(std::is_same<_TBasicStringConstPointer2, _TBasicStringConstPointer>::value) && (std::is_default_constructible<_TBasicStringConstPointer>::value), void>::type>
@@ -2948,7 +2949,7 @@ namespace mse {
 			m_index = m_owner_cptr->size();
 		}
 		void set_to_next() {
-			if (points_to_an_item()) {
+			if ((!check_policy_type::iterator_checks()) || points_to_an_item()) {
 				m_index += 1;
 				assert(m_owner_cptr->size() >= m_index);
 			}
@@ -2957,7 +2958,7 @@ namespace mse {
 			}
 		}
 		void set_to_previous() {
-			if (has_previous()) {
+			if ((!check_policy_type::iterator_checks()) || has_previous()) {
 				m_index -= 1;
 			}
 			else {
@@ -2970,7 +2971,7 @@ namespace mse {
 		Tnii_basic_string_ss_const_iterator_type operator--(int) { Tnii_basic_string_ss_const_iterator_type _Tmp = *this; (*this).set_to_previous(); return (_Tmp); }
 		void advance(difference_type n) {
 			auto new_index = msev_int(m_index) + n;
-			if ((0 > new_index) || (m_owner_cptr->size() < msev_size_t(new_index))) {
+			if (check_policy_type::iterator_checks() && ((0 > new_index) || (m_owner_cptr->size() < msev_size_t(new_index)))) {
 				MSE_THROW(nii_basic_string_range_error("index out of range - void advance(difference_type n) - Tnii_basic_string_ss_const_iterator_type - nii_basic_string"));
 			}
 			else {
@@ -2987,30 +2988,30 @@ namespace mse {
 		}
 		Tnii_basic_string_ss_const_iterator_type operator-(difference_type n) const { return ((*this) + (-n)); }
 		difference_type operator-(const Tnii_basic_string_ss_const_iterator_type &rhs) const {
-			if (rhs.m_owner_cptr != (*this).m_owner_cptr) { MSE_THROW(nii_basic_string_range_error("invalid argument - difference_type operator-(const Tnii_basic_string_ss_const_iterator_type &rhs) const - nii_basic_string::Tnii_basic_string_ss_const_iterator_type")); }
+			if (check_policy_type::iterator_checks() && (rhs.m_owner_cptr != (*this).m_owner_cptr)) { MSE_THROW(nii_basic_string_range_error("invalid argument - difference_type operator-(const Tnii_basic_string_ss_const_iterator_type &rhs) const - nii_basic_string::Tnii_basic_string_ss_const_iterator_type")); }
 			auto retval = difference_type((*this).m_index) - difference_type(rhs.m_index);
 			assert(difference_type((*m_owner_cptr).size()) >= retval);
 			return retval;
 		}
 		const_reference operator*() const {
-			return (*m_owner_cptr).at(msev_as_a_size_t((*this).m_index));
+			return (*m_owner_cptr)[msev_as_a_size_t((*this).m_index)];
 		}
 		const_reference item() const { return operator*(); }
 		const_reference previous_item() const {
 			return (*m_owner_cptr).at(msev_as_a_size_t((*this).m_index - 1));
 		}
 		const_pointer operator->() const {
-			return std::addressof((*m_owner_cptr).at(msev_as_a_size_t((*this).m_index)));
+			return std::addressof((*m_owner_cptr)[msev_as_a_size_t((*this).m_index)]);
 		}
-		const_reference operator[](difference_type _Off) const { return (*m_owner_cptr).at(msev_as_a_size_t(difference_type(m_index) + _Off)); }
+		const_reference operator[](difference_type _Off) const { return (*m_owner_cptr)[msev_as_a_size_t(difference_type(m_index) + _Off)]; }
 
 		bool operator==(const Tnii_basic_string_ss_const_iterator_type& _Right_cref) const {
-			if (this->m_owner_cptr != _Right_cref.m_owner_cptr) { MSE_THROW(nii_basic_string_range_error("invalid argument - Tnii_basic_string_ss_const_iterator_type& operator==(const Tnii_basic_string_ss_const_iterator_type& _Right) - Tnii_basic_string_ss_const_iterator_type - nii_basic_string")); }
+			if (check_policy_type::iterator_checks() && (this->m_owner_cptr != _Right_cref.m_owner_cptr)) { MSE_THROW(nii_basic_string_range_error("invalid argument - Tnii_basic_string_ss_const_iterator_type& operator==(const Tnii_basic_string_ss_const_iterator_type& _Right) - Tnii_basic_string_ss_const_iterator_type - nii_basic_string")); }
 			return (_Right_cref.m_index == m_index);
 		}
 		bool operator!=(const Tnii_basic_string_ss_const_iterator_type& _Right_cref) const { return (!(_Right_cref == (*this))); }
 		bool operator<(const Tnii_basic_string_ss_const_iterator_type& _Right) const {
-			if (this->m_owner_cptr != _Right.m_owner_cptr) { MSE_THROW(nii_basic_string_range_error("invalid argument - Tnii_basic_string_ss_const_iterator_type& operator<(const Tnii_basic_string_ss_const_iterator_type& _Right) - Tnii_basic_string_ss_const_iterator_type - nii_basic_string")); }
+			if (check_policy_type::iterator_checks() && (this->m_owner_cptr != _Right.m_owner_cptr)) { MSE_THROW(nii_basic_string_range_error("invalid argument - Tnii_basic_string_ss_const_iterator_type& operator<(const Tnii_basic_string_ss_const_iterator_type& _Right) - Tnii_basic_string_ss_const_iterator_type - nii_basic_string")); }
 			return (m_index < _Right.m_index);
 		}
 		bool operator<=(const Tnii_basic_string_ss_const_iterator_type& _Right) const { return (((*this) < _Right) || (_Right == (*this))); }
@@ -3076,6 +3077,7 @@ namespace mse {
 		typedef typename base_class::reference reference;
 		typedef const pointer const_pointer;
 		typedef const reference const_reference;
+		typedef typename mse::impl::check_policy_of<_TStateMutex>::type check_policy_type;
 
 		//template<class = typename std::enable_if<std::is_default_constructible<_TBasicStringPointer>::value, void>::type>
 		template<class _TBasicStringPointer2 = _TBasicStringPointer, class = typename std::enable_if<(std::is_same<_TBasicStringPointer2, _TBasicStringPointer>::value) && (std::is_default_constructible<_TBasicStringPointer>::value), void>::type>
@@ -3122,7 +3124,7 @@ namespace mse {
 			m_index = msev_size_t(m_owner_ptr->size());
 		}
 		void set_to_next() {
-			if (points_to_an_item()) {
+			if ((!check_policy_type::iterator_checks()) || points_to_an_item()) {
 				m_index += 1;
 				assert(m_owner_ptr->size() >= m_index);
 			}
@@ -3131,7 +3133,7 @@ namespace mse {
 			}
 		}
 		void set_to_previous() {
-			if (has_previous()) {
+			if ((!check_policy_type::iterator_checks()) || has_previous()) {
 				m_index -= 1;
 			}
 			else {
@@ -3144,7 +3146,7 @@ namespace mse {
 		Tnii_basic_string_ss_iterator_type operator--(int) { Tnii_basic_string_ss_iterator_type _Tmp = *this; (*this).set_to_previous(); return (_Tmp); }
 		void advance(difference_type n) {
 			auto new_index = msev_int(m_index) + n;
-			if ((0 > new_index) || (m_owner_ptr->size() < msev_size_t(new_index))) {
+			if (check_policy_type::iterator_checks() && ((0 > new_index) || (m_owner_ptr->size() < msev_size_t(new_index)))) {
 				MSE_THROW(nii_basic_string_range_error("index out of range - void advance(difference_type n) - Tnii_basic_string_ss_iterator_type - nii_basic_string"));
 			}
 			else {
@@ -3161,17 +3163,17 @@ namespace mse {
 		}
 		Tnii_basic_string_ss_iterator_type operator-(difference_type n) const { return ((*this) + (-n)); }
 		difference_type operator-(const Tnii_basic_string_ss_iterator_type& rhs) const {
-			if (rhs.m_owner_ptr != (*this).m_owner_ptr) { MSE_THROW(nii_basic_string_range_error("invalid argument - difference_type operator-(const Tnii_basic_string_ss_iterator_type& rhs) const - nii_basic_string::Tnii_basic_string_ss_iterator_type")); }
+			if (check_policy_type::iterator_checks() && (rhs.m_owner_ptr != (*this).m_owner_ptr)) { MSE_THROW(nii_basic_string_range_error("invalid argument - difference_type operator-(const Tnii_basic_string_ss_iterator_type& rhs) const - nii_basic_string::Tnii_basic_string_ss_iterator_type")); }
 			auto retval = difference_type((*this).m_index) - difference_type(rhs.m_index);
 			assert(difference_type((*m_owner_ptr).size()) >= retval);
 			return retval;
 		}
 		reference operator*() const {
-			return (*m_owner_ptr).at(msev_as_a_size_t((*this).m_index));
+			return (*m_owner_ptr)[msev_as_a_size_t((*this).m_index)];
 		}
 		reference item() const { return operator*(); }
 		reference previous_item() const {
-			if ((*this).has_previous()) {
+			if ((!check_policy_type::iterator_checks()) || (*this).has_previous()) {
 				return (*m_owner_ptr)[m_index - 1];
 			}
 			else {
@@ -3179,17 +3181,17 @@ namespace mse {
 			}
 		}
 		pointer operator->() const {
-			return std::addressof((*m_owner_ptr).at(msev_as_a_size_t((*this).m_index)));
+			return std::addressof((*m_owner_ptr)[msev_as_a_size_t((*this).m_index)]);
 		}
-		reference operator[](difference_type _Off) const { return (*m_owner_ptr).at(msev_as_a_size_t(difference_type(m_index) + _Off)); }
+		reference operator[](difference_type _Off) const { return (*m_owner_ptr)[msev_as_a_size_t(difference_type(m_index) + _Off)]; }
 
 		bool operator==(const Tnii_basic_string_ss_iterator_type& _Right_cref) const {
-			if (this->m_owner_ptr != _Right_cref.m_owner_ptr) { MSE_THROW(nii_basic_string_range_error("invalid argument - Tnii_basic_string_ss_iterator_type& operator==(const Tnii_basic_string_ss_iterator_type& _Right) - Tnii_basic_string_ss_iterator_type - nii_basic_string")); }
+			if (check_policy_type::iterator_checks() && (this->m_owner_ptr != _Right_cref.m_owner_ptr)) { MSE_THROW(nii_basic_string_range_error("invalid argument - Tnii_basic_string_ss_iterator_type& operator==(const Tnii_basic_string_ss_iterator_type& _Right) - Tnii_basic_string_ss_iterator_type - nii_basic_string")); }
 			return (_Right_cref.m_index == m_index);
 		}
 		bool operator!=(const Tnii_basic_string_ss_iterator_type& _Right_cref) const { return (!(_Right_cref == (*this))); }
 		bool operator<(const Tnii_basic_string_ss_iterator_type& _Right) const {
-			if (this->m_owner_ptr != _Right.m_owner_ptr) { MSE_THROW(nii_basic_string_range_error("invalid argument - Tnii_basic_string_ss_iterator_type& operator<(const Tnii_basic_string_ss_iterator_type& _Right) - Tnii_basic_string_ss_iterator_type - nii_basic_string")); }
+			if (check_policy_type::iterator_checks() && (this->m_owner_ptr != _Right.m_owner_ptr)) { MSE_THROW(nii_basic_string_range_error("invalid argument - Tnii_basic_string_ss_iterator_type& operator<(const Tnii_basic_string_ss_iterator_type& _Right) - Tnii_basic_string_ss_iterator_type - nii_basic_string")); }
 			return (m_index < _Right.m_index);
 		}
 		bool operator<=(const Tnii_basic_string_ss_iterator_type& _Right) const { return (((*this) < _Right) || (_Right == (*this))); }
@@ -3509,6 +3511,12 @@ namespace mse {
 		nii_basic_string(const std_basic_string& _X) : m_basic_string(_X) { /*m_debug_size = size();*/ }
 		nii_basic_string(_Myt&& _X) : m_basic_string(std::forward<decltype(_X.m_basic_string)>(_X.m_basic_string)) { /*m_debug_size = size();*/ }
 		nii_basic_string(const _Myt& _X) : m_basic_string(_X.contained_basic_string()) { /*m_debug_size = size();*/ }
+		/* Conversion from strings that differ only in their check policy. Implicit conversion is only supported by move,
+		so that a copy isn't made inadvertently at, for example, an API boundary. */
+		template<class _TStateMutex2, class = typename std::enable_if<mse::impl::differ_only_by_check_policy<_TStateMutex2, _TStateMutex>::value>::type>
+		nii_basic_string(nii_basic_string<_Ty, _Traits, _A, _TStateMutex2>&& _X) : m_basic_string(std::forward<decltype(_X.m_basic_string)>(_X.m_basic_string)) {}
+		template<class _TStateMutex2, class = typename std::enable_if<mse::impl::differ_only_by_check_policy<_TStateMutex2, _TStateMutex>::value>::type>
+		explicit nii_basic_string(const nii_basic_string<_Ty, _Traits, _A, _TStateMutex2>& _X) : m_basic_string(_X.contained_basic_string()) {}
 		typedef typename std_basic_string::const_iterator _It;
 		/* Note that safety cannot be guaranteed when using these constructors that take unsafe typename base_class::iterator and/or pointer parameters. */
 		nii_basic_string(_It _F, _It _L, const _A& _Al = _A()) : m_basic_string(_F, _L, _Al) { /*m_debug_size = size();*/ }
@@ -3563,6 +3571,12 @@ namespace mse {
 			m_basic_string.operator=(_X.contained_basic_string());
 			return (*this);
 		}
+		template<class _TStateMutex2, class = typename std::enable_if<mse::impl::differ_only_by_check_policy<_TStateMutex2, _TStateMutex>::value>::type>
+		_Myt& operator=(nii_basic_string<_Ty, _Traits, _A, _TStateMutex2>&& _X) {
+			std::lock_guard<decltype(m_structure_change_mutex)> lock1(m_structure_change_mutex);
+			m_basic_string.operator=(std::forward<std_basic_string>(_X.contained_basic_string()));
+			return (*this);
+		}
 
 		~nii_basic_string() {
 			mse::impl::destructor_lock_guard1<decltype(m_structure_change_mutex)> lock1(m_structure_change_mutex);
@@ -3591,10 +3605,16 @@ namespace mse {
 			m_basic_string.resize(msev_as_a_size_t(_N), _X);
 		}
 		typename std_basic_string::const_reference operator[](msev_size_t _P) const {
-			return (*this).at(msev_as_a_size_t(_P));
+			if (mse::impl::check_policy_of<_TStateMutex>::type::element_access_checks()) {
+				return (*this).at(msev_as_a_size_t(_P));
+			}
+			return m_basic_string[msev_as_a_size_t(_P)];
 		}
 		typename std_basic_string::reference operator[](msev_size_t _P) {
-			return (*this).at(msev_as_a_size_t(_P));
+			if (mse::impl::check_policy_of<_TStateMutex>::type::element_access_checks()) {
+				return (*this).at(msev_as_a_size_t(_P));
+			}
+			return m_basic_string[msev_as_a_size_t(_P)];
 		}
 		typename std_basic_string::reference front() {	// return first element of mutable sequence
 			if (0 == (*this).size()) { MSE_THROW(nii_basic_string_range_error("front() on empty - typename std_basic_string::reference front() - nii_basic_string")); }
@@ -3826,11 +3846,13 @@ namespace mse {
 
 		reference at(msev_size_t _Pos)
 		{	// subscript mutable sequence with checking
+			MSE_STATS_INCREMENT(bounds_check);
 			return m_basic_string.at(msev_as_a_size_t(_Pos));
 		}
 
 		const_reference at(msev_size_t _Pos) const
 		{	// subscript nonmutable sequence with checking
+			MSE_STATS_INCREMENT(bounds_check);
 			return m_basic_string.at(msev_as_a_size_t(_Pos));
 		}
 
@@ -3849,7 +3871,12 @@ namespace mse {
 
 		value_type *data() _NOEXCEPT
 		{	// return pointer to mutable data basic_string
+#ifdef MSE_HAS_CXX17
 			return m_basic_string.data();
+#else // MSE_HAS_CXX17
+			/* Prior to C++17, std::basic_string<>::data() only returns a const pointer. */
+			return std::addressof(m_basic_string[0]);
+#endif // MSE_HAS_CXX17
 		}
 
 		const value_type *data() const _NOEXCEPT
@@ -5181,6 +5208,7 @@ namespace mse {
 		friend /*class */xscope_ss_const_iterator_type;
 		friend /*class */xscope_ss_iterator_type;
 		friend class us::msebasic_string<_Ty, _Traits, _A, _TStateMutex>;
+		template<class _Ty2, class _Traits2, class _A2, class _TStateMutex2> friend class nii_basic_string;
 
 		friend struct std::hash<nii_basic_string>;
 		template<class _Ty2, class _Traits2/* = std::char_traits<_Ty2>*/, class _A2/* = std::allocator<_Ty2>*/, class _TStateMutex2/* = default_state_mutex*/>
@@ -5568,6 +5596,11 @@ namespace mse {
 	using nii_wstring = nii_basic_string<wchar_t>;
 	using nii_u16string = nii_basic_string<char16_t>;
 	using nii_u32string = nii_basic_string<char32_t>;
+	/* An nii_basic_string<> with the given check policy. (See msecheckpolicy.h.) */
+	template<class _Ty, class _TCheckPolicy, class _Traits = std::char_traits<_Ty>, class _A = std::allocator<_Ty> >
+	using nii_basic_string_cp = nii_basic_string<_Ty, _Traits, _A, mse::TCheckPolicyStateMutex<_TCheckPolicy, default_state_mutex> >;
+	template<class _TCheckPolicy>
+	using nii_string_cp = nii_basic_string_cp<char, _TCheckPolicy>;
 
 	inline namespace literals {
 		inline namespace string_literals {
@@ -6892,6 +6925,7 @@ namespace mse {
 					apply_to_all_mm_iterator_shptrs(it_func_obj);
 				}
 				void shift_inclusive_range(msev_size_t start_index, msev_size_t end_index, msev_int shift) {
+					MSE_STATS_INCREMENT(mm_iterator_set_shift);
 					const std::function<void(std::shared_ptr<mm_const_iterator_type>&)> cit_func_obj = [start_index, end_index, shift](std::shared_ptr<mm_const_iterator_type>& a) { a->shift_inclusive_range(start_index, end_index, shift); };
 					apply_to_all_mm_const_iterator_shptrs(cit_func_obj);
 					const std::function<void(std::shared_ptr<mm_iterator_type>&)> it_func_obj = [start_index, end_index, shift](std::shared_ptr<mm_iterator_type>& a) { a->shift_inclusive_range(start_index, end_index, shift); };
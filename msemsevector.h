@@ -205,6 +205,9 @@ namespace mse {
 
 	template<class _Ty, class _A = std::allocator<_Ty>, class _TStateMutex = mse::non_thread_safe_shared_mutex>
 	using nii_vector = mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex>;
+	/* An nii_vector<> with the given check policy. (See msecheckpolicy.h.) */
+	template<class _Ty, class _TCheckPolicy, class _A = std::allocator<_Ty> >
+	using nii_vector_cp = mse::us::impl::gnii_vector<_Ty, _A, mse::TCheckPolicyStateMutex<_TCheckPolicy, mse::non_thread_safe_shared_mutex> >;
 
 	namespace us {
 		template<class _Ty, class _A/* = std::allocator<_Ty>*/, class _TStateMutex/* = mse::non_thread_safe_shared_mutex*/>
@@ -233,6 +236,7 @@ namespace mse {
 		typedef typename base_class::reference reference;
 		typedef const pointer const_pointer;
 		typedef const reference const_reference;
+		typedef typename mse::impl::check_policy_of<_TStateMutex>::type check_policy_type;
 
 		//template<class = typename std::enable_if<std::is_default_constructible<_TVectorConstPointer>::value, void>::type>
 		template<class _TVectorConstPointer2 = _TVectorConstPointer, class = typename std::enable_if<(std::is_same<_TVectorConstPointer2, _TVectorConstPointer>::value) && (std::is_default_constructible<_TVectorConstPointer>::value), void>::type>
@@ -284,7 +288,7 @@ namespace mse {
 			m_index = m_owner_cptr->size();
 		}
 		void set_to_next() {
-			if (points_to_an_item()) {
+			if ((!check_policy_type::iterator_checks()) || points_to_an_item()) {
 				m_index += 1;
 				assert(m_owner_cptr->size() >= m_index);
 			}
@@ -293,7 +297,7 @@ namespace mse {
 			}
 		}
 		void set_to_previous() {
-			if (has_previous()) {
+			if ((!check_policy_type::iterator_checks()) || has_previous()) {
 				m_index -= 1;
 			}
 			else {
@@ -306,7 +310,7 @@ namespace mse {
 		Tgnii_vector_ss_const_iterator_type operator--(int) { Tgnii_vector_ss_const_iterator_type _Tmp = *this; (*this).set_to_previous(); return (_Tmp); }
 		void advance(difference_type n) {
 			auto new_index = msev_int(m_index) + n;
-			if ((0 > new_index) || (m_owner_cptr->size() < msev_size_t(new_index))) {
+			if (check_policy_type::iterator_checks() && ((0 > new_index) || (m_owner_cptr->size() < msev_size_t(new_index)))) {
 				MSE_THROW(gnii_vector_range_error("index out of range - void advance(difference_type n) - Tgnii_vector_ss_const_iterator_type - gnii_vector"));
 			}
 			else {
@@ -323,30 +327,30 @@ namespace mse {
 		}
 		Tgnii_vector_ss_const_iterator_type operator-(difference_type n) const { return ((*this) + (-n)); }
 		difference_type operator-(const Tgnii_vector_ss_const_iterator_type &rhs) const {
-			if (rhs.m_owner_cptr != (*this).m_owner_cptr) { MSE_THROW(gnii_vector_range_error("invalid argument - difference_type operator-(const Tgnii_vector_ss_const_iterator_type &rhs) const - gnii_vector::Tgnii_vector_ss_const_iterator_type")); }
+			if (check_policy_type::iterator_checks() && (rhs.m_owner_cptr != (*this).m_owner_cptr)) { MSE_THROW(gnii_vector_range_error("invalid argument - difference_type operator-(const Tgnii_vector_ss_const_iterator_type &rhs) const - gnii_vector::Tgnii_vector_ss_const_iterator_type")); }
 			auto retval = difference_type((*this).m_index) - difference_type(rhs.m_index);
 			assert(difference_type((*m_owner_cptr).size()) >= retval);
 			return retval;
 		}
 		const_reference operator*() const {
-			return (*m_owner_cptr).at(msev_as_a_size_t((*this).m_index));
+			return (*m_owner_cptr)[msev_as_a_size_t((*this).m_index)];
 		}
 		const_reference item() const { return operator*(); }
 		const_reference previous_item() const {
 			return (*m_owner_cptr).at(msev_as_a_size_t((*this).m_index - 1));
 		}
 		const_pointer operator->() const {
-			return std::addressof((*m_owner_cptr).at(msev_as_a_size_t((*this).m_index)));
+			return std::addressof((*m_owner_cptr)[msev_as_a_size_t((*this).m_index)]);
 		}
-		const_reference operator[](difference_type _Off) const { return (*m_owner_cptr).at(msev_as_a_size_t(difference_type(m_index) + _Off)); }
+		const_reference operator[](difference_type _Off) const { return (*m_owner_cptr)[msev_as_a_size_t(difference_type(m_index) + _Off)]; }
 
 		bool operator==(const Tgnii_vector_ss_const_iterator_type& _Right_cref) const {
-			if (this->m_owner_cptr != _Right_cref.m_owner_cptr) { MSE_THROW(gnii_vector_range_error("invalid argument - Tgnii_vector_ss_const_iterator_type& operator==(const Tgnii_vector_ss_const_iterator_type& _Right) - Tgnii_vector_ss_const_iterator_type - gnii_vector")); }
+			if (check_policy_type::iterator_checks() && (this->m_owner_cptr != _Right_cref.m_owner_cptr)) { MSE_THROW(gnii_vector_range_error("invalid argument - Tgnii_vector_ss_const_iterator_type& operator==(const Tgnii_vector_ss_const_iterator_type& _Right) - Tgnii_vector_ss_const_iterator_type - gnii_vector")); }
 			return (_Right_cref.m_index == m_index);
 		}
 		bool operator!=(const Tgnii_vector_ss_const_iterator_type& _Right_cref) const { return (!(_Right_cref == (*this))); }
 		bool operator<(const Tgnii_vector_ss_const_iterator_type& _Right) const {
-			if (this->m_owner_cptr != _Right.m_owner_cptr) { MSE_THROW(gnii_vector_range_error("invalid argument - Tgnii_vector_ss_const_iterator_type& operator<(const Tgnii_vector_ss_const_iterator_type& _Right) - Tgnii_vector_ss_const_iterator_type - gnii_vector")); }
+			if (check_policy_type::iterator_checks() && (this->m_owner_cptr != _Right.m_owner_cptr)) { MSE_THROW(gnii_vector_range_error("invalid argument - Tgnii_vector_ss_const_iterator_type& operator<(const Tgnii_vector_ss_const_iterator_type& _Right) - Tgnii_vector_ss_const_iterator_type - gnii_vector")); }
 			return (m_index < _Right.m_index);
 		}
 		bool operator<=(const Tgnii_vector_ss_const_iterator_type& _Right) const { return (((*this) < _Right) || (_Right == (*this))); }
@@ -415,6 +419,7 @@ namespace mse {
 		typedef typename base_class::reference reference;
 		typedef const pointer const_pointer;
 		typedef const reference const_reference;
+		typedef typename mse::impl::check_policy_of<_TStateMutex>::type check_policy_type;
 
 		//template<class = typename std::enable_if<std::is_default_constructible<_TVectorPointer>::value, void>::type>
 		template<class _TVectorPointer2 = _TVectorPointer, class = typename std::enable_if<(std::is_same<_TVectorPointer2, _TVectorPointer>::value) && (std::is_default_constructible<_TVectorPointer>::value), void>::type>
@@ -461,7 +466,7 @@ namespace mse {
 			m_index = msev_size_t(m_owner_ptr->size());
 		}
 		void set_to_next() {
-			if (points_to_an_item()) {
+			if ((!check_policy_type::iterator_checks()) || points_to_an_item()) {
 				m_index += 1;
 				assert(m_owner_ptr->size() >= m_index);
 			}
@@ -470,7 +475,7 @@ namespace mse {
 			}
 		}
 		void set_to_previous() {
-			if (has_previous()) {
+			if ((!check_policy_type::iterator_checks()) || has_previous()) {
 				m_index -= 1;
 			}
 			else {
@@ -483,7 +488,7 @@ namespace mse {
 		Tgnii_vector_ss_iterator_type operator--(int) { Tgnii_vector_ss_iterator_type _Tmp = *this; (*this).set_to_previous(); return (_Tmp); }
 		void advance(difference_type n) {
 			auto new_index = msev_int(m_index) + n;
-			if ((0 > new_index) || (m_owner_ptr->size() < msev_size_t(new_index))) {
+			if (check_policy_type::iterator_checks() && ((0 > new_index) || (m_owner_ptr->size() < msev_size_t(new_index)))) {
 				MSE_THROW(gnii_vector_range_error("index out of range - void advance(difference_type n) - Tgnii_vector_ss_iterator_type - gnii_vector"));
 			}
 			else {
@@ -500,17 +505,17 @@ namespace mse {
 		}
 		Tgnii_vector_ss_iterator_type operator-(difference_type n) const { return ((*this) + (-n)); }
 		difference_type operator-(const Tgnii_vector_ss_iterator_type& rhs) const {
-			if (rhs.m_owner_ptr != (*this).m_owner_ptr) { MSE_THROW(gnii_vector_range_error("invalid argument - difference_type operator-(const Tgnii_vector_ss_iterator_type& rhs) const - gnii_vector::Tgnii_vector_ss_iterator_type")); }
+			if (check_policy_type::iterator_checks() && (rhs.m_owner_ptr != (*this).m_owner_ptr)) { MSE_THROW(gnii_vector_range_error("invalid argument - difference_type operator-(const Tgnii_vector_ss_iterator_type& rhs) const - gnii_vector::Tgnii_vector_ss_iterator_type")); }
 			auto retval = difference_type((*this).m_index) - difference_type(rhs.m_index);
 			assert(difference_type((*m_owner_ptr).size()) >= retval);
 			return retval;
 		}
 		reference operator*() const {
-			return (*m_owner_ptr).at(msev_as_a_size_t((*this).m_index));
+			return (*m_owner_ptr)[msev_as_a_size_t((*this).m_index)];
 		}
 		reference item() const { return operator*(); }
 		reference previous_item() const {
-			if ((*this).has_previous()) {
+			if ((!check_policy_type::iterator_checks()) || (*this).has_previous()) {
 				return (*m_owner_ptr)[m_index - 1];
 			}
 			else {
@@ -518,17 +523,17 @@ namespace mse {
 			}
 		}
 		pointer operator->() const {
-			return std::addressof((*m_owner_ptr).at(msev_as_a_size_t((*this).m_index)));
+			return std::addressof((*m_owner_ptr)[msev_as_a_size_t((*this).m_index)]);
 		}
-		reference operator[](difference_type _Off) const { return (*m_owner_ptr).at(msev_as_a_size_t(difference_type(m_index) + _Off)); }
+		reference operator[](difference_type _Off) const { return (*m_owner_ptr)[msev_as_a_size_t(difference_type(m_index) + _Off)]; }
 
 		bool operator==(const Tgnii_vector_ss_iterator_type& _Right_cref) const {
-			if (this->m_owner_ptr != _Right_cref.m_owner_ptr) { MSE_THROW(gnii_vector_range_error("invalid argument - Tgnii_vector_ss_iterator_type& operator==(const Tgnii_vector_ss_iterator_type& _Right) - Tgnii_vector_ss_iterator_type - gnii_vector")); }
+			if (check_policy_type::iterator_checks() && (this->m_owner_ptr != _Right_cref.m_owner_ptr)) { MSE_THROW(gnii_vector_range_error("invalid argument - Tgnii_vector_ss_iterator_type& operator==(const Tgnii_vector_ss_iterator_type& _Right) - Tgnii_vector_ss_iterator_type - gnii_vector")); }
 			return (_Right_cref.m_index == m_index);
 		}
 		bool operator!=(const Tgnii_vector_ss_iterator_type& _Right_cref) const { return (!(_Right_cref == (*this))); }
 		bool operator<(const Tgnii_vector_ss_iterator_type& _Right) const {
-			if (this->m_owner_ptr != _Right.m_owner_ptr) { MSE_THROW(gnii_vector_range_error("invalid argument - Tgnii_vector_ss_iterator_type& operator<(const Tgnii_vector_ss_iterator_type& _Right) - Tgnii_vector_ss_iterator_type - gnii_vector")); }
+			if (check_policy_type::iterator_checks() && (this->m_owner_ptr != _Right.m_owner_ptr)) { MSE_THROW(gnii_vector_range_error("invalid argument - Tgnii_vector_ss_iterator_type& operator<(const Tgnii_vector_ss_iterator_type& _Right) - Tgnii_vector_ss_iterator_type - gnii_vector")); }
 			return (m_index < _Right.m_index);
 		}
 		bool operator<=(const Tgnii_vector_ss_iterator_type& _Right) const { return (((*this) < _Right) || (_Right == (*this))); }
@@ -846,6 +851,12 @@ namespace mse {
 				gnii_vector(const std_vector& _X) : m_vector(_X) { /*m_debug_size = size();*/ }
 				gnii_vector(_Myt&& _X) : m_vector(std::forward<decltype(_X.contained_vector())>(_X.contained_vector())) { /*m_debug_size = size();*/ }
 				gnii_vector(const _Myt& _X) : m_vector(_X.contained_vector()) { /*m_debug_size = size();*/ }
+				/* Conversion from vectors that differ only in their check policy. Implicit conversion is only supported by
+				move, so that a (potentially expensive) copy isn't made inadvertently at, for example, an API boundary. */
+				template<class _TStateMutex2, class = typename std::enable_if<mse::impl::differ_only_by_check_policy<_TStateMutex2, _TStateMutex>::value>::type>
+				gnii_vector(gnii_vector<_Ty, _A, _TStateMutex2>&& _X) : m_vector(std::forward<decltype(_X.contained_vector())>(_X.contained_vector())) {}
+				template<class _TStateMutex2, class = typename std::enable_if<mse::impl::differ_only_by_check_policy<_TStateMutex2, _TStateMutex>::value>::type>
+				explicit gnii_vector(const gnii_vector<_Ty, _A, _TStateMutex2>& _X) : m_vector(_X.contained_vector()) {}
 				typedef typename std_vector::const_iterator _It;
 				/* Note that safety cannot be guaranteed when using these constructors that take unsafe typename base_class::iterator and/or pointer parameters. */
 				gnii_vector(_It _F, _It _L, const _A& _Al = _A()) : m_vector(_F, _L, _Al) { /*m_debug_size = size();*/ }
@@ -875,6 +886,12 @@ namespace mse {
 					m_vector.operator=(_X.contained_vector());
 					return (*this);
 				}
+				template<class _TStateMutex2, class = typename std::enable_if<mse::impl::differ_only_by_check_policy<_TStateMutex2, _TStateMutex>::value>::type>
+				_Myt& operator=(gnii_vector<_Ty, _A, _TStateMutex2>&& _X) {
+					std::lock_guard<decltype(m_structure_change_mutex)> lock1(m_structure_change_mutex);
+					m_vector.operator=(std::forward<std_vector>(_X.contained_vector()));
+					return (*this);
+				}
 
 				~gnii_vector() {
 					mse::impl::destructor_lock_guard1<decltype(m_structure_change_mutex)> lock1(m_structure_change_mutex);
@@ -904,10 +921,16 @@ namespace mse {
 					m_vector.resize(msev_as_a_size_t(_N), _X);
 				}
 				typename std_vector::const_reference operator[](msev_size_t _P) const {
-					return (*this).at(msev_as_a_size_t(_P));
+					if (mse::impl::check_policy_of<_TStateMutex>::type::element_access_checks()) {
+						return (*this).at(msev_as_a_size_t(_P));
+					}
+					return m_vector[msev_as_a_size_t(_P)];
 				}
 				typename std_vector::reference operator[](msev_size_t _P) {
-					return (*this).at(msev_as_a_size_t(_P));
+					if (mse::impl::check_policy_of<_TStateMutex>::type::element_access_checks()) {
+						return (*this).at(msev_as_a_size_t(_P));
+					}
+					return m_vector[msev_as_a_size_t(_P)];
 				}
 				typename std_vector::reference front() {	// return first element of mutable sequence
 					if (0 == (*this).size()) { MSE_THROW(gnii_vector_range_error("front() on empty - typename std_vector::reference front() - gnii_vector")); }
@@ -1038,11 +1061,13 @@ namespace mse {
 
 				reference at(msev_size_t _Pos)
 				{	// subscript mutable sequence with checking
+					MSE_STATS_INCREMENT(bounds_check);
 					return m_vector.at(msev_as_a_size_t(_Pos));
 				}
 
 				const_reference at(msev_size_t _Pos) const
 				{	// subscript nonmutable sequence with checking
+					MSE_STATS_INCREMENT(bounds_check);
 					return m_vector.at(msev_as_a_size_t(_Pos));
 				}
 
@@ -1707,7 +1732,8 @@ namespace mse {
 				/* The "mutability" of m_structure_change_mutex is not actually required or utilized by this class, and thus
 				doesn't compromise the safety of sharing this class among asynchronous thread. The mutability is utilized by
 				derived (friend) classes (that will identify themselves as not safely shareable). */
-				mutable _TStateMutex m_structure_change_mutex;
+				typedef mse::stats::impl::TCountedMutex<_TStateMutex, mse::stats::event_t::structure_change_lock> structure_change_mutex_t;
+				mutable structure_change_mutex_t m_structure_change_mutex;
 
 				friend /*class */xscope_ss_const_iterator_type;
 				friend /*class */xscope_ss_iterator_type;
@@ -1779,7 +1805,7 @@ namespace mse {
 
 				private:
 					mse::TXScopeItemFixedConstPointer<gnii_vector<_Ty, _A, _TStateMutex> > m_stored_ptr;
-					std::shared_lock<_TStateMutex> m_shared_lock;
+					std::shared_lock<typename gnii_vector<_Ty, _A, _TStateMutex>::structure_change_mutex_t> m_shared_lock;
 				};
 			}
 		}
@@ -1808,7 +1834,7 @@ namespace mse {
 
 			private:
 				mse::TXScopeItemFixedPointer<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex> > m_stored_ptr;
-				std::shared_lock<_TStateMutex> m_shared_lock;
+				std::shared_lock<typename mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex>::structure_change_mutex_t> m_shared_lock;
 			};
 
 			/* For objects that are access controlled under an "exclusive writer" access policy, the object is immutable
@@ -3213,6 +3239,7 @@ namespace mse {
 					apply_to_all_mm_iterator_shptrs(it_func_obj);
 				}
 				void shift_inclusive_range(msev_size_t start_index, msev_size_t end_index, msev_int shift) {
+					MSE_STATS_INCREMENT(mm_iterator_set_shift);
 					const std::function<void(std::shared_ptr<mm_const_iterator_type>&)> cit_func_obj = [start_index, end_index, shift](std::shared_ptr<mm_const_iterator_type>& a) { a->shift_inclusive_range(start_index, end_index, shift); };
 					apply_to_all_mm_const_iterator_shptrs(cit_func_obj);
 					const std::function<void(std::shared_ptr<mm_iterator_type>&)> it_func_obj = [start_index, end_index, shift](std::shared_ptr<mm_iterator_type>& a) { a->shift_inclusive_range(start_index, end_index, shift); };
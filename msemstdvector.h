@@ -441,6 +441,7 @@ namespace mse {
 				const_iterator(const const_iterator& src_cref) : m_msevector_cshptr(src_cref.m_msevector_cshptr) {
 					(*this) = src_cref;
 				}
+				const_iterator& operator=(const const_iterator& _Right_cref) = default;
 				~const_iterator() {}
 				const typename _MV::ss_const_iterator_type& msevector_ss_const_iterator_type() const { return m_ss_const_iterator; }
 				typename _MV::ss_const_iterator_type& msevector_ss_const_iterator_type() { return m_ss_const_iterator; }
@@ -521,6 +522,7 @@ namespace mse {
 				iterator(const iterator& src_cref) : m_msevector_shptr(src_cref.m_msevector_shptr) {
 					(*this) = src_cref;
 				}
+				iterator& operator=(const iterator& _Right_cref) = default;
 				~iterator() {}
 				const typename _MV::ss_iterator_type& msevector_ss_iterator_type() const { return m_ss_iterator; }
 				typename _MV::ss_iterator_type& msevector_ss_iterator_type() { return m_ss_iterator; }
@@ -25,6 +25,9 @@ objects of a given type. */
 //include <typeinfo>      // std::bad_cast
 #include <stdexcept>
 #include <iostream>
+#include <atomic>
+#include <limits>
+#include <cstdint>
 
 #if defined(MSE_SAFER_SUBSTITUTES_DISABLED) || defined(MSE_SAFERPTR_DISABLED)
 #define MSE_NORADPOINTER_DISABLED
@@ -133,6 +136,14 @@ namespace mse {
 																			 library containers don't support const elements. */
 	template<typename _Ty> using TNoradFixedConstPointer = const _Ty* /*const*/;
 	template<typename _TROFLy> using TNoradObj = _TROFLy;
+	template<typename _Ty> using TCompactNoradPointer = _Ty * ;
+	template<typename _Ty> using TCompactNoradConstPointer = const _Ty*;
+	template<typename _Ty> using TCompactNoradNotNullPointer = _Ty * ;
+	template<typename _Ty> using TCompactNoradNotNullConstPointer = const _Ty*;
+	template<typename _Ty> using TCompactNoradFixedPointer = _Ty * /*const*/;
+	template<typename _Ty> using TCompactNoradFixedConstPointer = const _Ty* /*const*/;
+	template<typename _TROFLy> using TCompactNoradObj = _TROFLy;
+	typedef std::uint16_t compact_norad_refcounter_t;
 
 	template<typename _Ty> auto norad_fptr_to(_Ty&& _X) { return &_X; }
 	template<typename _Ty> auto norad_fptr_to(const _Ty& _X) { return &_X; }
@@ -195,6 +206,19 @@ namespace mse {
 	template<typename _Ty> using TNoradFixedConstPointer = TNDNoradFixedConstPointer<_Ty>;
 	template<typename _TROFLy> using TNoradObj = TNDNoradObj<_TROFLy>;
 
+	/* The "compact" norad types use a 16 bit (overflow checked) refcounter and don't add a virtual destructor to the
+	target type. This can significantly reduce the memory overhead for (arrays of) small objects. Note that, unlike
+	TNoradObj<>, a TCompactNoradObj<> should not be deleted via a pointer to a base class unless that base class has a
+	virtual destructor. */
+	typedef std::uint16_t compact_norad_refcounter_t;
+	template<typename _Ty> using TCompactNoradPointer = us::impl::TGNoradPointer<_Ty, compact_norad_refcounter_t>;
+	template<typename _Ty> using TCompactNoradConstPointer = us::impl::TGNoradConstPointer<_Ty, compact_norad_refcounter_t>;
+	template<typename _Ty> using TCompactNoradNotNullPointer = us::impl::TGNoradNotNullPointer<_Ty, compact_norad_refcounter_t>;
+	template<typename _Ty> using TCompactNoradNotNullConstPointer = us::impl::TGNoradNotNullConstPointer<_Ty, compact_norad_refcounter_t>;
+	template<typename _Ty> using TCompactNoradFixedPointer = us::impl::TGNoradFixedPointer<_Ty, compact_norad_refcounter_t>;
+	template<typename _Ty> using TCompactNoradFixedConstPointer = us::impl::TGNoradFixedConstPointer<_Ty, compact_norad_refcounter_t>;
+	template<typename _TROFLy> using TCompactNoradObj = us::impl::TGNoradObj<_TROFLy, compact_norad_refcounter_t>;
+
 	template<typename _Ty> auto norad_fptr_to(_Ty&& _X) { return ndnorad_fptr_to(std::forward<decltype(_X )>(_X)); }
 	template<typename _Ty> auto norad_fptr_to(const _Ty& _X) { return ndnorad_fptr_to(_X); }
 
@@ -501,7 +525,7 @@ namespace mse {
 				}
 				const TGNoradObj<_Ty, _TRefCounter>* operator->() const {
 					//if (!((*this).m_ptr)) { MSE_THROW(primitives_null_dereference_error("attempt to dereference null pointer - mse::TNoradPointer")); }
-					return (*this).m_ptr;
+					return static_cast<const TGNoradObj<_Ty, _TRefCounter>*>((*this).m_ptr);
 				}
 
 				/* This native pointer cast operator is just for compatibility with existing/legacy code and ideally should never be used. */
@@ -624,6 +648,59 @@ namespace mse {
 	>::type> \
     Derived(Args &&...args) : Base(std::forward<Args>(args)...) {}
 
+			namespace ns_gnorad {
+				/* Integral refcounter types narrower than int select the "compact" layout of TGNoradObj<>. In this layout the
+				(overflow checked) counter is small enough that it can often be placed in alignment padding (including, where the
+				ABI permits, the tail padding of the target type), and no virtual destructor (and so no vtable pointer) is added
+				to target types that don't already have one. */
+				template<typename _TRefCounter>
+				struct is_compact_refcounter : std::integral_constant<bool, (std::is_integral<_TRefCounter>::value) && (sizeof(_TRefCounter) < sizeof(int))> {};
+
+				template<typename _TRefCounter, typename = void>
+				struct is_atomic_refcounter : std::false_type {};
+				template<typename _TRefCounter>
+				struct is_atomic_refcounter<_TRefCounter, decltype((void)std::declval<_TRefCounter&>().fetch_add(1, std::memory_order_relaxed))> : std::true_type {};
+
+				class CVirtualDestructorBase {
+				public:
+					virtual ~CVirtualDestructorBase() {}
+				};
+
+				/* Atomic counters don't need to order any other memory operations when being incremented. Decrements are
+				"release" operations that synchronize with the "acquire" load in the target's destructor. */
+				template<typename _TRefCounter>
+				void increment_refcount_helper1(std::true_type, _TRefCounter& counter) { counter.fetch_add(1, std::memory_order_relaxed); }
+				template<typename _TRefCounter>
+				void increment_refcount_helper1(std::false_type, _TRefCounter& counter) {
+					if (is_compact_refcounter<_TRefCounter>::value && ((std::numeric_limits<_TRefCounter>::max)() == counter)) {
+						MSE_THROW(std::overflow_error("too many references to the same (compact) target object - mse::TGNoradObj"));
+					}
+					counter += 1;
+				}
+				template<typename _TRefCounter>
+				void increment_refcount(_TRefCounter& counter) {
+					MSE_STATS_INCREMENT(norad_refcount_op);
+					increment_refcount_helper1(typename is_atomic_refcounter<_TRefCounter>::type(), counter);
+				}
+
+				template<typename _TRefCounter>
+				void decrement_refcount_helper1(std::true_type, _TRefCounter& counter) { counter.fetch_sub(1, std::memory_order_release); }
+				template<typename _TRefCounter>
+				void decrement_refcount_helper1(std::false_type, _TRefCounter& counter) { counter -= 1; }
+				template<typename _TRefCounter>
+				void decrement_refcount(_TRefCounter& counter) {
+					MSE_STATS_INCREMENT(norad_refcount_op);
+					decrement_refcount_helper1(typename is_atomic_refcounter<_TRefCounter>::type(), counter);
+				}
+
+				template<typename _TRefCounter>
+				bool refcount_is_zero_helper1(std::true_type, const _TRefCounter& counter) { return (0 == counter.load(std::memory_order_acquire)); }
+				template<typename _TRefCounter>
+				bool refcount_is_zero_helper1(std::false_type, const _TRefCounter& counter) { return (0 == counter); }
+				template<typename _TRefCounter>
+				bool refcount_is_zero(const _TRefCounter& counter) { return refcount_is_zero_helper1(typename is_atomic_refcounter<_TRefCounter>::type(), counter); }
+			}
+
 		/* TGNoradObj is intended as a transparent wrapper for other classes/objects. The purpose is to track the number of
 		references targeting the object and verify that there are none outstanding when the object is destroyed. Note that
 		TGNoradObj can be used with objects allocated on the stack. */
@@ -631,6 +708,10 @@ namespace mse {
 			class TGNoradObj : public _TROFLy, public std::conditional<(!std::is_convertible<_TROFLy*, mse::us::impl::AsyncNotShareableAndNotPassableTagBase*>::value)
 				&& (!std::is_base_of<mse::us::impl::AsyncNotShareableAndNotPassableTagBase, _TROFLy>::value) && (std::is_arithmetic/*as opposed to say, atomic*/<_TRefCounter>::value)
 				, mse::us::impl::AsyncNotShareableAndNotPassableTagBase, mse::impl::TPlaceHolder_msepointerbasics<TGNoradObj<_TROFLy, _TRefCounter> > >::type
+				/* The destructor is virtual unless the "compact" layout is selected (in which case it's virtual only if the
+				target type's destructor is). */
+				, public std::conditional<(!ns_gnorad::is_compact_refcounter<_TRefCounter>::value) && (!std::has_virtual_destructor<_TROFLy>::value)
+				, ns_gnorad::CVirtualDestructorBase, mse::impl::TPlaceHolder2_msepointerbasics<TGNoradObj<_TROFLy, _TRefCounter> > >::type
 			{
 			public:
 				typedef _TROFLy base_class;
@@ -638,8 +719,8 @@ namespace mse {
 				MSE_NORAD_OBJ_USING(TGNoradObj, _TROFLy);
 				TGNoradObj(const TGNoradObj& _X) : _TROFLy(_X) {}
 				TGNoradObj(TGNoradObj&& _X) : _TROFLy(std::forward<decltype(_X)>(_X)) {}
-				virtual ~TGNoradObj() {
-					if (0 != m_counter) {
+				~TGNoradObj() {
+					if (!ns_gnorad::refcount_is_zero(m_counter)) {
 						/* It would be unsafe to allow this object to be destroyed as there are outstanding references to this object. */
 						std::cerr << "\n\nFatal Error: mse::TGNoradObj<> destructed with outstanding references \n\n";
 						assert(false); std::terminate();
@@ -661,8 +742,8 @@ namespace mse {
 				TGNoradFixedConstPointer<_TROFLy, _TRefCounter> mse_norad_fptr() const { return TGNoradFixedConstPointer<_TROFLy, _TRefCounter>(this); }
 
 				/* todo: make these private */
-				void increment_refcount() const { m_counter += 1; }
-				void decrement_refcount() const { m_counter -= 1; }
+				void increment_refcount() const { ns_gnorad::increment_refcount(m_counter); }
+				void decrement_refcount() const { ns_gnorad::decrement_refcount(m_counter); }
 
 			private:
 				mutable _TRefCounter m_counter = 0;
@@ -15,6 +15,9 @@
 #include <memory>
 #include <unordered_set>
 #include <functional>
+#include <cstdint>
+#include "msestats.h"
+#include "msecheckpolicy.h"
 
 //ifndef MSEPRIMITIVES_H
 #if __cplusplus >= 201703L
@@ -1376,6 +1379,119 @@ namespace mse {
 #pragma warning( disable : 4127 )
 #endif /*_MSC_VER*/
 
+			/* CPointerHashSet is a minimal open-addressing (linear probing) set of non-null pointers. It serves as the "slow
+			storage" of CSAllocRegistry. Unlike std::unordered_set<>, it doesn't do a heap allocation per element or chase
+			bucket node pointers on lookup, which matters when thousands of registered allocations are live at once. Removal
+			uses "backward shift" deletion, so no tombstones accumulate. */
+			class CPointerHashSet {
+			public:
+				typedef void* value_type;
+				typedef size_t size_type;
+
+				CPointerHashSet() {}
+				CPointerHashSet(const CPointerHashSet&) = delete;
+				CPointerHashSet& operator=(const CPointerHashSet&) = delete;
+				~CPointerHashSet() {}
+
+				size_type size() const { return m_size; }
+				bool empty() const { return (0 == m_size); }
+
+				/* Returns true if the pointer was not already present. */
+				bool insert(value_type ptr) {
+					assert(nullptr != ptr);
+					reserve(m_size + 1);
+					auto index = find_slot(ptr);
+					if (nullptr != m_slots[index]) {
+						return false;
+					}
+					m_slots[index] = ptr;
+					m_size += 1;
+					return true;
+				}
+				size_type erase(const void* ptr) {
+					if ((nullptr == ptr) || (0 == m_size)) { return 0; }
+					auto index = find_slot(ptr);
+					if (nullptr == m_slots[index]) {
+						return 0;
+					}
+					remove_slot(index);
+					m_size -= 1;
+					return 1;
+				}
+				bool contains(const void* ptr) const {
+					if ((nullptr == ptr) || (0 == m_size)) { return false; }
+					return (nullptr != m_slots[find_slot(ptr)]);
+				}
+				/* Ensures that the set can hold (at least) new_size elements without reallocating (and so without the
+				possibility of throwing). */
+				void reserve(size_type new_size) {
+					/* We keep the load factor at or below one half so that probe sequences stay short. */
+					if ((2 * new_size) <= m_capacity) { return; }
+					size_type new_capacity = (sc_min_capacity > m_capacity) ? sc_min_capacity : m_capacity;
+					while ((2 * new_size) > new_capacity) {
+						new_capacity *= 2;
+					}
+					rehash(new_capacity);
+				}
+
+			private:
+				static size_type hash_of(const void* ptr) {
+					/* The low bits of allocation addresses are mostly zero, so we mix them in from the high bits. */
+					auto h = size_type(reinterpret_cast<std::uintptr_t>(ptr));
+					h ^= (h >> 16);
+					h *= size_type(0x45d9f3b);
+					h ^= (h >> 16);
+					return h;
+				}
+				/* Returns the index of the slot holding the given pointer, or of the empty slot where it would go. */
+				size_type find_slot(const void* ptr) const {
+					const auto mask = m_capacity - 1;
+					auto index = hash_of(ptr) & mask;
+					while ((nullptr != m_slots[index]) && (ptr != m_slots[index])) {
+						index = (index + 1) & mask;
+					}
+					return index;
+				}
+				void remove_slot(size_type hole_index) {
+					const auto mask = m_capacity - 1;
+					auto index = hole_index;
+					while (true) {
+						index = (index + 1) & mask;
+						if (nullptr == m_slots[index]) {
+							break;
+						}
+						const auto home_index = hash_of(m_slots[index]) & mask;
+						/* If the element's "home" slot lies (cyclically) in (hole_index, index], it's already reachable
+						and stays put. Otherwise we move it into the hole. */
+						const bool stays = (hole_index <= index)
+							? ((hole_index < home_index) && (home_index <= index))
+							: ((hole_index < home_index) || (home_index <= index));
+						if (!stays) {
+							m_slots[hole_index] = m_slots[index];
+							hole_index = index;
+						}
+					}
+					m_slots[hole_index] = nullptr;
+				}
+				void rehash(size_type new_capacity) {
+					std::unique_ptr<value_type[]> new_slots(new value_type[new_capacity]());
+					std::unique_ptr<value_type[]> old_slots(std::move(m_slots));
+					auto old_capacity = m_capacity;
+					m_slots = std::move(new_slots);
+					m_capacity = new_capacity;
+					for (size_type i = 0; i < old_capacity; i += 1) {
+						if (nullptr != old_slots[i]) {
+							m_slots[find_slot(old_slots[i])] = old_slots[i];
+						}
+					}
+				}
+
+				MSE_CONSTEXPR static const size_type sc_min_capacity = 16;
+				std::unique_ptr<value_type[]> m_slots;
+				size_type m_capacity = 0;
+				size_type m_size = 0;
+			};
+
 			/* CSAllocRegistry essentially just maintains a list of all objects allocated by a registered "new" call and not (yet)
 			subsequently deallocated with a corresponding registered delete. */
 			class CSAllocRegistry {
@@ -1398,8 +1514,7 @@ namespace mse {
 						}
 						else {
 							/* Add the mapping to slow storage. */
-							std::unordered_set<CFS1Object>::value_type item(alloc_ptr);
-							m_pointer_set.insert(item);
+							m_pointer_set.insert(alloc_ptr);
 						}
 					}
 					return true;
@@ -1426,12 +1541,64 @@ namespace mse {
 				}
 				bool registerPointer(const void *alloc_ptr) { return (*this).registerPointer(const_cast<void *>(alloc_ptr)); }
 				bool unregisterPointer(const void *alloc_ptr) { return (*this).unregisterPointer(const_cast<void *>(alloc_ptr)); }
+
+				/* Registers a batch of allocations in one call. Batches that wouldn't fit in "fast storage 1" go straight to
+				"slow storage" (with a single up-front reservation) rather than cycling through fast storage. */
+				bool registerPointers(void * const * alloc_ptrs, size_t count) {
+					if (static_cast<size_t>(sc_fs1_max_objects - m_num_fs1_objects) >= count) {
+						for (size_t i = 0; i < count; i += 1) {
+							registerPointer(alloc_ptrs[i]);
+						}
+					}
+					else {
+						m_pointer_set.reserve(m_pointer_set.size() + count);
+						for (size_t i = 0; i < count; i += 1) {
+							if (nullptr != alloc_ptrs[i]) {
+								m_pointer_set.insert(alloc_ptrs[i]);
+							}
+						}
+					}
+					return true;
+				}
+				/* Unregisters a batch of allocations in one call. If any of the (non-null) given pointers is not registered,
+				then nothing is unregistered and false is returned. */
+				bool unregisterPointers(const void * const * alloc_ptrs, size_t count) {
+					/* Reserving up front ensures that restoring the registrations (in the failure case) can't throw. */
+					m_pointer_set.reserve(m_pointer_set.size() + count);
+					for (size_t i = 0; i < count; i += 1) {
+						if (!unregisterPointer(alloc_ptrs[i])) {
+							/* Note that a pointer appearing twice in the batch also ends up here. */
+							for (size_t j = 0; j < i; j += 1) {
+								if (nullptr != alloc_ptrs[j]) {
+									m_pointer_set.insert(const_cast<void *>(alloc_ptrs[j]));
+								}
+							}
+							return false;
+						}
+					}
+					return true;
+				}
+				bool containsPointer(const void *alloc_ptr) const {
+					if (nullptr == alloc_ptr) { return true; }
+					for (int i = (m_num_fs1_objects - 1); i >= 0; i -= 1) {
+						if (alloc_ptr == m_fs1_objects[i]) {
+							return true;
+						}
+					}
+					return m_pointer_set.contains(alloc_ptr);
+				}
+
 				void reserve_space_for_one_more() {
 					/* The purpose of this function is to ensure that the next call to registerPointer() won't
 					need to allocate more memory, and thus won't have any chance of throwing an exception due to
 					memory allocation failure. */
 					m_pointer_set.reserve(m_pointer_set.size() + 1);
 				}
+				void reserve(size_t count) {
+					/* Ensures that the next count calls to registerPointer() (or a registerPointers() call with count
+					elements) won't need to allocate memory. */
+					m_pointer_set.reserve(m_pointer_set.size() + count);
+				}
 
 				bool isEmpty() const { return ((0 == m_num_fs1_objects) && (0 == m_pointer_set.size())); }
 
@@ -1447,7 +1614,6 @@ namespace mse {
 				void moveObjectFromFastStorage1ToSlowStorage(int fs1_obj_index) {
 					auto& fs1_object_ref = m_fs1_objects[fs1_obj_index];
 					/* First we're gonna copy this object to slow storage. */
-					//std::unordered_set<CFS1Object>::value_type item(fs1_object_ref);
 					m_pointer_set.insert(fs1_object_ref);
 					/* Then we're gonna remove the object from fast storage */
 					removeObjectFromFastStorage1(fs1_obj_index);
@@ -1463,7 +1629,7 @@ namespace mse {
 				int m_num_fs1_objects = 0;
 
 				/* "slow storage" */
-				std::unordered_set<CFS1Object> m_pointer_set;
+				CPointerHashSet m_pointer_set;
 			};
 
 #ifdef _MSC_VER
@@ -88,43 +88,55 @@ namespace mse {
 #define MSE_TDP_VARIANT_STD_FORWARD(X)
 #endif // MSE_TDP_VARIANT_REQUIRE_MOVABILITY
 
-		template<typename... Ts>
-		struct tdp_variant_helper;
+		/* The alternatives are identified by a (one-based) integer index, rather than by std::type_index (which can
+		involve a string comparison), and the type-specific operations are dispatched via arrays of function pointers
+		rather than a chain of type comparisons. An index of zero indicates that no alternative is held. */
+		template<typename T, typename... Ts>
+		struct tdp_variant_type_id;
+
+		template<typename T>
+		struct tdp_variant_type_id<T> : std::integral_constant<size_t, 0> {};
 
-		template<typename F, typename... Ts>
-		struct tdp_variant_helper<F, Ts...> {
-			inline static void destroy(std::type_index id, void * data)
+		template<typename T, typename F, typename... Ts>
+		struct tdp_variant_type_id<T, F, Ts...> : std::integral_constant<size_t, std::is_same<T, F>::value ? 1
+			: ((0 == tdp_variant_type_id<T, Ts...>::value) ? 0 : 1 + tdp_variant_type_id<T, Ts...>::value)> {};
+
+		template<typename... Ts>
+		struct tdp_variant_helper {
+			template<typename F>
+			static void destroy_impl(void * data) { reinterpret_cast<F*>(data)->~F(); }
+			template<typename F>
+			static void move_impl(void * old_v, void * new_v) { ::new (new_v) F(MSE_TDP_VARIANT_STD_MOVE(*reinterpret_cast<F*>(old_v))); }
+			template<typename F>
+			static void copy_impl(const void * old_v, void * new_v) { ::new (new_v) F(*reinterpret_cast<const F*>(old_v)); }
+			static void null_destroy_impl(void *) {}
+			static void null_move_impl(void *, void *) {}
+			static void null_copy_impl(const void *, void *) {}
+
+			inline static void destroy(size_t id, void * data)
 			{
-				if (id == std::type_index(typeid(F)))
-					reinterpret_cast<F*>(data)->~F();
-				else
-					tdp_variant_helper<Ts...>::destroy(id, data);
+				typedef void(*function_pointer_t)(void *);
+				static const function_pointer_t s_functions[] = { null_destroy_impl, destroy_impl<Ts>... };
+				assert(sizeof(s_functions) / sizeof(s_functions[0]) > id);
+				s_functions[id](data);
 			}
 
-			inline static void move(std::type_index old_t, void * old_v, void * new_v)
+			inline static void move(size_t old_t, void * old_v, void * new_v)
 			{
-				if (old_t == std::type_index(typeid(F))) {
-					::new (new_v) F(MSE_TDP_VARIANT_STD_MOVE(*reinterpret_cast<F*>(old_v)));
-				}
-				else {
-					tdp_variant_helper<Ts...>::move(old_t, old_v, new_v);
-				}
+				typedef void(*function_pointer_t)(void *, void *);
+				static const function_pointer_t s_functions[] = { null_move_impl, move_impl<Ts>... };
+				assert(sizeof(s_functions) / sizeof(s_functions[0]) > old_t);
+				s_functions[old_t](old_v, new_v);
 			}
 
-			inline static void copy(std::type_index old_t, const void * old_v, void * new_v)
+			inline static void copy(size_t old_t, const void * old_v, void * new_v)
 			{
-				if (old_t == std::type_index(typeid(F)))
-					::new (new_v) F(*reinterpret_cast<const F*>(old_v));
-				else
-					tdp_variant_helper<Ts...>::copy(old_t, old_v, new_v);
+				typedef void(*function_pointer_t)(const void *, void *);
+				static const function_pointer_t s_functions[] = { null_copy_impl, copy_impl<Ts>... };
+				assert(sizeof(s_functions) / sizeof(s_functions[0]) > old_t);
+				s_functions[old_t](old_v, new_v);
 			}
 		};
-
-		template<> struct tdp_variant_helper<> {
-			inline static void destroy(std::type_index id, void * data) { }
-			inline static void move(std::type_index old_t, void * old_v, void * new_v) { }
-			inline static void copy(std::type_index old_t, const void * old_v, void * new_v) { }
-		};
 	}
 
 	template<typename... Ts>
@@ -137,11 +149,16 @@ namespace mse {
 
 		using helper_t = impl::tdp_variant_helper<Ts...>;
 
-		static inline std::type_index invalid_type() {
-			return std::type_index(typeid(void));
+		static inline size_t invalid_type() {
+			return 0;
+		}
+		template<typename T>
+		static inline size_t type_id_of() {
+			static_assert(0 != impl::tdp_variant_type_id<T, Ts...>::value, "the specified type is not one of the variant's alternatives - tdp_variant");
+			return impl::tdp_variant_type_id<T, Ts...>::value;
 		}
 
-		std::type_index type_id;
+		size_t type_id;
 		data_t data;
 	public:
 		tdp_variant() : type_id(invalid_type()) {   }
@@ -183,7 +200,7 @@ namespace mse {
 
 		template<typename T>
 		bool is() const {
-			return (type_id == std::type_index(typeid(T)));
+			return (0 != impl::tdp_variant_type_id<T, Ts...>::value) && (type_id == impl::tdp_variant_type_id<T, Ts...>::value);
 		}
 
 		bool valid() const {
@@ -198,14 +215,14 @@ namespace mse {
 			type_id = invalid_type();
 			helper_t::destroy(held_type_id, &data);
 			::new (&data) T(MSE_TDP_VARIANT_STD_FORWARD(Args) (args)...);
-			type_id = std::type_index(typeid(T));
+			type_id = type_id_of<T>();
 		}
 
 		template<typename T>
 		const T& get() const
 		{
 			// It is a dynamic_cast-like behaviour
-			if (type_id == std::type_index(typeid(T)))
+			if (is<T>())
 				return *reinterpret_cast<const T*>(&data);
 			else
 				MSE_THROW(std::bad_cast());
@@ -215,7 +232,7 @@ namespace mse {
 		T& get()
 		{
 			// It is a dynamic_cast-like behaviour
-			if (type_id == std::type_index(typeid(T)))
+			if (is<T>())
 				return *reinterpret_cast<T*>(&data);
 			else
 				MSE_THROW(std::bad_cast());
@@ -229,61 +246,139 @@ namespace mse {
 	};
 
 	namespace impl {
-		template<typename... Ts>
-		struct tdp_pointer_variant_helper;
+		/* tdp_pointer_variant_has_stable_target<> indicates pointer types whose target address, once the pointer is
+		stored (and not null), can't change for the lifetime of the stored pointer, and whose dereference operator
+		doesn't perform any (other) run-time safety checks. The target addresses of these types are cached. */
+		template<typename T>
+		struct tdp_pointer_variant_has_stable_target : std::false_type {};
+		template<typename T>
+		struct tdp_pointer_variant_has_stable_target<std::shared_ptr<T> > : std::true_type {};
+		template<typename T, typename TID>
+		struct tdp_pointer_variant_has_stable_target<mse::us::impl::TPointer<T, TID> > : std::true_type {};
+#if !defined(MSE_SCOPEPOINTER_DISABLED) && !defined(MSE_SCOPEPOINTER_RUNTIME_CHECKS_ENABLED)
+		template<typename T>
+		struct tdp_pointer_variant_has_stable_target<mse::TXScopeFixedPointer<T> > : std::true_type {};
+		template<typename T>
+		struct tdp_pointer_variant_has_stable_target<mse::TXScopeFixedConstPointer<T> > : std::true_type {};
+		template<typename T>
+		struct tdp_pointer_variant_has_stable_target<mse::TXScopeItemFixedPointer<T> > : std::true_type {};
+		template<typename T>
+		struct tdp_pointer_variant_has_stable_target<mse::TXScopeItemFixedConstPointer<T> > : std::true_type {};
+#endif // !defined(MSE_SCOPEPOINTER_DISABLED) && !defined(MSE_SCOPEPOINTER_RUNTIME_CHECKS_ENABLED)
+#if !defined(MSE_REFCOUNTINGPOINTER_DISABLED)
+		template<typename T>
+		struct tdp_pointer_variant_has_stable_target<mse::TRefCountingPointer<T> > : std::true_type {};
+		template<typename T>
+		struct tdp_pointer_variant_has_stable_target<mse::TRefCountingConstPointer<T> > : std::true_type {};
+#endif // !defined(MSE_REFCOUNTINGPOINTER_DISABLED)
 
-		template<typename F, typename... Ts>
-		struct tdp_pointer_variant_helper<F, Ts...> {
-			inline static void* arrow_operator(std::type_index id, const void * data) {
-				if (id == std::type_index(typeid(F))) {
-					return (reinterpret_cast<const F*>(data))->operator->();
-				}
-				else {
-					return tdp_pointer_variant_helper<Ts...>::arrow_operator(id, data);
-				}
+		template<typename... Ts>
+		struct tdp_pointer_variant_helper {
+			template<typename F>
+			static void* arrow_operator_impl(const void * data) { return (reinterpret_cast<const F*>(data))->operator->(); }
+			template<typename F>
+			static const void* const_arrow_operator_impl(const void * data) { return (reinterpret_cast<const F*>(data))->operator->(); }
+			template<typename F>
+			static bool bool_operator_impl(const void * data) {
+				//return bool(*(reinterpret_cast<const F*>(data)));
+				return mse::impl::operator_bool_helper1<F>(typename std::is_convertible<F, bool>::type(), *(reinterpret_cast<const F*>(data)));
 			}
-			inline static const void* const_arrow_operator(std::type_index id, const void * data) {
-				if (id == std::type_index(typeid(F))) {
-					return (reinterpret_cast<const F*>(data))->operator->();
-				}
-				else {
-					return tdp_pointer_variant_helper<Ts...>::const_arrow_operator(id, data);
-				}
+			static void* null_arrow_operator_impl(const void *) { return nullptr; }
+			static const void* null_const_arrow_operator_impl(const void *) { return nullptr; }
+			static bool null_bool_operator_impl(const void *) { return false; }
+
+			inline static void* arrow_operator(size_t id, const void * data) {
+				typedef void*(*function_pointer_t)(const void *);
+				static const function_pointer_t s_functions[] = { null_arrow_operator_impl, arrow_operator_impl<Ts>... };
+				assert(sizeof(s_functions) / sizeof(s_functions[0]) > id);
+				return s_functions[id](data);
 			}
-			inline static bool bool_operator(std::type_index id, const void * data) {
-				if (id == std::type_index(typeid(F))) {
-					//return bool(*(reinterpret_cast<const F*>(data)));
-					return mse::impl::operator_bool_helper1<F>(typename std::is_convertible<F, bool>::type(), *(reinterpret_cast<const F*>(data)));
-				}
-				else {
-					return tdp_pointer_variant_helper<Ts...>::bool_operator(id, data);
-				}
+			inline static const void* const_arrow_operator(size_t id, const void * data) {
+				typedef const void*(*function_pointer_t)(const void *);
+				static const function_pointer_t s_functions[] = { null_const_arrow_operator_impl, const_arrow_operator_impl<Ts>... };
+				assert(sizeof(s_functions) / sizeof(s_functions[0]) > id);
+				return s_functions[id](data);
+			}
+			inline static bool bool_operator(size_t id, const void * data) {
+				typedef bool(*function_pointer_t)(const void *);
+				static const function_pointer_t s_functions[] = { null_bool_operator_impl, bool_operator_impl<Ts>... };
+				assert(sizeof(s_functions) / sizeof(s_functions[0]) > id);
+				return s_functions[id](data);
 			}
-		};
-
-		template<> struct tdp_pointer_variant_helper<> {
-			inline static void* arrow_operator(std::type_index id, const void * data) { return nullptr; }
-			inline static const void* const_arrow_operator(std::type_index id, const void * data) { return nullptr; }
-			inline static bool bool_operator(std::type_index id, const void * data) { return false; }
 		};
 	}
 
 	template<typename... Ts>
 	struct tdp_pointer_variant : public tdp_variant<Ts...> {
 	protected:
+		using base_class = tdp_variant<Ts...>;
 		using pointer_helper_t = impl::tdp_pointer_variant_helper<Ts...>;
+
+		/* The target address of the held pointer, if its type is one whose target can't change (and it isn't null). Copies
+		of the held pointer have the same target, so copies of the variant can just copy it. */
+		const void* m_cached_target_ptr = nullptr;
+
 	public:
 		using tdp_variant<Ts...>::tdp_variant;
 
+		tdp_pointer_variant() {}
+		tdp_pointer_variant(const tdp_pointer_variant& src) : base_class(src), m_cached_target_ptr(src.m_cached_target_ptr) {}
+		tdp_pointer_variant(tdp_pointer_variant&& src) : base_class(std::move(src)), m_cached_target_ptr(src.m_cached_target_ptr) {
+			/* The moved-from pointer may no longer point to the target. */
+			src.m_cached_target_ptr = nullptr;
+		}
+
+		tdp_pointer_variant& operator=(const tdp_pointer_variant& src) {
+			m_cached_target_ptr = nullptr;
+			base_class::operator=(src);
+			m_cached_target_ptr = src.m_cached_target_ptr;
+			return *this;
+		}
+
+		template<typename T, typename... Args>
+		void set(Args&&... args)
+		{
+			m_cached_target_ptr = nullptr;
+			base_class::template set<T>(std::forward<Args>(args)...);
+			m_cached_target_ptr = stable_target_address(typename impl::tdp_pointer_variant_has_stable_target<T>::type(), base_class::template get<T>());
+		}
+
+		template<typename T>
+		const T& get() const {
+			return base_class::template get<T>();
+		}
+		/* The held pointer could be retargeted (or reset) via the returned (non-const) reference, so the cached target
+		address is discarded. */
+		template<typename T>
+		T& get() {
+			m_cached_target_ptr = nullptr;
+			return base_class::template get<T>();
+		}
+
 		void* arrow_operator() const {
+			if (m_cached_target_ptr) {
+				/* The cached address was obtained from the held (non-const) pointer, so this cast just restores its constness. */
+				return const_cast<void*>(m_cached_target_ptr);
+			}
 			return pointer_helper_t::arrow_operator((*this).type_id, &((*this).data));
 		}
 		const void* const_arrow_operator() const {
+			if (m_cached_target_ptr) {
+				return m_cached_target_ptr;
+			}
 			return pointer_helper_t::const_arrow_operator((*this).type_id, &((*this).data));
 		}
 		bool bool_operator() const {
 			return pointer_helper_t::bool_operator((*this).type_id, &((*this).data));
 		}
+
+	private:
+		template<typename T>
+		static const void* stable_target_address(std::true_type, const T& ptr_cref) {
+			return (!ptr_cref) ? nullptr : static_cast<const void*>(ptr_cref.operator->());
+		}
+		template<typename T>
+		static const void* stable_target_address(std::false_type, const T&) { return nullptr; }
 	};
 
 	template <typename _Ty> class TXScopeAnyPointer;
@@ -295,6 +390,7 @@ namespace mse {
 	class TXScopeAnyPointer : public us::impl::TAnyPointerBase<_Ty>, public mse::us::impl::XScopeContainsNonOwningScopeReferenceTagBase {
 	public:
 		typedef us::impl::TAnyPointerBase<_Ty> base_class;
+		TXScopeAnyPointer(const TXScopeAnyPointer& src) : base_class(src) {}
 		TXScopeAnyPointer(const us::impl::TAnyPointerBase<_Ty>& src) : base_class(src) {}
 
 		template <typename _TPointer1, class = typename std::enable_if<
@@ -349,6 +445,7 @@ namespace mse {
 	class TXScopeAnyConstPointer : public us::impl::TAnyConstPointerBase<_Ty>, public mse::us::impl::XScopeContainsNonOwningScopeReferenceTagBase {
 	public:
 		typedef us::impl::TAnyConstPointerBase<_Ty> base_class;
+		TXScopeAnyConstPointer(const TXScopeAnyConstPointer& src) : base_class(src) {}
 		TXScopeAnyConstPointer(const us::impl::TAnyConstPointerBase<_Ty>& src) : base_class(src) {}
 		TXScopeAnyConstPointer(const us::impl::TAnyPointerBase<_Ty>& src) : base_class(src) {}
 
@@ -655,6 +752,7 @@ namespace mse {
 
 		//MSE_USING(TPolyPointer, us::impl::TPolyPointerBase<_Ty>);
 		//TPolyPointer(const us::impl::TPolyPointerBase<_Ty>& p) : base_class(p) {}
+		TPolyPointer(const TPolyPointer& src) : base_class(src) {}
 
 		template <typename _TPointer1>
 		TPolyPointer(const _TPointer1& pointer) : base_class(pointer) {
@@ -977,6 +1075,40 @@ namespace mse {
 			template <typename _Ty> using TRandomAccessIteratorStdBase = mse::impl::random_access_iterator_base<_Ty>;
 			template <typename _Ty> using TRandomAccessConstIteratorStdBase = mse::impl::random_access_const_iterator_base<_Ty>;
 
+			namespace ns_contiguous_storage {
+				/* Iterators that report their position in a target container that provides (contiguous) data() storage. */
+				template<class _TRandomAccessIterator1, class _Ty, class = void>
+				struct has_contiguous_target_container : std::false_type {};
+				template<class _TRandomAccessIterator1, class _Ty>
+				struct has_contiguous_target_container<_TRandomAccessIterator1, _Ty, mse::impl::void_t<
+					decltype(std::declval<const _TRandomAccessIterator1&>().position())
+					, decltype(std::declval<const _TRandomAccessIterator1&>().target_container_ptr()->size())
+					, typename std::enable_if<std::is_convertible<decltype(std::declval<const _TRandomAccessIterator1&>().target_container_ptr()->data()), _Ty*>::value>::type
+					> > : std::true_type {};
+
+				template<class _Ty, class _TRandomAccessIterator1>
+				std::pair<_Ty*, size_t> contiguous_storage_span_helper(std::false_type, const _TRandomAccessIterator1&) {
+					return std::pair<_Ty*, size_t>(nullptr, 0);
+				}
+				template<class _Ty, class _TRandomAccessIterator1>
+				std::pair<_Ty*, size_t> contiguous_storage_span_helper(std::true_type, const _TRandomAccessIterator1& iter) {
+					const auto container_ptr = iter.target_container_ptr();
+					if (!container_ptr) {
+						return std::pair<_Ty*, size_t>(nullptr, 0);
+					}
+					const auto container_size = size_t((*container_ptr).size());
+					const auto position = size_t(iter.position());
+					if (position > container_size) {
+						return std::pair<_Ty*, size_t>(nullptr, 0);
+					}
+					_Ty* data_ptr = (*container_ptr).data();
+					if (!data_ptr) {
+						return std::pair<_Ty*, size_t>(nullptr, 0);
+					}
+					return std::pair<_Ty*, size_t>(data_ptr + position, container_size - position);
+				}
+			}
+
 			template <typename _Ty>
 			class TCommonRandomAccessIteratorInterface : public TRandomAccessIteratorStdBase<_Ty> {
 			public:
@@ -1001,6 +1133,11 @@ namespace mse {
 				virtual bool operator>(const TCommonRandomAccessIteratorInterface& _Right_cref) const { return (0 > operator-(_Right_cref)); }
 				virtual bool operator<=(const TCommonRandomAccessIteratorInterface& _Right_cref) const { return (0 >= operator-(_Right_cref)); }
 				virtual bool operator>=(const TCommonRandomAccessIteratorInterface& _Right_cref) const { return (0 >= operator-(_Right_cref)); }
+
+				/* If the target elements are known to be stored contiguously, returns a (raw) pointer to the current element
+				and the number of elements from the current element to the end of the storage. Otherwise returns a null
+				pointer. */
+				virtual std::pair<_Ty*, size_t> contiguous_storage_span() const { return std::pair<_Ty*, size_t>(nullptr, 0); }
 			};
 
 			template <typename _Ty, typename _TRandomAccessIterator1>
@@ -1026,6 +1163,10 @@ namespace mse {
 					const _TRandomAccessIterator1& _Right_cref_m_random_access_iterator_cref = (*crai_ptr).m_random_access_iterator;
 					return m_random_access_iterator - _Right_cref_m_random_access_iterator_cref;
 				}
+				std::pair<_Ty*, size_t> contiguous_storage_span() const {
+					return ns_contiguous_storage::contiguous_storage_span_helper<_Ty>(
+						ns_contiguous_storage::has_contiguous_target_container<_TRandomAccessIterator1, _Ty>(), m_random_access_iterator);
+				}
 
 				_TRandomAccessIterator1 m_random_access_iterator;
 			};
@@ -1077,6 +1218,12 @@ namespace mse {
 					return (*this);
 				}
 
+				/* Used by "bulk" operations (like mse::lh::CMemF<>::memcpy()) to bypass per-element (virtual) access when the
+				target is known to be contiguous. */
+				friend std::pair<_Ty*, size_t> contiguous_storage_span(const TAnyRandomAccessIteratorBase& iter) {
+					return iter.common_random_access_iterator_interface_ptr()->contiguous_storage_span();
+				}
+
 			protected:
 				MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
 
@@ -2217,6 +2364,61 @@ namespace mse {
 						//std::cout << d.get<mse::TRefCountingFixedPointer<A>>()->b << std::endl;
 					}
 
+					{
+						/* tdp_pointer_variant<> caches the target address of held pointers whose target can't change (like
+						std::shared_ptr<>s). Every operation that could change the held pointer must discard the cached
+						address. */
+						using vector_iter_t = typename mse::mstd::vector<A>::iterator;
+						using pointer_variant_t = tdp_pointer_variant<std::shared_ptr<A>, vector_iter_t>;
+						auto A_shp1 = std::make_shared<A>(1);
+						auto A_shp2 = std::make_shared<A>(2);
+						mse::mstd::vector<A> A_vec{ A(3) };
+						auto target_of = [](const pointer_variant_t& pv) { return static_cast<A*>(pv.arrow_operator()); };
+
+						pointer_variant_t pv1;
+						pv1.set<std::shared_ptr<A> >(A_shp1);
+						assert(A_shp1.get() == target_of(pv1));
+						assert(A_shp1.get() == pv1.const_arrow_operator());
+
+						/* set() */
+						pv1.set<std::shared_ptr<A> >(A_shp2);
+						assert(A_shp2.get() == target_of(pv1));
+						pv1.set<vector_iter_t>(A_vec.begin());
+						assert(std::addressof(A_vec.front()) == target_of(pv1));
+						pv1.set<std::shared_ptr<A> >(A_shp2);
+						assert(A_shp2.get() == target_of(pv1));
+
+						/* non-const get<>() */
+						pv1.get<std::shared_ptr<A> >() = A_shp1;
+						assert(A_shp1.get() == target_of(pv1));
+						pv1.get<std::shared_ptr<A> >().reset();
+						assert(nullptr == target_of(pv1));
+						pv1.set<std::shared_ptr<A> >(A_shp1);
+
+						/* copy construction */
+						pointer_variant_t pv2(pv1);
+						assert(A_shp1.get() == target_of(pv2));
+
+						/* move construction (whether the moved-from pointer is left null depends on
+						MSE_TDP_VARIANT_REQUIRE_MOVABILITY, but either way its target shouldn't be stale) */
+						pointer_variant_t pv3(std::move(pv2));
+						assert(A_shp1.get() == target_of(pv3));
+						assert((nullptr == target_of(pv2)) || (A_shp1.get() == target_of(pv2)));
+
+						/* assignment (from variants with cached and uncached target addresses) */
+						pointer_variant_t pv4;
+						pv4.set<std::shared_ptr<A> >(A_shp2);
+						assert(A_shp2.get() == target_of(pv4));
+						pv4 = pv3;
+						assert(A_shp1.get() == target_of(pv4));
+						pointer_variant_t pv5;
+						pv5.set<vector_iter_t>(A_vec.begin());
+						pv4 = pv5;
+						assert(std::addressof(A_vec.front()) == target_of(pv4));
+						pv4 = std::move(pv3);
+						assert(A_shp1.get() == target_of(pv4));
+					}
+
 					{
 						/* Poly and "any" pointer assignment operators. */
 						mse::TPolyPointer<A> a_poly_pointer1 = a_refcptr;
@@ -14,6 +14,7 @@
 #include <unordered_set>
 #include <functional>
 #include <cassert>
+#include <vector>
 
 #ifdef MSE_CUSTOM_THROW_DEFINITION
 #include <iostream>
@@ -73,6 +74,8 @@ namespace mse {
 		template <class _Ty> void ndregistered_delete(const TNDRegisteredPointer<_Ty>& ndregisteredPtrRef);
 		template <class _Ty> void ndregistered_delete(const TNDRegisteredConstPointer<_Ty>& ndregisteredPtrRef);
 	}
+	template <class _Ty, class... Args> std::vector<TNDRegisteredPointer<_Ty> > ndregistered_new_n(size_t count, const Args&... args);
+	template <class _Ty> void ndregistered_delete_n(const std::vector<TNDRegisteredPointer<_Ty> >& ndregisteredPtrs);
 
 	namespace impl {
 		template<typename _Ty, class... Args>
@@ -143,6 +146,25 @@ namespace mse {
 			mse::registered_delete(regPtrRef);
 		}
 	}
+	template <class _Ty, class... Args>
+	std::vector<TRegisteredPointer<_Ty> > registered_new_n(size_t count, const Args&... args) {
+		std::vector<TRegisteredPointer<_Ty> > retval;
+		retval.reserve(count);
+		try {
+			for (size_t i = 0; i < count; i += 1) {
+				retval.push_back(new TRegisteredObj<_Ty>(args...));
+			}
+		}
+		catch (...) {
+			for (auto ptr : retval) { delete ptr; }
+			throw;
+		}
+		return retval;
+	}
+	template <class _Ty>
+	void registered_delete_n(const std::vector<TRegisteredPointer<_Ty> >& regPtrs) {
+		for (auto ptr : regPtrs) { delete ptr; }
+	}
 
 	template <class X, class... Args>
 	auto make_registered(Args&&... args) {
@@ -180,6 +202,8 @@ namespace mse {
 		template <class _Ty> void registered_delete(TNDRegisteredPointer<_Ty>& ndregisteredPtrRef) { return mse::us::ndregistered_delete<_Ty>(ndregisteredPtrRef); }
 		template <class _Ty> void registered_delete(TNDRegisteredConstPointer<_Ty>& ndregisteredPtrRef) { return mse::us::ndregistered_delete<_Ty>(ndregisteredPtrRef); }
 	}
+	template <class _Ty, class... Args> std::vector<TNDRegisteredPointer<_Ty> > registered_new_n(size_t count, const Args&... args) { return ndregistered_new_n<_Ty>(count, args...); }
+	template <class _Ty> void registered_delete_n(const std::vector<TNDRegisteredPointer<_Ty> >& ndregisteredPtrs) { return mse::ndregistered_delete_n<_Ty>(ndregisteredPtrs); }
 
 	template <class X, class... Args>
 	auto make_registered(Args&&... args) {
@@ -590,10 +614,12 @@ namespace mse {
 
 		/* todo: make these private */
 		void register_pointer(const mse::us::impl::CRegisteredNode& node_cref) const {
+			MSE_STATS_INCREMENT(registered_link);
 			node_cref.set_next_ptr(m_head_ptr);
 			m_head_ptr = &node_cref;
 		}
 		void unregister_pointer(const mse::us::impl::CRegisteredNode& node_cref) const {
+			MSE_STATS_INCREMENT(registered_unlink);
 			const auto target_node_ptr = &node_cref;
 			if (target_node_ptr == m_head_ptr) {
 				m_head_ptr = target_node_ptr->get_next_ptr();
@@ -606,6 +632,7 @@ namespace mse {
 			}
 			auto current_node_ptr = m_head_ptr;
 			while (target_node_ptr != current_node_ptr->get_next_ptr()) {
+				MSE_STATS_INCREMENT(registered_unlink_walk_steps);
 				current_node_ptr = current_node_ptr->get_next_ptr();
 				if (!current_node_ptr) {
 					assert(false);
@@ -651,6 +678,51 @@ namespace mse {
 		if (!res) { assert(false); MSE_THROW(std::invalid_argument("invalid argument, no corresponding allocation found - mse::registered_delete() \n- tip: If deleting via base class pointer, use mse::us::registered_delete() instead. ")); }
 		regPtrRef.registered_delete();
 	}
+
+	/* ndregistered_new_n() allocates count objects, each constructed from the given arguments, and registers all of them
+	with the allocation registry in a single batch. */
+	template <class _Ty, class... Args>
+	std::vector<TNDRegisteredPointer<_Ty> > ndregistered_new_n(size_t count, const Args&... args) {
+		auto& registry_ref = mse::us::impl::tlSAllocRegistry_ref<TNDRegisteredObj<_Ty> >();
+		std::vector<void*> alloc_ptrs;
+		alloc_ptrs.reserve(count);
+		std::vector<TNDRegisteredPointer<_Ty> > retval;
+		retval.reserve(count);
+		registry_ref.reserve(count);
+		try {
+			for (size_t i = 0; i < count; i += 1) {
+				auto a = new TNDRegisteredObj<_Ty>(args...);
+				alloc_ptrs.push_back(a);
+				retval.push_back(&(*a));
+			}
+		}
+		catch (...) {
+			retval.clear();
+			for (auto a : alloc_ptrs) { delete static_cast<TNDRegisteredObj<_Ty>*>(a); }
+			throw;
+		}
+		registry_ref.registerPointers(alloc_ptrs.data(), alloc_ptrs.size());
+		return retval;
+	}
+	/* ndregistered_delete_n() deletes a batch of objects allocated by ndregistered_new() or ndregistered_new_n(). If any
+	of the (non-null) pointers doesn't correspond to a (distinct) registered allocation, nothing is deleted and an
+	exception is thrown. */
+	template <class _Ty>
+	void ndregistered_delete_n(const std::vector<TNDRegisteredPointer<_Ty> >& regPtrs) {
+		std::vector<const void*> alloc_ptrs;
+		alloc_ptrs.reserve(regPtrs.size());
+		for (const auto& regPtrRef : regPtrs) {
+			alloc_ptrs.push_back(static_cast<const TNDRegisteredObj<_Ty>*>(static_cast<TNDRegisteredObj<_Ty>*>(regPtrRef)));
+		}
+		auto res = mse::us::impl::tlSAllocRegistry_ref<TNDRegisteredObj<_Ty> >().unregisterPointers(alloc_ptrs.data(), alloc_ptrs.size());
+		if (!res) { assert(false); MSE_THROW(std::invalid_argument("invalid argument, no corresponding allocation found - mse::registered_delete_n() \n- tip: If deleting via base class pointer, use mse::us::registered_delete() instead. ")); }
+		for (const auto& regPtrRef : regPtrs) {
+			if (regPtrRef) {
+				regPtrRef.registered_delete();
+			}
+		}
+	}
+
 	namespace us {
 		template <class _Ty>
 		void ndregistered_delete(const TNDRegisteredPointer<_Ty>& regPtrRef) {
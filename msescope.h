@@ -135,6 +135,7 @@ namespace mse {
 	//template<typename _TROy> using TXScopeReturnValue = _TROy;
 
 	template<typename _TROy> class TXScopeOwnerPointer;
+	template<typename _Ty, size_t _Capacity = sizeof(_Ty), size_t _Alignment = alignof(_Ty)> class TXScopeOwnerInline;
 
 	template<typename _Ty> auto xscope_ifptr_to(_Ty&& _X) { return std::addressof(_X); }
 	template<typename _Ty> auto xscope_ifptr_to(const _Ty& _X) { return std::addressof(_X); }
@@ -260,6 +261,7 @@ namespace mse {
 	template<typename _Ty> class TXScopeFixedPointer;
 	template<typename _Ty> class TXScopeFixedConstPointer;
 	template<typename _Ty> class TXScopeOwnerPointer;
+	template<typename _Ty, size_t _Capacity = sizeof(TXScopeObj<_Ty>), size_t _Alignment = alignof(TXScopeObj<_Ty>)> class TXScopeOwnerInline;
 
 	template<typename _Ty> class TXScopeItemFixedPointer;
 	template<typename _Ty> class TXScopeItemFixedConstPointer;
@@ -615,6 +617,8 @@ namespace mse {
 		//TXScopeItemFixedPointer(const TXScopeOwnerPointer<_Ty>& src_cref) : TXScopeItemFixedPointer(&(*src_cref)) {}
 		template<class _Ty2, class = typename std::enable_if<std::is_convertible<_Ty2 *, _Ty *>::value, void>::type>
 		TXScopeItemFixedPointer(const TXScopeOwnerPointer<_Ty2>& src_cref) : TXScopeItemFixedPointer(&(*src_cref)) {}
+		template<class _Ty2, size_t _Capacity, size_t _Alignment, class = typename std::enable_if<std::is_convertible<_Ty2 *, _Ty *>::value, void>::type>
+		TXScopeItemFixedPointer(const TXScopeOwnerInline<_Ty2, _Capacity, _Alignment>& src_cref) : TXScopeItemFixedPointer(static_cast<_Ty*>(std::addressof(*src_cref))) {}
 
 		virtual ~TXScopeItemFixedPointer() {}
 
@@ -663,6 +667,8 @@ namespace mse {
 		//TXScopeItemFixedConstPointer(const TXScopeOwnerPointer<_Ty>& src_cref) : TXScopeItemFixedConstPointer(&(*src_cref)) {}
 		template<class _Ty2, class = typename std::enable_if<std::is_convertible<_Ty2 *, _Ty *>::value, void>::type>
 		TXScopeItemFixedConstPointer(const TXScopeOwnerPointer<_Ty2>& src_cref) : TXScopeItemFixedConstPointer(&(*src_cref)) {}
+		template<class _Ty2, size_t _Capacity, size_t _Alignment, class = typename std::enable_if<std::is_convertible<_Ty2 *, _Ty *>::value, void>::type>
+		TXScopeItemFixedConstPointer(const TXScopeOwnerInline<_Ty2, _Capacity, _Alignment>& src_cref) : TXScopeItemFixedConstPointer(static_cast<const _Ty*>(std::addressof(*src_cref))) {}
 
 		virtual ~TXScopeItemFixedConstPointer() {}
 
@@ -1510,6 +1516,166 @@ namespace mse {
 	TXScopeOwnerPointer<X> make_xscope_owner(Args&&... args) {
 		return TXScopeOwnerPointer<X>::make(std::forward<Args>(args)...);
 	}
+
+	/* TXScopeOwnerInline is a version of TXScopeOwnerPointer that stores its target object in a fixed-capacity buffer
+	embedded in the owner object itself (rather than on the heap). Like TXScopeOwnerPointer, it can be declared to own an
+	object of a base class type while the object is actually of a (derived) type specified at construction, as long as
+	the (TXScopeObj<> wrapped) derived object fits within the given capacity and alignment. This is verified at compile-
+	time. Unlike TXScopeOwnerPointer, the target object's address is not stable across a move of the owner, so the
+	(rarely needed) move constructor move constructs (or, failing that, copy constructs) a new target object from the
+	source's, leaving the source owner with its (moved-from) target. Like TXScopeOwnerPointer, TXScopeOwnerInline is
+	meant to be allocated on the stack only. */
+	template<typename _Ty, size_t _Capacity/* = sizeof(TXScopeObj<_Ty>)*/, size_t _Alignment/* = alignof(TXScopeObj<_Ty>)*/>
+	class TXScopeOwnerInline : public mse::us::impl::XScopeTagBase, public mse::us::impl::StrongPointerAsyncNotShareableAndNotPassableTagBase
+		, public std::conditional<std::is_base_of<mse::us::impl::ContainsNonOwningScopeReferenceTagBase, _Ty>::value, mse::us::impl::ContainsNonOwningScopeReferenceTagBase, mse::impl::TPlaceHolder_msescope<TXScopeOwnerInline<_Ty, _Capacity, _Alignment> > >::type
+	{
+	public:
+		TXScopeOwnerInline(TXScopeOwnerInline&& src_ref) : m_ops_ptr(src_ref.m_ops_ptr) {
+			m_ops_ptr->move_construct(storage_ptr(), src_ref.storage_ptr());
+			m_ptr = m_ops_ptr->target(storage_ptr());
+		}
+
+		template <class... Args>
+		TXScopeOwnerInline(Args&&... args) {
+			/* In the case where there is exactly one argument and its type is derived from this type, we want to
+			act like a move constructor here. We use a helper function to check for this case and act accordingly. */
+			constructor_helper1(std::forward<Args>(args)...);
+		}
+
+		~TXScopeOwnerInline() {
+			m_ops_ptr->destroy(storage_ptr());
+		}
+
+		_Ty& operator*() const {
+			return (*m_ptr);
+		}
+		_Ty* operator->() const {
+			return m_ptr;
+		}
+
+#ifdef MSE_SCOPEPOINTER_DISABLED
+		operator _Ty*() const {
+			return m_ptr;
+		}
+		explicit operator const _Ty*() const {
+			return m_ptr;
+		}
+#endif /*MSE_SCOPEPOINTER_DISABLED*/
+
+		template <class... Args>
+		static TXScopeOwnerInline make(Args&&... args) {
+			return TXScopeOwnerInline(std::forward<Args>(args)...);
+		}
+		/* Constructs the target object as a _TDerived (rather than a _Ty). */
+		template <class _TDerived, class... Args>
+		static TXScopeOwnerInline make_derived(Args&&... args) {
+			return TXScopeOwnerInline(derived_tag<_TDerived>(), std::forward<Args>(args)...);
+		}
+
+		static constexpr size_t capacity() { return _Capacity; }
+
+		void xscope_tag() const {}
+		/* This type can be safely used as a function return value if _TROy is also safely returnable. */
+		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && (
+			(std::integral_constant<bool, mse::impl::HasXScopeReturnableTagMethod<_Ty2>::Has>()) || (!std::is_base_of<mse::us::impl::XScopeTagBase, _Ty2>::value)
+			), void>::type>
+			void xscope_returnable_tag() const {} /* Indication that this type is can be used as a function return value. */
+
+	private:
+		template<class _TDerived> struct derived_tag {};
+
+		/* The (type erased) operations needed to manage the stored object. One static (constant initialized) instance
+		exists per stored object type. */
+		struct ops_t {
+			void(*destroy)(void* storage_ptr);
+			void(*move_construct)(void* dest_storage_ptr, void* src_storage_ptr);
+			_Ty* (*target)(void* storage_ptr);
+		};
+		template<class _TDerived>
+		struct ops_for {
+			typedef TXScopeObj<_TDerived> obj_t;
+			static void destroy(void* storage_ptr) {
+				static_cast<obj_t*>(storage_ptr)->~obj_t();
+			}
+			static void move_construct(void* dest_storage_ptr, void* src_storage_ptr) {
+				_TDerived& src_ref = *static_cast<obj_t*>(src_storage_ptr);
+				::new (dest_storage_ptr) obj_t(std::move(src_ref));
+			}
+			static _Ty* target(void* storage_ptr) {
+				return static_cast<_Ty*>(static_cast<_TDerived*>(static_cast<obj_t*>(storage_ptr)));
+			}
+			static const ops_t* ops_ptr() {
+				static const ops_t s_ops = { destroy, move_construct, target };
+				return &s_ops;
+			}
+		};
+
+		void* storage_ptr() const { return static_cast<void*>(const_cast<unsigned char*>(m_storage)); }
+
+		template <class _TDerived, class... Args>
+		TXScopeOwnerInline(derived_tag<_TDerived>, Args&&... args) {
+			initialize<_TDerived>(std::forward<Args>(args)...);
+		}
+
+		/* construction helper functions */
+		template <class _TDerived, class... Args>
+		void initialize(Args&&... args) {
+			static_assert(std::is_convertible<_TDerived*, _Ty*>::value, "the specified type must be (publicly) derived from the owner's target type - TXScopeOwnerInline");
+			static_assert(sizeof(TXScopeObj<_TDerived>) <= _Capacity, "the specified type does not fit within the owner's capacity - TXScopeOwnerInline");
+			static_assert(0 == (_Alignment % alignof(TXScopeObj<_TDerived>)), "the specified type's alignment requirement is not satisfied by the owner's alignment - TXScopeOwnerInline");
+			static_assert((!std::is_base_of<mse::us::impl::ContainsNonOwningScopeReferenceTagBase, _TDerived>::value)
+				|| std::is_base_of<mse::us::impl::ContainsNonOwningScopeReferenceTagBase, _Ty>::value
+				, "the specified type contains scope references, but the owner's target type is not declared to - TXScopeOwnerInline");
+			/* Since the owner's move constructor doesn't know the (type erased) type of its target object, the target
+			object must support being moved (or copied) regardless of whether the owner ever is. */
+			static_assert(std::is_constructible<TXScopeObj<_TDerived>, _TDerived&&>::value, "the specified type must be move or copy constructible - TXScopeOwnerInline");
+			/* We use (global) placement new because TXScopeObj<>'s "operator new()" is private. */
+			::new (storage_ptr()) TXScopeObj<_TDerived>(std::forward<Args>(args)...);
+			m_ops_ptr = ops_for<_TDerived>::ops_ptr();
+			m_ptr = m_ops_ptr->target(storage_ptr());
+		}
+		template <class _TSoleArg>
+		void constructor_helper2(std::true_type, _TSoleArg&& sole_arg) {
+			/* The sole parameter is derived from, or of this type, so we're going to consider the constructor
+			a move constructor. */
+			m_ops_ptr = sole_arg.m_ops_ptr;
+			m_ops_ptr->move_construct(storage_ptr(), sole_arg.storage_ptr());
+			m_ptr = m_ops_ptr->target(storage_ptr());
+		}
+		template <class _TSoleArg>
+		void constructor_helper2(std::false_type, _TSoleArg&& sole_arg) {
+			/* The sole parameter is not derived from, or of this type, so the constructor is not a move
+			constructor. */
+			initialize<_Ty>(std::forward<decltype(sole_arg)>(sole_arg));
+		}
+		template <class... Args>
+		void constructor_helper1(Args&&... args) {
+			initialize<_Ty>(std::forward<Args>(args)...);
+		}
+		template <class _TSoleArg>
+		void constructor_helper1(_TSoleArg&& sole_arg) {
+			/* The constructor was given exactly one parameter. If the parameter is an rvalue derived from, or of this
+			type, then we're going to consider the constructor a move constructor. (An lvalue _TSoleArg is deduced as a
+			reference type, which is_base_of<> never reports as a derived type.) */
+			constructor_helper2(typename std::is_base_of<TXScopeOwnerInline, _TSoleArg>::type(), std::forward<decltype(sole_arg)>(sole_arg));
+		}
+
+		TXScopeOwnerInline(const TXScopeOwnerInline& src_cref) = delete;
+		/* Without this, the (variadic) forwarding constructor would be a better match for non-const lvalues than the
+		(deleted) copy constructor. */
+		TXScopeOwnerInline(TXScopeOwnerInline& src_ref) = delete;
+		TXScopeOwnerInline& operator=(const TXScopeOwnerInline& _Right_cref) = delete;
+		void* operator new(size_t size) { return ::operator new(size); }
+
+		alignas(_Alignment) unsigned char m_storage[_Capacity];
+		const ops_t* m_ops_ptr = nullptr;
+		_Ty* m_ptr = nullptr;
+	};
+
+	template <class X, class... Args>
+	TXScopeOwnerInline<X> make_xscope_owner_inline(Args&&... args) {
+		return TXScopeOwnerInline<X>::make(std::forward<Args>(args)...);
+	}
 }
 
 namespace std {
@@ -16,6 +16,11 @@
 #include <utility>
 #include <unordered_set>
 #include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <cstring>
+#include <cstdint>
+#include <climits>
 #include <cassert>
 
 #ifdef MSE_SCOPEPOINTER_RUNTIME_CHECKS_ENABLED
@@ -1010,6 +1015,186 @@ namespace mse {
 		return choose_the_second ? b : a;
 	}
 #endif // !defined(MSE_SCOPEPOINTER_DISABLED)
+}
+
+/* The platform headers are only needed by the futex based fallback implementation of xscope_atomic_wait(). */
+#if defined(__linux__) && !(defined(__cpp_lib_atomic_wait) && (201907L <= __cpp_lib_atomic_wait))
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif // defined(__linux__) && !(defined(__cpp_lib_atomic_wait) && (201907L <= __cpp_lib_atomic_wait))
+
+namespace mse {
+	namespace impl {
+		namespace ns_atomic_wait {
+			/* The xscope_atomic_*() functions only accept (scope) pointers to atomic objects. (When scope pointers are
+			disabled, these are native pointers.) */
+			template<typename _TAtomicPointer, typename = void>
+			struct is_xscope_atomic_pointer : std::false_type {};
+			template<typename _TAtomicPointer>
+			struct is_xscope_atomic_pointer<_TAtomicPointer, typename std::conditional<true, void, decltype((*std::declval<const _TAtomicPointer&>()).load())>::type>
+				: std::integral_constant<bool, std::is_base_of<std::atomic<typename std::remove_cv<decltype((*std::declval<const _TAtomicPointer&>()).load())>::type>
+					, typename std::remove_cv<typename std::remove_reference<decltype(*std::declval<const _TAtomicPointer&>())>::type>::type>::value
+#ifdef MSE_SCOPEPOINTER_DISABLED
+					&& std::is_pointer<_TAtomicPointer>::value> {};
+#else // MSE_SCOPEPOINTER_DISABLED
+					&& std::is_base_of<mse::us::impl::XScopeTagBase, _TAtomicPointer>::value> {};
+#endif // MSE_SCOPEPOINTER_DISABLED
+
+			template<typename _Ty>
+			bool bitwise_equal(const _Ty& a, const _Ty& b) {
+				return (0 == std::memcmp(std::addressof(a), std::addressof(b), sizeof(_Ty)));
+			}
+
+#if !(defined(__cpp_lib_atomic_wait) && (201907L <= __cpp_lib_atomic_wait))
+			/* Threads that need to block are "parked" on one of a fixed set of buckets selected by the address of the atomic
+			object. The waiter count lets notifiers skip the (relatively expensive) wake-up when nobody is waiting. */
+			struct CWaitBucket {
+				std::mutex m_mutex;
+				std::condition_variable m_cv;
+				std::atomic<int> m_num_waiters{ 0 };
+			};
+			inline CWaitBucket& wait_bucket_ref(const void* address) {
+				static const size_t sc_num_buckets = 64;
+				static CWaitBucket s_buckets[sc_num_buckets];
+				return s_buckets[(size_t(reinterpret_cast<std::uintptr_t>(address)) >> 4) % sc_num_buckets];
+			}
+
+#if defined(__linux__)
+			/* On linux, (lock-free) atomics the size of an int are waited on directly with a futex. */
+			template<typename _Ty>
+			struct is_futex_compatible : std::integral_constant<bool, (sizeof(std::atomic<_Ty>) == sizeof(int))
+				&& (sizeof(_Ty) == sizeof(int)) && (alignof(std::atomic<_Ty>) >= alignof(int))> {};
+
+			inline void futex_wait(const void* address, int expected_value) {
+				syscall(SYS_futex, address, FUTEX_WAIT_PRIVATE, expected_value, nullptr, nullptr, 0);
+			}
+			inline void futex_wake(const void* address, int num_to_wake) {
+				syscall(SYS_futex, address, FUTEX_WAKE_PRIVATE, num_to_wake, nullptr, nullptr, 0);
+			}
+#else // defined(__linux__)
+			template<typename _Ty>
+			struct is_futex_compatible : std::false_type {};
+			inline void futex_wait(const void* address, int expected_value) {}
+			inline void futex_wake(const void* address, int num_to_wake) {}
+#endif // defined(__linux__)
+
+			template<typename _Ty>
+			void park_while_equal(std::true_type /*is_futex_compatible*/, const std::atomic<_Ty>& atomic_cref, const _Ty& old_value, std::memory_order order) {
+				int expected_bits = 0;
+				std::memcpy(&expected_bits, std::addressof(old_value), sizeof(int));
+				while (bitwise_equal(atomic_cref.load(order), old_value)) {
+					/* The kernel re-checks the value atomically, so a notification can't be missed between the load and
+					going to sleep. */
+					futex_wait(std::addressof(atomic_cref), expected_bits);
+				}
+			}
+			template<typename _Ty>
+			void park_while_equal(std::false_type /*is_futex_compatible*/, const std::atomic<_Ty>& atomic_cref, const _Ty& old_value, std::memory_order order) {
+				auto& bucket_ref = wait_bucket_ref(std::addressof(atomic_cref));
+				std::unique_lock<std::mutex> lock1(bucket_ref.m_mutex);
+				while (bitwise_equal(atomic_cref.load(order), old_value)) {
+					bucket_ref.m_cv.wait(lock1);
+				}
+			}
+
+			template<typename _Ty>
+			void notify(std::true_type /*is_futex_compatible*/, const std::atomic<_Ty>& atomic_cref, bool notify_all) {
+				futex_wake(std::addressof(atomic_cref), notify_all ? INT_MAX : 1);
+			}
+			template<typename _Ty>
+			void notify(std::false_type /*is_futex_compatible*/, const std::atomic<_Ty>& atomic_cref, bool notify_all) {
+				auto& bucket_ref = wait_bucket_ref(std::addressof(atomic_cref));
+				{
+					/* Acquiring the lock ensures that any waiter that saw the old value is already waiting on the condition
+					variable. */
+					std::lock_guard<std::mutex> lock1(bucket_ref.m_mutex);
+				}
+				/* Waiters on different atomic objects may share the bucket, so we can't just wake one. */
+				bucket_ref.m_cv.notify_all();
+			}
+#endif // !(defined(__cpp_lib_atomic_wait) && (201907L <= __cpp_lib_atomic_wait))
+
+			template<typename _Ty>
+			void wait(const std::atomic<_Ty>& atomic_cref, const _Ty& old_value, std::memory_order order) {
+#if defined(__cpp_lib_atomic_wait) && (201907L <= __cpp_lib_atomic_wait)
+				atomic_cref.wait(old_value, order);
+#else // defined(__cpp_lib_atomic_wait) && (201907L <= __cpp_lib_atomic_wait)
+				/* Briefly spin before resorting to blocking. */
+				for (int i = 0; 64 > i; i += 1) {
+					if (!bitwise_equal(atomic_cref.load(order), old_value)) {
+						return;
+					}
+				}
+				auto& bucket_ref = wait_bucket_ref(std::addressof(atomic_cref));
+				bucket_ref.m_num_waiters.fetch_add(1);
+				/* Pairs with the fence in notify_one()/notify_all(). Either the notifier sees our waiter count, or we
+				see the notifier's (preceding) store. */
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				park_while_equal(typename is_futex_compatible<_Ty>::type(), atomic_cref, old_value, order);
+				bucket_ref.m_num_waiters.fetch_sub(1);
+#endif // defined(__cpp_lib_atomic_wait) && (201907L <= __cpp_lib_atomic_wait)
+			}
+
+			template<typename _Ty>
+			void notify(const std::atomic<_Ty>& atomic_cref, bool notify_all) {
+#if defined(__cpp_lib_atomic_wait) && (201907L <= __cpp_lib_atomic_wait)
+				auto& atomic_ref = const_cast<std::atomic<_Ty>&>(atomic_cref);
+				if (notify_all) {
+					atomic_ref.notify_all();
+				}
+				else {
+					atomic_ref.notify_one();
+				}
+#else // defined(__cpp_lib_atomic_wait) && (201907L <= __cpp_lib_atomic_wait)
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				if (0 != wait_bucket_ref(std::addressof(atomic_cref)).m_num_waiters.load(std::memory_order_relaxed)) {
+					notify(typename is_futex_compatible<_Ty>::type(), atomic_cref, notify_all);
+				}
+#endif // defined(__cpp_lib_atomic_wait) && (201907L <= __cpp_lib_atomic_wait)
+			}
+		}
+	}
+
+	/* xscope_atomic_fetch_update() atomically replaces the value of the atomic object (pointed to by the given pointer)
+	with the result of the given function applied to the current value, and returns the previous value. The function
+	may be called more than once (if another thread modifies the object in the meantime), so it should not have side
+	effects. It's intended for updates (to, say, a trivially copyable struct) that aren't directly supported by
+	std::atomic<>'s member functions like fetch_add(). */
+	template<typename _TAtomicPointer, typename _TFunction, class = typename std::enable_if<impl::ns_atomic_wait::is_xscope_atomic_pointer<_TAtomicPointer>::value>::type>
+	auto xscope_atomic_fetch_update(const _TAtomicPointer& atomic_ptr, const _TFunction& function1, std::memory_order order = std::memory_order_seq_cst) {
+		auto& atomic_ref = *atomic_ptr;
+		auto expected_value = atomic_ref.load(std::memory_order_relaxed);
+		while (!atomic_ref.compare_exchange_weak(expected_value, function1(expected_value), order, std::memory_order_relaxed)) {}
+		return expected_value;
+	}
+
+	/* xscope_atomic_wait() blocks until the value of the atomic object (pointed to by the given pointer) is observed to
+	differ from old_value, and returns the new value. Like std::atomic<>::wait(), a change is only guaranteed to be
+	noticed if it is followed by a call to xscope_atomic_notify_one() or xscope_atomic_notify_all(). (Where
+	std::atomic<>::wait() is available, it is used. Otherwise waiting is done with a futex on linux, or a condition variable
+	elsewhere.) */
+	template<typename _TAtomicPointer, typename _Ty, class = typename std::enable_if<impl::ns_atomic_wait::is_xscope_atomic_pointer<_TAtomicPointer>::value>::type>
+	auto xscope_atomic_wait(const _TAtomicPointer& atomic_ptr, const _Ty& old_value, std::memory_order order = std::memory_order_seq_cst) {
+		auto& atomic_ref = *atomic_ptr;
+		typedef typename std::remove_cv<decltype(atomic_ref.load())>::type value_t;
+		const std::atomic<value_t>& atomic_cref = atomic_ref;
+		const value_t l_old_value = old_value;
+		impl::ns_atomic_wait::wait(atomic_cref, l_old_value, order);
+		return atomic_cref.load(order);
+	}
+	template<typename _TAtomicPointer, class = typename std::enable_if<impl::ns_atomic_wait::is_xscope_atomic_pointer<_TAtomicPointer>::value>::type>
+	void xscope_atomic_notify_one(const _TAtomicPointer& atomic_ptr) {
+		auto& atomic_ref = *atomic_ptr;
+		typedef typename std::remove_cv<decltype(atomic_ref.load())>::type value_t;
+		impl::ns_atomic_wait::notify(static_cast<const std::atomic<value_t>&>(atomic_ref), false);
+	}
+	template<typename _TAtomicPointer, class = typename std::enable_if<impl::ns_atomic_wait::is_xscope_atomic_pointer<_TAtomicPointer>::value>::type>
+	void xscope_atomic_notify_all(const _TAtomicPointer& atomic_ptr) {
+		auto& atomic_ref = *atomic_ptr;
+		typedef typename std::remove_cv<decltype(atomic_ref.load())>::type value_t;
+		impl::ns_atomic_wait::notify(static_cast<const std::atomic<value_t>&>(atomic_ref), true);
+	}
 
 
 	/* shorter aliases */
@@ -0,0 +1,584 @@
+// Copyright (c) 2015 Noah Lopez
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+/* slot_map<> is a container whose elements are referenced by "generational" pointers (TGenerationalPointer<>), which
+consist of a slot index and the "generation" of the slot at the time the pointer was obtained. Each time an element is
+removed, the generation of its slot is incremented, so any remaining pointers to it are recognized as stale, and
+attempting to dereference them results in an exception. Unlike registered pointers, which are maintained in a list
+associated with the target object, and norad pointers, which maintain a count in the target object, copying or
+destroying a generational pointer doesn't modify (or even access) the target object. Generational pointers are
+trivially copyable.
+
+The slot table of a slot_map<> isn't deallocated when the slot_map<> is destroyed. It is retained in a (per element
+type, per thread) pool for reuse by other slot_map<>s on the same thread. Slot generations are never reset, so pointers
+that outlive their slot_map<> continue to be recognized as stale. The (peak) memory retained is 2 * sizeof(size_t) per
+slot.
+
+Elements are stored contiguously (in no particular order), so iterating over them (via the for_each() member function)
+is as fast as iterating over a vector. Removing an element moves the last element into its place. */
+
+#pragma once
+#ifndef MSESLOTMAP_H_
+#define MSESLOTMAP_H_
+
+#include "msepointerbasics.h"
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <cassert>
+#include <stdexcept>
+#include <mutex>
+#include <exception>
+
+#if defined(MSE_SAFER_SUBSTITUTES_DISABLED) || defined(MSE_SAFERPTR_DISABLED)
+#define MSE_GENERATIONALPOINTER_DISABLED
+#endif /*defined(MSE_SAFER_SUBSTITUTES_DISABLED) || defined(MSE_SAFERPTR_DISABLED)*/
+
+#ifdef _MSC_VER
+#pragma warning( push )
+#pragma warning( disable : 4100 4456 4189 )
+#endif /*_MSC_VER*/
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-function"
+#else /*__clang__*/
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#endif /*__GNUC__*/
+#endif /*__clang__*/
+
+#ifdef MSE_CUSTOM_THROW_DEFINITION
+#include <iostream>
+#define MSE_THROW(x) MSE_CUSTOM_THROW_DEFINITION(x)
+#else // MSE_CUSTOM_THROW_DEFINITION
+#define MSE_THROW(x) throw(x)
+#endif // MSE_CUSTOM_THROW_DEFINITION
+
+#ifndef _NOEXCEPT
+#define _NOEXCEPT
+#endif /*_NOEXCEPT*/
+
+namespace mse {
+
+	class generational_pointer_stale_error : public std::logic_error {
+	public:
+		using std::logic_error::logic_error;
+	};
+
+	template<typename _Ty> class slot_map;
+	template<typename _Ty> class TGenerationalPointer;
+	template<typename _Ty> class TGenerationalConstPointer;
+
+	namespace us {
+		namespace impl {
+			namespace ns_slot_map {
+				/* The slot table (and the elements) of a slot_map<>. */
+				template<typename _Ty>
+				class TSlotTable {
+				public:
+					struct CSlot {
+						/* If the slot is occupied, the index of its element, otherwise the index of the next free slot. */
+						size_t m_dense_index_or_next_free;
+						size_t m_generation;
+					};
+					static const size_t sc_no_free_slot = size_t(-1);
+
+					/* Returns the element referenced by the given slot index and generation, or throws if it's stale. */
+					_Ty& checked_value_ref(size_t slot_index, size_t generation) {
+						const auto& slot_cref = m_slots[slot_index];
+#ifndef MSE_GENERATIONALPOINTER_DISABLED
+						if (slot_cref.m_generation != generation) {
+							MSE_THROW(generational_pointer_stale_error("attempt to dereference a stale pointer - mse::TGenerationalPointer"));
+						}
+#else // !MSE_GENERATIONALPOINTER_DISABLED
+						assert(slot_cref.m_generation == generation);
+#endif // !MSE_GENERATIONALPOINTER_DISABLED
+						return m_values[slot_cref.m_dense_index_or_next_free];
+					}
+					bool is_current(size_t slot_index, size_t generation) const {
+						return (m_slots[slot_index].m_generation == generation) && (0 == (generation & 1));
+					}
+					void structure_change_check() const {
+						if (0 != m_structure_lock_count) {
+							MSE_THROW(std::logic_error("attempt to insert or remove an element while the elements are being accessed - mse::slot_map"));
+						}
+					}
+
+					/* The generation of a slot is even while it is occupied and odd while it is free. */
+					std::vector<CSlot> m_slots;
+					std::vector<_Ty> m_values;
+					std::vector<size_t> m_dense_index_to_slot_index;
+					size_t m_first_free_slot_index = sc_no_free_slot;
+					/* The number of ongoing iterations and dereferences, during which the elements must not be moved (by
+					insertions or removals). This is kept in the table, rather than the slot_map<>, as moving a slot_map<>
+					transfers its table (without moving the elements). */
+					size_t m_structure_lock_count = 0;
+				};
+
+				/* Prevents insertions and removals (which may move the elements) for as long as it exists. */
+				template<typename _Ty>
+				class TStructureLockGuard {
+				public:
+					TStructureLockGuard(TSlotTable<_Ty>& table_ref) : m_table_ptr(&table_ref) { m_table_ptr->m_structure_lock_count += 1; }
+					TStructureLockGuard(TStructureLockGuard&& src) : m_table_ptr(src.m_table_ptr) { src.m_table_ptr = nullptr; }
+					~TStructureLockGuard() {
+						if (m_table_ptr) {
+							m_table_ptr->m_structure_lock_count -= 1;
+						}
+					}
+				private:
+					TStructureLockGuard(const TStructureLockGuard&) = delete;
+					TStructureLockGuard& operator=(const TStructureLockGuard&) = delete;
+
+					TSlotTable<_Ty>* m_table_ptr = nullptr;
+				};
+
+				/* The generational pointers' operator->() returns this (temporary) object, which holds a structure lock on the
+				target's slot_map<> until the end of the full expression. So the target can't be moved (or reallocated) out
+				from under a member function called through the pointer, even if that member function inserts or removes
+				elements via an alias of the slot_map<>. (Such an attempt results in an exception.) */
+				template<typename _Ty, typename _TTarget>
+				class TStructureLockedTargetPointer : private TStructureLockGuard<_Ty> {
+				public:
+					TStructureLockedTargetPointer(TSlotTable<_Ty>& table_ref, _TTarget& target_ref)
+						: TStructureLockGuard<_Ty>(table_ref), m_target_ptr(std::addressof(target_ref)) {}
+					TStructureLockedTargetPointer(TStructureLockedTargetPointer&& src) = default;
+					_TTarget* operator->() const { return m_target_ptr; }
+				private:
+					_TTarget* m_target_ptr;
+				};
+
+				/* The generational pointers' operator*() returns this (temporary) object, which likewise holds a structure
+				lock until the end of the full expression. It converts to a (native) reference to the target. Note that
+				members are accessed via the pointer's operator->() rather than (*ptr).member. */
+				template<typename _Ty, typename _TTarget>
+				class TStructureLockedTargetReference : private TStructureLockGuard<_Ty> {
+				public:
+					TStructureLockedTargetReference(TSlotTable<_Ty>& table_ref, _TTarget& target_ref)
+						: TStructureLockGuard<_Ty>(table_ref), m_target_ref(target_ref) {}
+					TStructureLockedTargetReference(TStructureLockedTargetReference&& src) = default;
+					operator _TTarget&() const { return m_target_ref; }
+					_TTarget& get() const { return m_target_ref; }
+					template<class _Ty2>
+					TStructureLockedTargetReference& operator=(_Ty2&& src) {
+						m_target_ref = std::forward<_Ty2>(src);
+						return *this;
+					}
+				private:
+					_TTarget& m_target_ref;
+				};
+
+				/* Slot tables are never deallocated. When a slot_map<> is destroyed, its elements are destroyed, all of its
+				slots are marked as free (with a new generation), and the table is retained for reuse. Each thread has its own
+				pool, so a released table is only reused by slot_map<>s on the thread that released it. Since neither
+				slot_map<>s nor generational pointers can be passed to (or shared with) other threads, this ensures that a stale
+				pointer is never dereferenced while another thread is modifying (or reallocating the slots of) its table. The
+				tables retained by a thread are made available to all threads when it exits. */
+				template<typename _Ty>
+				class TSlotTablePool {
+				public:
+					static TSlotTable<_Ty>* acquire() {
+						auto tl_pool_ptr = CThreadLocalPool::instance_ptr();
+						if (tl_pool_ptr && (!tl_pool_ptr->m_tables.empty())) {
+							auto retval = tl_pool_ptr->m_tables.back();
+							tl_pool_ptr->m_tables.pop_back();
+							return retval;
+						}
+						auto& orphans = orphan_pool();
+						{
+							std::lock_guard<std::mutex> lock(orphans.m_mutex);
+							if (!orphans.m_tables.empty()) {
+								auto retval = orphans.m_tables.back();
+								orphans.m_tables.pop_back();
+								return retval;
+							}
+						}
+						return new TSlotTable<_Ty>;
+					}
+					static void release(TSlotTable<_Ty>* table_ptr) {
+						auto& table = *table_ptr;
+						table.m_values.clear();
+						table.m_values.shrink_to_fit();
+						table.m_dense_index_to_slot_index.clear();
+						table.m_dense_index_to_slot_index.shrink_to_fit();
+						table.m_first_free_slot_index = TSlotTable<_Ty>::sc_no_free_slot;
+						for (size_t i = table.m_slots.size(); 0 < i; i -= 1) {
+							auto& slot = table.m_slots[i - 1];
+							if (0 == (slot.m_generation & 1)) {
+								slot.m_generation += 1;
+							}
+							slot.m_dense_index_or_next_free = table.m_first_free_slot_index;
+							table.m_first_free_slot_index = i - 1;
+						}
+
+						auto tl_pool_ptr = CThreadLocalPool::instance_ptr();
+						if (tl_pool_ptr) {
+							tl_pool_ptr->m_tables.push_back(table_ptr);
+						}
+						else {
+							/* This thread's pool has already been destroyed (i.e. the thread is exiting). */
+							auto& orphans = orphan_pool();
+							std::lock_guard<std::mutex> lock(orphans.m_mutex);
+							orphans.m_tables.push_back(table_ptr);
+						}
+					}
+
+				private:
+					class CThreadLocalPool {
+					public:
+						~CThreadLocalPool() {
+							tl_destroyed_ref() = true;
+							auto& orphans = orphan_pool();
+							std::lock_guard<std::mutex> lock(orphans.m_mutex);
+							orphans.m_tables.insert(orphans.m_tables.end(), m_tables.begin(), m_tables.end());
+						}
+						/* Returns null if the calling thread's pool has already been destroyed. */
+						static CThreadLocalPool* instance_ptr() {
+							if (tl_destroyed_ref()) {
+								return nullptr;
+							}
+							thread_local CThreadLocalPool tl_pool;
+							return &tl_pool;
+						}
+
+						std::vector<TSlotTable<_Ty>*> m_tables;
+
+					private:
+						static bool& tl_destroyed_ref() {
+							thread_local bool tl_destroyed = false;
+							return tl_destroyed;
+						}
+					};
+
+					/* The tables released by threads that have exited. */
+					class COrphanPool {
+					public:
+						std::mutex m_mutex;
+						std::vector<TSlotTable<_Ty>*> m_tables;
+					};
+					static COrphanPool& orphan_pool() {
+						/* Intentionally never destroyed, as slot_map<>s with static storage duration may be destroyed after it
+						otherwise would be. */
+						static COrphanPool* s_pool_ptr = new COrphanPool;
+						return *s_pool_ptr;
+					}
+				};
+
+				template<typename _Ty>
+				class TGenerationalPointerBase : public mse::us::impl::AsyncNotShareableAndNotPassableTagBase {
+				public:
+					TGenerationalPointerBase() {}
+
+					bool operator==(const TGenerationalPointerBase& rhs) const {
+						return (m_table_ptr == rhs.m_table_ptr) && (m_slot_index == rhs.m_slot_index) && (m_generation == rhs.m_generation);
+					}
+					bool operator!=(const TGenerationalPointerBase& rhs) const { return !((*this) == rhs); }
+
+				protected:
+					TGenerationalPointerBase(TSlotTable<_Ty>* table_ptr, size_t slot_index, size_t generation)
+						: m_table_ptr(table_ptr), m_slot_index(slot_index), m_generation(generation) {}
+
+					_Ty& checked_value_ref() const {
+						if (!m_table_ptr) { MSE_THROW(primitives_null_dereference_error("attempt to dereference null pointer - mse::TGenerationalPointer")); }
+						return m_table_ptr->checked_value_ref(m_slot_index, m_generation);
+					}
+					template<typename _TTarget>
+					TStructureLockedTargetPointer<_Ty, _TTarget> locked_target_pointer() const {
+						auto& value_ref = checked_value_ref();
+						return TStructureLockedTargetPointer<_Ty, _TTarget>(*m_table_ptr, value_ref);
+					}
+					template<typename _TTarget>
+					TStructureLockedTargetReference<_Ty, _TTarget> locked_target_reference() const {
+						auto& value_ref = checked_value_ref();
+						return TStructureLockedTargetReference<_Ty, _TTarget>(*m_table_ptr, value_ref);
+					}
+					bool is_null() const { return !m_table_ptr; }
+
+					TSlotTable<_Ty>* m_table_ptr = nullptr;
+					size_t m_slot_index = 0;
+					size_t m_generation = 0;
+
+					friend class mse::slot_map<_Ty>;
+				};
+			}
+		}
+	}
+
+	/* TGenerationalPointer<> is a (nullable) pointer to an element of a slot_map<>. Dereferencing a pointer whose target
+	has been removed (or whose slot_map<> has been destroyed) results in an exception. Since elements are moved by
+	insertions and removals, operator*() and operator->() return temporary objects that prevent insertions and removals
+	until the end of the full expression in which the target is accessed. */
+	template<typename _Ty>
+	class TGenerationalPointer : public mse::us::impl::ns_slot_map::TGenerationalPointerBase<_Ty> {
+	public:
+		typedef mse::us::impl::ns_slot_map::TGenerationalPointerBase<_Ty> base_class;
+		TGenerationalPointer() {}
+		TGenerationalPointer(std::nullptr_t) {}
+		TGenerationalPointer(const TGenerationalPointer&) = default;
+		TGenerationalPointer& operator=(const TGenerationalPointer&) = default;
+
+		mse::us::impl::ns_slot_map::TStructureLockedTargetReference<_Ty, _Ty> operator*() const { return base_class::template locked_target_reference<_Ty>(); }
+		mse::us::impl::ns_slot_map::TStructureLockedTargetPointer<_Ty, _Ty> operator->() const { return base_class::template locked_target_pointer<_Ty>(); }
+		explicit operator bool() const { return !base_class::is_null(); }
+
+	private:
+		TGenerationalPointer(mse::us::impl::ns_slot_map::TSlotTable<_Ty>* table_ptr, size_t slot_index, size_t generation)
+			: base_class(table_ptr, slot_index, generation) {}
+
+		friend class slot_map<_Ty>;
+		friend class TGenerationalConstPointer<_Ty>;
+	};
+
+	template<typename _Ty>
+	class TGenerationalConstPointer : public mse::us::impl::ns_slot_map::TGenerationalPointerBase<_Ty> {
+	public:
+		typedef mse::us::impl::ns_slot_map::TGenerationalPointerBase<_Ty> base_class;
+		TGenerationalConstPointer() {}
+		TGenerationalConstPointer(std::nullptr_t) {}
+		TGenerationalConstPointer(const TGenerationalConstPointer&) = default;
+		TGenerationalConstPointer(const TGenerationalPointer<_Ty>& src) : base_class(src) {}
+		TGenerationalConstPointer& operator=(const TGenerationalConstPointer&) = default;
+
+		mse::us::impl::ns_slot_map::TStructureLockedTargetReference<_Ty, const _Ty> operator*() const { return base_class::template locked_target_reference<const _Ty>(); }
+		mse::us::impl::ns_slot_map::TStructureLockedTargetPointer<_Ty, const _Ty> operator->() const { return base_class::template locked_target_pointer<const _Ty>(); }
+		explicit operator bool() const { return !base_class::is_null(); }
+
+	private:
+		friend class slot_map<_Ty>;
+	};
+
+	/* slot_map<> is not thread safe. Structural changes (insertions and removals) are not permitted while for_each() is
+	iterating over the elements, or while an element is being accessed via a generational pointer. Moving a slot_map<>
+	transfers its elements' storage (without moving the elements), so existing pointers remain valid. */
+	template<typename _Ty>
+	class slot_map {
+	public:
+		typedef _Ty value_type;
+		typedef size_t size_type;
+		typedef TGenerationalPointer<_Ty> pointer;
+		typedef TGenerationalConstPointer<_Ty> const_pointer;
+
+		/* A slot table is only acquired when the first element is inserted. */
+		slot_map() {}
+		slot_map(const slot_map& src) {
+			/* The copy gets its own slots, so pointers to the source's elements don't refer to the copy's elements. */
+			if (src.m_table_ptr) {
+				for (const auto& value : src.m_table_ptr->m_values) {
+					insert(value);
+				}
+			}
+		}
+		/* noexcept, so that (for example) a growing std::vector<slot_map<> > moves its slot_map<>s rather than copying
+		them (which would render existing pointers stale). Taking the source's table doesn't move its elements, so this
+		is permitted even while the source is being iterated over. */
+		slot_map(slot_map&& src) noexcept : m_table_ptr(src.m_table_ptr) {
+			/* Existing pointers continue to refer to the (unmoved) elements. */
+			src.m_table_ptr = nullptr;
+		}
+		~slot_map() {
+			release_table();
+		}
+
+		slot_map& operator=(const slot_map& src) {
+			if (&src != this) {
+				slot_map tmp(src);
+				(*this) = std::move(tmp);
+			}
+			return *this;
+		}
+		slot_map& operator=(slot_map&& src) {
+			if (&src != this) {
+				structure_change_check();
+				release_table();
+				m_table_ptr = src.m_table_ptr;
+				src.m_table_ptr = nullptr;
+			}
+			return *this;
+		}
+
+		template<class... Args>
+		pointer emplace(Args&&... args) {
+			structure_change_check();
+			auto& table = table_ref();
+			/* Memory is reserved in advance so that nothing needs to be undone if the element's constructor throws. */
+			reserve_for_one_more(table.m_dense_index_to_slot_index);
+			const bool no_free_slot = (table_t::sc_no_free_slot == table.m_first_free_slot_index);
+			if (no_free_slot) {
+				reserve_for_one_more(table.m_slots);
+			}
+			table.m_values.emplace_back(std::forward<Args>(args)...);
+
+			size_t slot_index = table.m_first_free_slot_index;
+			if (no_free_slot) {
+				slot_index = table.m_slots.size();
+				table.m_slots.push_back(typename table_t::CSlot{ table_t::sc_no_free_slot, 1 });
+			}
+			auto& slot = table.m_slots[slot_index];
+			table.m_first_free_slot_index = slot.m_dense_index_or_next_free;
+			table.m_dense_index_to_slot_index.push_back(slot_index);
+			slot.m_dense_index_or_next_free = table.m_values.size() - 1;
+			slot.m_generation += 1;
+			return pointer(m_table_ptr, slot_index, slot.m_generation);
+		}
+		pointer insert(const _Ty& value) { return emplace(value); }
+		pointer insert(_Ty&& value) { return emplace(std::move(value)); }
+
+		/* Removes the target element. Returns false (and does nothing) if the pointer is stale or refers to an element
+		of a different slot_map<>. */
+		bool erase(const const_pointer& ptr) {
+			structure_change_check();
+			if (!contains(ptr)) {
+				return false;
+			}
+			auto& table = *m_table_ptr;
+			auto& slot = table.m_slots[ptr.m_slot_index];
+			const auto dense_index = slot.m_dense_index_or_next_free;
+			const auto last_dense_index = table.m_values.size() - 1;
+			if (last_dense_index != dense_index) {
+				table.m_values[dense_index] = std::move(table.m_values[last_dense_index]);
+				const auto moved_slot_index = table.m_dense_index_to_slot_index[last_dense_index];
+				table.m_dense_index_to_slot_index[dense_index] = moved_slot_index;
+				table.m_slots[moved_slot_index].m_dense_index_or_next_free = dense_index;
+			}
+			table.m_values.pop_back();
+			table.m_dense_index_to_slot_index.pop_back();
+
+			slot.m_generation += 1;
+			slot.m_dense_index_or_next_free = table.m_first_free_slot_index;
+			table.m_first_free_slot_index = ptr.m_slot_index;
+			return true;
+		}
+		bool erase(const pointer& ptr) { return erase(const_pointer(ptr)); }
+
+		/* Indicates whether the pointer refers to a (current) element of this slot_map<>. */
+		bool contains(const const_pointer& ptr) const {
+			return m_table_ptr && (ptr.m_table_ptr == m_table_ptr) && m_table_ptr->is_current(ptr.m_slot_index, ptr.m_generation);
+		}
+		bool contains(const pointer& ptr) const { return contains(const_pointer(ptr)); }
+
+		/* Like the pointers' operator*(), at() returns a (temporary) reference object that prevents insertions and
+		removals until the end of the full expression. */
+		decltype(*std::declval<pointer>()) at(const pointer& ptr) {
+			if (ptr.m_table_ptr != m_table_ptr) { MSE_THROW(std::invalid_argument("the pointer does not refer to an element of this container - mse::slot_map")); }
+			return *ptr;
+		}
+		decltype(*std::declval<const_pointer>()) at(const const_pointer& ptr) const {
+			if (ptr.m_table_ptr != m_table_ptr) { MSE_THROW(std::invalid_argument("the pointer does not refer to an element of this container - mse::slot_map")); }
+			return *ptr;
+		}
+
+		size_type size() const { return m_table_ptr ? m_table_ptr->m_values.size() : 0; }
+		bool empty() const { return (0 == size()); }
+		void reserve(size_type new_capacity) {
+			structure_change_check();
+			auto& table = table_ref();
+			table.m_values.reserve(new_capacity);
+			table.m_dense_index_to_slot_index.reserve(new_capacity);
+			table.m_slots.reserve(new_capacity);
+		}
+		void clear() {
+			structure_change_check();
+			while (!empty()) {
+				erase(pointer_at_dense_index(size() - 1));
+			}
+		}
+
+		/* Calls the given function for each element (in no particular order). Insertions and removals are not permitted
+		during the iteration. */
+		template<class _TFunction>
+		void for_each(_TFunction func) {
+			if (!m_table_ptr) {
+				return;
+			}
+			auto& table = *m_table_ptr;
+			structure_lock_guard_t guard(table);
+			for (auto& value : table.m_values) {
+				func(value);
+			}
+		}
+		template<class _TFunction>
+		void for_each(_TFunction func) const {
+			if (!m_table_ptr) {
+				return;
+			}
+			const auto& table = *m_table_ptr;
+			structure_lock_guard_t guard(*m_table_ptr);
+			for (const auto& value : table.m_values) {
+				func(value);
+			}
+		}
+
+		/* The elements are stored contiguously, in no particular order. The "dense index" of an element may change when
+		other elements are removed. */
+		pointer pointer_at_dense_index(size_type dense_index) {
+			if (size() <= dense_index) { MSE_THROW(std::out_of_range("index out of range - mse::slot_map")); }
+			const auto slot_index = m_table_ptr->m_dense_index_to_slot_index[dense_index];
+			return pointer(m_table_ptr, slot_index, m_table_ptr->m_slots[slot_index].m_generation);
+		}
+		const_pointer pointer_at_dense_index(size_type dense_index) const {
+			return const_cast<slot_map*>(this)->pointer_at_dense_index(dense_index);
+		}
+
+	private:
+		typedef mse::us::impl::ns_slot_map::TSlotTable<_Ty> table_t;
+		typedef mse::us::impl::ns_slot_map::TSlotTablePool<_Ty> pool_t;
+
+		typedef mse::us::impl::ns_slot_map::TStructureLockGuard<_Ty> structure_lock_guard_t;
+
+		void structure_change_check() const {
+			if (m_table_ptr) {
+				m_table_ptr->structure_change_check();
+			}
+		}
+		table_t& table_ref() {
+			if (!m_table_ptr) {
+				m_table_ptr = pool_t::acquire();
+			}
+			return *m_table_ptr;
+		}
+		/* Grows the capacity geometrically (if necessary), so that insertions take amortized constant time. */
+		template<class _TVector>
+		static void reserve_for_one_more(_TVector& vec) {
+			if (vec.size() == vec.capacity()) {
+				vec.reserve(2 * vec.capacity() + 1);
+			}
+		}
+		void release_table() {
+			if (m_table_ptr) {
+				if (0 != m_table_ptr->m_structure_lock_count) {
+					/* The slot_map<> is being destroyed while its elements are being accessed (i.e. by a function called
+					from for_each() or through a generational pointer). As with the destruction of an object targeted by a
+					norad pointer, termination is the only safe option. */
+					assert(false);
+					std::terminate();
+				}
+				pool_t::release(m_table_ptr);
+				m_table_ptr = nullptr;
+			}
+		}
+
+		table_t* m_table_ptr = nullptr;
+	};
+}
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#else /*__clang__*/
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif /*__GNUC__*/
+#endif /*__clang__*/
+
+#ifdef _MSC_VER
+#pragma warning( pop )
+#endif /*_MSC_VER*/
+
+#undef MSE_THROW
+
+#endif // MSESLOTMAP_H_
@@ -15,6 +15,11 @@
 #include <utility>
 #include <unordered_set>
 #include <functional>
+#include <tuple>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <memory>
 #include <cassert>
 
 #if defined(MSE_SAFER_SUBSTITUTES_DISABLED) || defined(MSE_SAFERPTR_DISABLED)
@@ -28,6 +33,9 @@
 #ifdef MSE_CHECKEDTHREADSAFEPOINTER
 #include "msenorad.h"
 #include <atomic>
+#ifdef MSE_CHECKED_THREAD_SAFE_USE_HAZARD_POINTERS
+#include "msehazard.h"
+#endif // MSE_CHECKED_THREAD_SAFE_USE_HAZARD_POINTERS
 #endif // MSE_CHECKEDTHREADSAFEPOINTER
 
 #ifdef _MSC_VER
@@ -82,7 +90,15 @@ namespace mse {
 				};
 				typedef CNoOpCopyAtomicInt atomic_int_t;
 
-#ifndef MSE_CHECKED_THREAD_SAFE_DO_NOT_USE_GNORAD
+#if defined(MSE_CHECKED_THREAD_SAFE_USE_HAZARD_POINTERS)
+				/* Hazard pointers don't modify (a counter in) the target object when they're copied, so they may scale better
+				when many threads are copying pointers to the same object. See msehazard.h. */
+				template<typename _Ty> using TCheckedThreadSafeObj = mse::THazardObj<_Ty>;
+				template<typename _Ty> using TCheckedThreadSafePointer = mse::THazardPointer<_Ty>;
+				template<typename _Ty> using TCheckedThreadSafeConstPointer = mse::THazardConstPointer<_Ty>;
+				template<typename _Ty> using TCheckedThreadSafeFixedPointer = mse::THazardFixedPointer<_Ty>;
+				template<typename _Ty> using TCheckedThreadSafeFixedConstPointer = mse::THazardFixedConstPointer<_Ty>;
+#elif !defined(MSE_CHECKED_THREAD_SAFE_DO_NOT_USE_GNORAD)
 				template<typename _Ty> using TCheckedThreadSafeObj = mse::us::impl::TGNoradObj<_Ty, atomic_int_t>;
 				template<typename _Ty> using TCheckedThreadSafePointer = mse::us::impl::TGNoradPointer<_Ty, atomic_int_t>;
 				template<typename _Ty> using TCheckedThreadSafeConstPointer = mse::us::impl::TGNoradConstPointer<_Ty, atomic_int_t>;
@@ -540,10 +556,147 @@ namespace mse {
 		/* end of template specializations */
 
 #endif /*MSE_STATICPOINTER_DISABLED*/
+
+		/* TStaticImmutableLazyObj<> is an alternative to TStaticImmutableObj<> whose target object is constructed (in a
+		thread-safe way) on first access rather than at (static) declaration time. The target object is allocated on the
+		heap and intentionally never destroyed (or deallocated), like the library's static registries. Because the target
+		outlives every pointer to it (including any used by other static destructors or detached threads during process
+		exit, and even if the TStaticImmutableLazyObj<> itself is (mis)used as a non-static object and destroyed), its
+		pointers need no run-time reference counting, even when MSE_STATICIMMUTABLEPOINTER_RUNTIME_CHECKS_ENABLED is
+		defined. So (unlike the pointers of TStaticImmutableObj<>) obtaining, copying and discarding them never writes to
+		memory shared between threads. After initialization, access just costs one (acquire) load. Objects of this type
+		should only be declared via the provided macros. */
+		template<typename _TROy> class TStaticImmutableLazyObj;
+
+#ifdef MSE_STATICPOINTER_DISABLED
+		template<typename _Ty> using TStaticImmutableLazyFixedConstPointer = const _Ty*;
+		template<typename _Ty> using TStaticImmutableLazyFixedPointer = TStaticImmutableLazyFixedConstPointer<_Ty>;
+#else /*MSE_STATICPOINTER_DISABLED*/
+		template<typename _Ty>
+		class TStaticImmutableLazyFixedConstPointer : public mse::us::impl::TPointerForLegacy<const _Ty, TStaticImmutableID<const _Ty>>
+			, public mse::us::impl::StrongPointerTagBase, public mse::us::impl::NeverNullTagBase {
+		public:
+			typedef mse::us::impl::TPointerForLegacy<const _Ty, TStaticImmutableID<const _Ty>> base_class;
+			TStaticImmutableLazyFixedConstPointer(const TStaticImmutableLazyFixedConstPointer<_Ty>& src_cref) : base_class(static_cast<const base_class&>(src_cref)) {}
+			template<class _Ty2, class = typename std::enable_if<std::is_convertible<_Ty2 *, _Ty *>::value, void>::type>
+			TStaticImmutableLazyFixedConstPointer(const TStaticImmutableLazyFixedConstPointer<_Ty2>& src_cref) : base_class(std::addressof(*src_cref)) {}
+			virtual ~TStaticImmutableLazyFixedConstPointer() {}
+			operator bool() const { return true; }
+			/* This native pointer cast operator is just for compatibility with existing/legacy code and ideally should never be used. */
+			explicit operator const _Ty*() const { return std::addressof(*(*static_cast<const base_class*>(this))); }
+			void static_tag() const {}
+			void async_passable_tag() const {} /* Indication that this type is eligible to be passed between threads. */
+
+		private:
+			TStaticImmutableLazyFixedConstPointer(const _Ty* ptr) : base_class(ptr) {}
+			TStaticImmutableLazyFixedConstPointer<_Ty>& operator=(const TStaticImmutableLazyFixedConstPointer<_Ty>& _Right_cref) = delete;
+			MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
+
+			template<typename _Ty2> friend class TStaticImmutableLazyFixedConstPointer;
+			friend class TStaticImmutableLazyObj<_Ty>;
+		};
+		template<typename _Ty> using TStaticImmutableLazyFixedPointer = TStaticImmutableLazyFixedConstPointer<_Ty>;
+#endif /*MSE_STATICPOINTER_DISABLED*/
+
+		template<typename _TROy>
+		class TStaticImmutableLazyObj {
+		public:
+			/* The constructor arguments are stored (by value) until the target object is constructed from them. They may be
+			of move-only types. */
+			template<class... Args>
+			TStaticImmutableLazyObj(Args&&... args) : m_initializer(make_initializer(std::make_tuple(std::forward<Args>(args)...)
+				, typename std::make_index_sequence<sizeof...(Args)>())) {}
+			TStaticImmutableLazyObj(const TStaticImmutableLazyObj&) = delete;
+			TStaticImmutableLazyObj(TStaticImmutableLazyObj&&) = delete;
+
+			~TStaticImmutableLazyObj() {
+				mse::impl::T_valid_if_is_marked_as_xscope_shareable_msemsearray<_TROy>();
+				/* The (heap allocated) target object is deliberately leaked. (It is "quiesced" rather than destroyed at
+				process exit.) This is what allows its pointers to forgo reference counting. */
+			}
+
+			const TStaticImmutableLazyFixedConstPointer<_TROy> operator&() const & {
+				return TStaticImmutableLazyFixedConstPointer<_TROy>(target_ptr());
+			}
+			const TStaticImmutableLazyFixedConstPointer<_TROy> mse_static_fptr() const & { return &(*this); }
+			const _TROy& operator*() const & { return *target_ptr(); }
+			const _TROy* operator->() const & { return target_ptr(); }
+
+			/* Returns whether the target object has been constructed yet. */
+			bool is_initialized() const { return (nullptr != m_target_ptr.load(std::memory_order_acquire)); }
+
+			void operator&() && = delete;
+			void operator&() const && = delete;
+			void mse_static_fptr() && = delete;
+			void mse_static_fptr() const && = delete;
+
+			void static_tag() const {}
+
+		private:
+			/* The initializer holding the stored arguments is type erased (rather than held in an std::function<>, which
+			would require the arguments to be copyable). */
+			class CInitializerBase {
+			public:
+				virtual ~CInitializerBase() {}
+				virtual const _TROy* construct() = 0;
+			};
+			/* The stored arguments are passed to the target object's constructor as (const) lvalues rather than moved, so
+			that they remain intact if construction throws and has to be re-attempted. Arguments of move-only types can't
+			be passed that way, so they are moved, and, if construction throws, the retry gets the moved-from values. */
+			template<class _TTuple, size_t... Is>
+			class TInitializer : public CInitializerBase {
+			public:
+				TInitializer(_TTuple&& args_tuple) : m_args_tuple(std::move(args_tuple)) {}
+				const _TROy* construct() override {
+					return new _TROy(stored_arg(std::get<Is>(m_args_tuple))...);
+				}
+			private:
+				template<class _TArg, class = typename std::enable_if<std::is_copy_constructible<_TArg>::value>::type>
+				static const _TArg& stored_arg(_TArg& arg) { return arg; }
+				template<class _TArg, class = typename std::enable_if<!std::is_copy_constructible<_TArg>::value>::type, class = void>
+				static _TArg&& stored_arg(_TArg& arg) { return std::move(arg); }
+
+				_TTuple m_args_tuple;
+			};
+			template<class _TTuple, size_t... Is>
+			static std::unique_ptr<CInitializerBase> make_initializer(_TTuple&& args_tuple, std::index_sequence<Is...>) {
+				return std::unique_ptr<CInitializerBase>(new TInitializer<typename std::decay<_TTuple>::type, Is...>(std::move(args_tuple)));
+			}
+
+			const _TROy* target_ptr() const {
+				auto retval = m_target_ptr.load(std::memory_order_acquire);
+				if (!retval) {
+					/* If the constructor throws, the object remains uninitialized and construction will be re-attempted
+					on the next access. (See make_initializer().) */
+					std::call_once(m_once_flag, [this]() {
+						const auto l_target_ptr = m_initializer->construct();
+						m_initializer = nullptr;
+						m_target_ptr.store(l_target_ptr, std::memory_order_release);
+					});
+					retval = m_target_ptr.load(std::memory_order_acquire);
+				}
+				return retval;
+			}
+
+			void operator&() & {
+				/* This object does not seem to be declared const, which is not valid. Objects of this type should only be
+				declared via the provided macro that declares them (static and) const. */
+			}
+			void mse_static_fptr() & { &(*this); }
+
+			void* operator new(size_t size) { return ::operator new(size); }
+
+			/* Points to the (intentionally leaked) target object once it has been constructed. */
+			mutable std::atomic<const _TROy*> m_target_ptr{ nullptr };
+			mutable std::once_flag m_once_flag;
+			mutable std::unique_ptr<CInitializerBase> m_initializer;
+		};
 	}
 
 #define MSE_DECLARE_STATIC_IMMUTABLE(type) static const mse::rsv::TStaticImmutableObj<type> 
 #define MSE_RSV_DECLARE_GLOBAL_IMMUTABLE(type) const mse::rsv::TStaticImmutableObj<type> 
+#define MSE_DECLARE_STATIC_IMMUTABLE_LAZY(type) static const mse::rsv::TStaticImmutableLazyObj<type> 
+#define MSE_RSV_DECLARE_GLOBAL_IMMUTABLE_LAZY(type) const mse::rsv::TStaticImmutableLazyObj<type> 
 
 
 	namespace self_test {
@@ -0,0 +1,227 @@
+// Copyright (c) 2015 Noah Lopez
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+/* When MSE_ENABLE_STATS is defined, the library counts (per thread) the occurrences of certain events associated with
+its run-time safety mechanisms (bounds checks, registered pointer (un)linking, etc.). The (process-wide) totals can be
+obtained at any time via mse::stats::snapshot(). Defining MSE_STATS_DUMP_ON_EXIT (or calling
+mse::stats::set_dump_on_exit(true)) causes the totals to be written to std::cerr when the program exits.
+
+Each thread increments its own (cache line aligned) set of counters without any read-modify-write atomic operations, so
+the overhead is small. But it is not zero, so the counting is disabled by default. When MSE_ENABLE_STATS is not defined,
+the counting macros expand to nothing, and snapshot() returns all zeros. */
+
+#pragma once
+#ifndef MSESTATS_H_
+#define MSESTATS_H_
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <ostream>
+#ifdef MSE_ENABLE_STATS
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <algorithm>
+#include <iostream>
+#endif // MSE_ENABLE_STATS
+
+namespace mse {
+	namespace stats {
+
+		enum class event_t : size_t {
+			bounds_check,					/* index checked by at(), operator[] or an iterator's operator[] */
+			structure_change_lock,			/* gnii_vector<>'s structure change mutex acquired */
+			mm_iterator_set_shift,			/* msevector<>'s (or msebasic_string<>'s) set of "mm" iterators adjusted */
+			registered_link,				/* registered pointer added to its target's list */
+			registered_unlink,				/* registered pointer removed from its target's list */
+			registered_unlink_walk_steps,	/* list nodes traversed while removing registered pointers */
+			norad_refcount_op,				/* norad object's reference count incremented or decremented */
+			mutex_lock_wait,				/* recursive_shared_timed_mutex lock attempt that had to block */
+			count
+		};
+		static const size_t number_of_events = size_t(event_t::count);
+
+		inline const char* event_name(event_t event) {
+			static const char* const s_names[number_of_events] = { "bounds_check", "structure_change_lock", "mm_iterator_set_shift"
+				, "registered_link", "registered_unlink", "registered_unlink_walk_steps", "norad_refcount_op", "mutex_lock_wait" };
+			return (number_of_events > size_t(event)) ? s_names[size_t(event)] : "";
+		}
+
+		class snapshot_t {
+		public:
+			snapshot_t() { m_counts.fill(0); }
+
+			uint64_t operator[](event_t event) const { return m_counts[size_t(event)]; }
+			uint64_t& operator[](event_t event) { return m_counts[size_t(event)]; }
+
+			/* The difference of two snapshots gives the counts for the interval between them. */
+			snapshot_t operator-(const snapshot_t& rhs) const {
+				snapshot_t retval;
+				for (size_t i = 0; number_of_events > i; i += 1) {
+					retval.m_counts[i] = m_counts[i] - rhs.m_counts[i];
+				}
+				return retval;
+			}
+
+			void dump(std::ostream& os) const {
+				os << "mse::stats:\n";
+				for (size_t i = 0; number_of_events > i; i += 1) {
+					os << "  " << event_name(event_t(i)) << ": " << m_counts[i] << "\n";
+				}
+			}
+
+		private:
+			std::array<uint64_t, number_of_events> m_counts;
+		};
+
+#ifdef MSE_ENABLE_STATS
+
+		namespace impl {
+			class CThreadCounters;
+
+			class CRegistry {
+			public:
+				void add(CThreadCounters* counters_ptr) {
+					std::lock_guard<std::mutex> lock1(m_mutex);
+					m_live_counters.push_back(counters_ptr);
+				}
+				inline void retire(CThreadCounters* counters_ptr);
+				inline snapshot_t snapshot();
+
+				std::atomic<bool> m_dump_on_exit {
+#ifdef MSE_STATS_DUMP_ON_EXIT
+					true
+#else // MSE_STATS_DUMP_ON_EXIT
+					false
+#endif // MSE_STATS_DUMP_ON_EXIT
+				};
+
+			private:
+				std::mutex m_mutex;
+				std::vector<CThreadCounters*> m_live_counters;
+				snapshot_t m_retired_counts;
+			};
+
+			class CDumpOnExit {
+			public:
+				inline ~CDumpOnExit();
+			};
+
+			/* The registry is intentionally never destroyed, as threads (like those of a static thread pool) may still be
+			retiring their counters after static objects have started being destroyed. */
+			inline CRegistry& registry() {
+				static CRegistry* s_registry_ptr = new CRegistry();
+				static CDumpOnExit s_dump_on_exit;
+				return *s_registry_ptr;
+			}
+
+			/* Only the owning thread ever modifies these counters, so they can be updated with plain (relaxed) loads and
+			stores. They are atomic only so that other threads can read them (via snapshot()) without a data race. */
+			class alignas(64) CThreadCounters {
+			public:
+				CThreadCounters() {
+					for (auto& count : m_counts) {
+						count.store(0, std::memory_order_relaxed);
+					}
+					registry().add(this);
+				}
+				~CThreadCounters() {
+					registry().retire(this);
+				}
+				void add(event_t event, uint64_t n) {
+					auto& count = m_counts[size_t(event)];
+					count.store(count.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+				}
+				void add_to(snapshot_t& totals) const {
+					for (size_t i = 0; number_of_events > i; i += 1) {
+						totals[event_t(i)] += m_counts[i].load(std::memory_order_relaxed);
+					}
+				}
+
+			private:
+				std::array<std::atomic<uint64_t>, number_of_events> m_counts;
+			};
+
+			inline void CRegistry::retire(CThreadCounters* counters_ptr) {
+				std::lock_guard<std::mutex> lock1(m_mutex);
+				counters_ptr->add_to(m_retired_counts);
+				auto found_it = std::find(m_live_counters.begin(), m_live_counters.end(), counters_ptr);
+				if (m_live_counters.end() != found_it) {
+					m_live_counters.erase(found_it);
+				}
+			}
+			inline snapshot_t CRegistry::snapshot() {
+				std::lock_guard<std::mutex> lock1(m_mutex);
+				snapshot_t retval = m_retired_counts;
+				for (auto counters_ptr : m_live_counters) {
+					counters_ptr->add_to(retval);
+				}
+				return retval;
+			}
+
+			inline CDumpOnExit::~CDumpOnExit() {
+				auto& registry_ref = registry();
+				if (registry_ref.m_dump_on_exit) {
+					registry_ref.snapshot().dump(std::cerr);
+				}
+			}
+
+			inline CThreadCounters& thread_counters() {
+				thread_local CThreadCounters tl_counters;
+				return tl_counters;
+			}
+
+			/* A mutex that counts (as the given event) each acquisition of the lock. */
+			template<class _TMutex, event_t _Event>
+			class TCountedMutex : public _TMutex {
+			public:
+				typedef _TMutex base_class;
+
+				void lock() {
+					base_class::lock();
+					thread_counters().add(_Event, 1);
+				}
+				bool try_lock() {
+					auto retval = base_class::try_lock();
+					if (retval) { thread_counters().add(_Event, 1); }
+					return retval;
+				}
+				void lock_shared() {
+					base_class::lock_shared();
+					thread_counters().add(_Event, 1);
+				}
+				bool try_lock_shared() {
+					auto retval = base_class::try_lock_shared();
+					if (retval) { thread_counters().add(_Event, 1); }
+					return retval;
+				}
+			};
+		}
+
+		inline snapshot_t snapshot() { return impl::registry().snapshot(); }
+		inline void set_dump_on_exit(bool dump_on_exit) { impl::registry().m_dump_on_exit = dump_on_exit; }
+
+#define MSE_STATS_ADD(event, n) mse::stats::impl::thread_counters().add(mse::stats::event_t::event, uint64_t(n))
+#define MSE_STATS_INCREMENT(event) MSE_STATS_ADD(event, 1)
+
+#else // MSE_ENABLE_STATS
+
+		namespace impl {
+			template<class _TMutex, event_t _Event>
+			using TCountedMutex = _TMutex;
+		}
+
+		inline snapshot_t snapshot() { return snapshot_t(); }
+		inline void set_dump_on_exit(bool) {}
+
+#define MSE_STATS_ADD(event, n)
+#define MSE_STATS_INCREMENT(event)
+
+#endif // MSE_ENABLE_STATS
+	}
+}
+
+#endif // MSESTATS_H_
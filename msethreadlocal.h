@@ -10,6 +10,7 @@
 
 #include "msepointerbasics.h"
 #include "mseprimitives.h"
+#include "msescope.h"
 #include <utility>
 #include <unordered_set>
 #include <functional>
@@ -467,6 +468,58 @@ namespace mse {
 		/* end of template specializations */
 
 #endif /*MSE_THREADLOCALPOINTER_DISABLED*/
+
+		/* TXScopeThreadLocalHandle<> resolves the address of a thread_local object (which may involve a TLS lookup) and
+		obtains a (possibly reference counting) thread_local pointer to it just once, when it is constructed. For the rest
+		of the (handle's) scope, the object can be accessed, and scope pointers to it obtained, without repeating either. It
+		is intended for code that accesses the same thread_local object many times. Use make_xscope_thread_local_handle()
+		to construct one. */
+		template<typename _TThreadLocalPointer>
+		class TXScopeThreadLocalHandle : public mse::us::impl::XScopeTagBase {
+		public:
+			typedef typename std::remove_reference<decltype(*std::declval<_TThreadLocalPointer>())>::type target_t;
+
+			TXScopeThreadLocalHandle(const TXScopeThreadLocalHandle&) = delete;
+			TXScopeThreadLocalHandle(TXScopeThreadLocalHandle&&) = default;
+
+			TXScopeThreadLocalHandle(const _TThreadLocalPointer& thread_local_ptr)
+				: m_thread_local_ptr(thread_local_ptr), m_target_ptr(std::addressof(*thread_local_ptr)) {}
+
+			target_t& operator*() const { return *m_target_ptr; }
+			target_t* operator->() const { return m_target_ptr; }
+
+			auto xscope_ptr() const & {
+				return make_xscope_ptr_helper(typename std::is_const<target_t>::type(), *m_target_ptr);
+			}
+			void xscope_ptr() const && = delete;
+			auto xscope_const_ptr() const & {
+				return mse::us::unsafe_make_xscope_const_pointer_to(*m_target_ptr);
+			}
+			void xscope_const_ptr() const && = delete;
+
+			const _TThreadLocalPointer& thread_local_ptr() const { return m_thread_local_ptr; }
+
+		private:
+			static auto make_xscope_ptr_helper(std::true_type, target_t& ref) {
+				return mse::us::unsafe_make_xscope_const_pointer_to(ref);
+			}
+			static auto make_xscope_ptr_helper(std::false_type, target_t& ref) {
+				return mse::us::unsafe_make_xscope_pointer_to(ref);
+			}
+
+			/* The stored thread_local pointer is what ensures (when run-time checks are enabled) that the target
+			object isn't destroyed while the handle, or scope pointers obtained from it, exist. */
+			_TThreadLocalPointer m_thread_local_ptr;
+			target_t* m_target_ptr = nullptr;
+
+			MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
+		};
+
+		template<typename _TThreadLocalObj>
+		auto make_xscope_thread_local_handle(_TThreadLocalObj& tl_obj) {
+			typedef typename std::remove_const<decltype(&tl_obj)>::type thread_local_pointer_t;
+			return TXScopeThreadLocalHandle<thread_local_pointer_t>(&tl_obj);
+		}
 	}
 
 #define MSE_DECLARE_THREAD_LOCAL(type) thread_local mse::rsv::TThreadLocalObj<type> 
@@ -20,9 +20,11 @@ types. Your best bet is probably to use a find/search to get to the data type yo
 #include "mseregistered.h"
 #include "msecregistered.h"
 #include "msenorad.h"
+#include "mseslotmap.h"
 #include "mserefcounting.h"
 #include "msescope.h"
 #include "mseasyncshared.h"
+#include "msescopeatomic.h"
 #include "msepoly.h"
 #include "msemsearray.h"
 #include "msemstdarray.h"
@@ -32,6 +34,7 @@ types. Your best bet is probably to use a find/search to get to the data type yo
 #include "msevector_test.h"
 #include "mselegacyhelpers.h"
 #include "msemstdstring.h"
+#include "msestats.h"
 #include <algorithm>
 #include <iostream>
 #include <ctime>
@@ -133,6 +136,144 @@ public:
 /* User-defined classes need to be declared as (safely) shareable in order to be accepted by the access requesters. */
 typedef mse::us::TUserDeclaredAsyncShareableAndPassableObj<H> ShareableH;
 
+/* Used by the benchmark comparing the lock acquisition latencies of the access requesters' shared mutex policies. (Local
+classes can't have templated member functions.) */
+class CLockPolicyBenchmark {
+public:
+	/* Returns the time (in nanoseconds) each of the lock acquisitions had to wait. */
+	template<class _TAccessRequester>
+	static mse::nii_vector<long long> timed_acquisitions(_TAccessRequester ar, bool exclusive, int number_of_acquisitions) {
+		mse::nii_vector<long long> latencies;
+		latencies.reserve(number_of_acquisitions);
+		for (int i = 0; i < number_of_acquisitions; i += 1) {
+			auto t1 = std::chrono::steady_clock::now();
+			if (exclusive) {
+				auto ptr = ar.writelock_ptr();
+				auto t2 = std::chrono::steady_clock::now();
+				latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count());
+				for (size_t j = 0; j < ptr->size(); j += 1) {
+					(*ptr)[j] += 1;
+				}
+			}
+			else {
+				auto ptr = ar.readlock_ptr();
+				auto t2 = std::chrono::steady_clock::now();
+				latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count());
+				int sum = 0;
+				for (size_t j = 0; j < ptr->size(); j += 1) {
+					sum += (*ptr)[j];
+				}
+				assert(0 <= sum);
+			}
+		}
+		return latencies;
+	}
+
+	/* Three reader threads and one writer thread contend for the same object. */
+	template<class _TSharedMutex>
+	static void run(const char* policy_name, int number_of_acquisitions) {
+		typedef mse::TAsyncSharedV2ReadWriteAccessRequester<mse::nii_vector<int>, _TSharedMutex> access_requester_t;
+		auto ar = access_requester_t::make(64, 0);
+
+		std::list<mse::mstd::future<mse::nii_vector<long long> > > reader_futures;
+		for (size_t i = 0; i < 3; i += 1) {
+			reader_futures.emplace_back(mse::mstd::async(timed_acquisitions<access_requester_t>, ar, false, number_of_acquisitions));
+		}
+		auto writer_future = mse::mstd::async(timed_acquisitions<access_requester_t>, ar, true, number_of_acquisitions);
+
+		std::vector<long long> read_latencies;
+		for (auto& future : reader_futures) {
+			auto latencies = future.get();
+			for (size_t i = 0; i < latencies.size(); i += 1) {
+				read_latencies.push_back(latencies[i]);
+			}
+		}
+		std::vector<long long> write_latencies;
+		{
+			auto latencies = writer_future.get();
+			for (size_t i = 0; i < latencies.size(); i += 1) {
+				write_latencies.push_back(latencies[i]);
+			}
+		}
+
+		std::cout << policy_name << ": \n";
+		print_percentiles("  read  ", read_latencies);
+		print_percentiles("  write ", write_latencies);
+	}
+
+	static void print_percentiles(const char* label, std::vector<long long>& latencies) {
+		std::sort(latencies.begin(), latencies.end());
+		auto percentile = [&latencies](double fraction) {
+			return latencies.empty() ? 0 : latencies[size_t(fraction * (latencies.size() - 1))];
+		};
+		std::cout << label << "p50: " << percentile(0.5) << " ns, p99: " << percentile(0.99) << " ns, p99.9: " << percentile(0.999) << " ns, max: " << percentile(1.0) << " ns";
+		std::cout << std::endl;
+	}
+};
+
+/* Used by the benchmark comparing the element access performance of the nii containers' check policies. */
+class CCheckPolicyBenchmark {
+public:
+	template<class _TVector>
+	static void run(const char* policy_name, int number_of_passes) {
+		/* (The element value is obtained via a volatile variable so that the compiler can't precompute the sum.) */
+		volatile int element_value = 1;
+		_TVector vec1(1000, int(element_value));
+		auto t1 = std::chrono::high_resolution_clock::now();
+		int sum = 0;
+		for (int j = 0; j < number_of_passes; j += 1) {
+			for (size_t i = 0; i < vec1.size(); i += 1) {
+				sum += vec1[i];
+			}
+			vec1[j % vec1.size()] = sum & 1;
+		}
+		auto t2 = std::chrono::high_resolution_clock::now();
+		auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+		std::cout << policy_name << ": " << time_span.count() << " seconds. (" << sum << ")";
+		std::cout << std::endl;
+	}
+};
+
+/* Used by the benchmark measuring the cost of a "sampled" bounds checking policy's per-access decision. The sampling
+decision is made the way such a policy would have to make it, with a per-thread countdown. */
+class CSampledBoundsCheckBenchmark {
+public:
+	template<unsigned int _TSamplePeriod>
+	static bool sample_this_access() {
+		thread_local unsigned int tl_countdown = 0;
+		if (0 == tl_countdown) {
+			tl_countdown = _TSamplePeriod - 1;
+			return true;
+		}
+		tl_countdown -= 1;
+		return false;
+	}
+	/* 0 == _TSamplePeriod indicates that no access is bounds checked. */
+	template<unsigned int _TSamplePeriod>
+	static void run(const char* label, int number_of_passes) {
+		/* (The element value is obtained via a volatile variable so that the compiler can't precompute the sum.) */
+		volatile int element_value = 1;
+		std::vector<int> vec1(1000, int(element_value));
+		auto t1 = std::chrono::high_resolution_clock::now();
+		int sum = 0;
+		for (int j = 0; j < number_of_passes; j += 1) {
+			for (size_t i = 0; i < vec1.size(); i += 1) {
+				if ((1 == _TSamplePeriod) || ((1 < _TSamplePeriod) && sample_this_access<_TSamplePeriod>())) {
+					sum += vec1.at(i);
+				}
+				else {
+					sum += vec1[i];
+				}
+			}
+			vec1[j % vec1.size()] = sum & 1;
+		}
+		auto t2 = std::chrono::high_resolution_clock::now();
+		auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+		std::cout << label << ": " << time_span.count() << " seconds. (" << sum << ")";
+		std::cout << std::endl;
+	}
+};
+
 int main(int argc, char* argv[]) {
 
 	mse::msevector_test msevector_test;
@@ -740,6 +881,25 @@ int main(int argc, char* argv[]) {
 #endif // !MSE_REGISTEREDPOINTER_DISABLED
 		}
 
+		{
+			/* When you need lots of (heap allocated) registered objects at once, mse::registered_new_n() allocates and
+			registers them in one call, and mse::registered_delete_n() deallocates them in one call. */
+			auto A_registered_ptrs = mse::registered_new_n<A>(1000);
+			assert(1000 == A_registered_ptrs.size());
+			assert(3 == A_registered_ptrs[500]->b);
+
+			/* Objects from a batch can also be individually deallocated. */
+			auto A_registered_ptr4 = A_registered_ptrs[123];
+			mse::registered_delete<A>(A_registered_ptr4);
+			A_registered_ptrs.erase(A_registered_ptrs.begin() + 123);
+
+			mse::registered_delete_n<A>(A_registered_ptrs);
+#ifndef MSE_REGISTEREDPOINTER_DISABLED
+			assert(!A_registered_ptrs.front());
+			assert(!A_registered_ptrs.back());
+#endif // !MSE_REGISTEREDPOINTER_DISABLED
+		}
+
 		{
 			/* Remember that registered pointers can only point to registered objects. So, for example, if you want
 			a registered pointer to an object's base class object, that base class object has to be a registered
@@ -880,9 +1040,174 @@ int main(int argc, char* argv[]) {
 			mse::TNoradFixedPointer<D> D_norad_fptr1 = &norad_fd;
 			mse::TNoradFixedConstPointer<D> D_norad_fcptr1 = &norad_fd;
 		}
+		{
+			/* The "compact" norad types use a smaller refcounter and don't add a virtual destructor (and so a vtable
+			pointer) to the target type, which can significantly reduce the memory overhead for large arrays of small
+			objects. */
+			class CPoint {
+			public:
+				short m_x = 0;
+				short m_y = 0;
+				char m_tag = 'p';
+			};
+			mse::TCompactNoradObj<CPoint> compact_norad_point;
+			mse::TCompactNoradPointer<CPoint> compact_norad_point_ptr1 = &compact_norad_point;
+			mse::TCompactNoradFixedConstPointer<CPoint> compact_norad_point_fcptr1 = &compact_norad_point;
+			compact_norad_point_ptr1->m_x = 3;
+			assert(3 == compact_norad_point_fcptr1->m_x);
+			assert(sizeof(mse::TCompactNoradObj<CPoint>) <= sizeof(mse::TNoradObj<CPoint>));
+#ifndef MSE_NORADPOINTER_DISABLED
+			/* The smaller refcounter is overflow checked. An attempt to exceed the maximum number of references to the
+			same object results in an exception (rather than a wrapped count). */
+			{
+				mse::TCompactNoradObj<CPoint> compact_norad_point2;
+				std::vector<mse::TCompactNoradPointer<CPoint> > compact_norad_ptrs;
+				const auto max_refs = (std::numeric_limits<mse::compact_norad_refcounter_t>::max)();
+				compact_norad_ptrs.reserve(max_refs);
+				for (size_t i = 0; max_refs > i; i += 1) {
+					compact_norad_ptrs.push_back(&compact_norad_point2);
+				}
+				bool overflow_detected = false;
+				try {
+					mse::TCompactNoradPointer<CPoint> one_too_many_ptr = &compact_norad_point2;
+				}
+				catch (const std::overflow_error&) {
+					overflow_detected = true;
+				}
+				assert(overflow_detected);
+				/* The failed attempt left the count intact. */
+				compact_norad_ptrs.pop_back();
+				mse::TCompactNoradPointer<CPoint> one_more_ptr = &compact_norad_point2;
+				one_more_ptr = nullptr;
+				compact_norad_ptrs.clear();
+			}
+#endif // !MSE_NORADPOINTER_DISABLED
+		}
 	}
 	mse::self_test::CNoradPtrTest1::s_test1();
 
+	{
+		/******************************************/
+		/*   slot_map and TGenerationalPointer    */
+		/******************************************/
+
+		/* The elements of an mse::slot_map<> are referenced by "generational" pointers, which contain the index of the
+		element's "slot" and the slot's "generation" at the time the pointer was obtained. Copying a generational pointer
+		doesn't involve modifying the target object, and dereferencing it involves just one generation comparison.
+		Attempting to dereference a pointer to an element that has been removed results in an exception. */
+
+		class CEntity {
+		public:
+			CEntity(int x, int y) : m_x(x), m_y(y) {}
+			int m_x = 0;
+			int m_y = 0;
+		};
+
+		mse::slot_map<CEntity> entities;
+		mse::TGenerationalPointer<CEntity> entity1_ptr = entities.emplace(1, 2);
+		auto entity2_ptr = entities.emplace(3, 4);
+		auto entity3_ptr = entities.insert(CEntity(5, 6));
+		assert(3 == entities.size());
+
+		entity1_ptr->m_x += 10;
+		mse::TGenerationalConstPointer<CEntity> entity1_cptr = entity1_ptr;
+		assert(11 == entity1_cptr->m_x);
+
+		/* The elements are stored contiguously, so iterating over them is fast. */
+		int sum_of_x = 0;
+		entities.for_each([&sum_of_x](CEntity& entity) { sum_of_x += entity.m_x; });
+		assert(11 + 3 + 5 == sum_of_x);
+
+		bool erase_succeeded = entities.erase(entity2_ptr);
+		assert(erase_succeeded);
+		assert(!entities.contains(entity2_ptr));
+		assert(5 == entity3_ptr->m_x);
+
+		/* The slot of the removed element will be reused, but with a new generation. */
+		auto entity4_ptr = entities.emplace(7, 8);
+		assert(7 == entity4_ptr->m_x);
+
+#ifndef MSE_GENERATIONALPOINTER_DISABLED
+		try {
+			/* The element has been removed, so this would be an invalid memory access. */
+			auto x = entity2_ptr->m_x;
+			assert(false);
+		}
+		catch (...) {
+			std::cout << "expected exception" << std::endl;
+		}
+#endif // !MSE_GENERATIONALPOINTER_DISABLED
+
+		try {
+			/* Insertions and removals are not permitted during iteration. */
+			entities.for_each([&entities, entity3_ptr](CEntity&) { entities.erase(entity3_ptr); });
+			assert(false);
+		}
+		catch (...) {
+			std::cout << "expected exception" << std::endl;
+		}
+		try {
+			/* Nor is anything that could reallocate the element storage. */
+			entities.for_each([&entities](CEntity&) { entities.reserve(1000); });
+			assert(false);
+		}
+		catch (...) {
+			std::cout << "expected exception" << std::endl;
+		}
+		try {
+			/* Nor while an element is being accessed through a generational pointer. (Here the lambda stands in for a
+			member function of the element that (indirectly) removes an element.) */
+			auto erase_entity3 = [&entities, entity3_ptr](CEntity&) { entities.erase(entity3_ptr); };
+			erase_entity3(*entity1_ptr);
+			assert(false);
+		}
+		catch (...) {
+			std::cout << "expected exception" << std::endl;
+		}
+		assert(entities.contains(entity3_ptr));
+		assert(entity1_ptr && (11 == entity1_ptr->m_x));
+		/* The structure lock is released at the end of the full expression. */
+		entity1_ptr->m_y = 12;
+		auto entity6_ptr = entities.emplace(11, 12);
+		assert(entities.erase(entity6_ptr));
+
+		{
+			/* Moving a slot_map transfers its element storage without moving the elements, so existing pointers remain
+			valid. Since the move constructor is noexcept, a vector of slot_maps moves (rather than copies) them when it
+			grows. */
+			std::vector<mse::slot_map<CEntity> > slot_maps;
+			slot_maps.emplace_back();
+			auto entity7_ptr = slot_maps.front().emplace(13, 14);
+			for (size_t i = 0; 100 > i; i += 1) {
+				slot_maps.emplace_back();
+			}
+			assert(13 == entity7_ptr->m_x);
+			assert(slot_maps.front().contains(entity7_ptr));
+
+			mse::slot_map<CEntity> entities3(std::move(slot_maps.front()));
+			assert(entities3.contains(entity7_ptr));
+			assert(13 == entity7_ptr->m_x);
+		}
+
+		{
+			mse::TGenerationalPointer<CEntity> entity5_ptr;
+			{
+				mse::slot_map<CEntity> entities2;
+				entity5_ptr = entities2.emplace(9, 10);
+			}
+#ifndef MSE_GENERATIONALPOINTER_DISABLED
+			try {
+				/* The slot_map has been destroyed. */
+				auto x = entity5_ptr->m_x;
+				assert(false);
+			}
+			catch (...) {
+				std::cout << "expected exception" << std::endl;
+			}
+#endif // !MSE_GENERATIONALPOINTER_DISABLED
+		}
+	}
+
 #if defined(MSEREGISTEREDREFWRAPPER) && !defined(MSE_PRIMITIVES_DISABLED)
 	{
 		/*****************************/
@@ -1171,6 +1496,29 @@ int main(int argc, char* argv[]) {
 		int res4 = B::foo2(xscp_a_ownerptr);
 		int res4b = B::foo2(&(*xscp_a_ownerptr));
 
+		{
+			/* mse::TXScopeOwnerInline<> is like mse::TXScopeOwnerPointer<>, but stores its object within itself (i.e.
+			on the stack) rather than on the heap. */
+			mse::TXScopeOwnerInline<A> xscp_a_ownerinline(9);
+			int res4c = B::foo2(xscp_a_ownerinline);
+			assert(9 == res4c);
+			auto xscp_a_ownerinline2 = mse::make_xscope_owner_inline<A>(10);
+			assert(10 == B::foo3(xscp_a_ownerinline2));
+
+			/* The owned object can be of a type derived from the declared one, as long as it fits within the
+			(optionally) specified capacity. */
+			class D : public A {
+			public:
+				D(int x, int y) : A(x), m_y(y) {}
+				int m_y = 0;
+			};
+			mse::TXScopeOwnerInline<A, 128> xscp_a_ownerinline3 = mse::TXScopeOwnerInline<A, 128>::make_derived<D>(11, 12);
+			assert(11 == B::foo2(xscp_a_ownerinline3));
+			assert(12 == dynamic_cast<D&>(*xscp_a_ownerinline3).m_y);
+			mse::TXScopeItemFixedConstPointer<A> xscp_a_cptr1 = xscp_a_ownerinline3;
+			assert(11 == xscp_a_cptr1->b);
+		}
+
 		/* You can also use the make_xscope() function to obtain a scope object from a given value. */
 		auto a2_scpobj = mse::make_xscope(A(7));
 
@@ -1513,6 +1861,31 @@ int main(int argc, char* argv[]) {
 				}
 				std::cout << std::endl;
 			}
+			{
+				int count = 0;
+				mse::slot_map<CE> slot_map1;
+				slot_map1.reserve(2);
+				mse::TGenerationalPointer<CE> object1_ptr = slot_map1.emplace(count);
+				mse::TGenerationalPointer<CE> object2_ptr = slot_map1.emplace(count);
+				mse::TGenerationalPointer<CE> item_ptr2 = object1_ptr;
+				auto t1 = std::chrono::high_resolution_clock::now();
+				{
+					for (int i = 0; i < number_of_loops; i += 1) {
+						mse::TGenerationalPointer<CE> item_ptr = (0 == (i % 2)) ? object1_ptr : object2_ptr;
+						item_ptr2 = item_ptr;
+						item_ptr->increment();
+						item_ptr2->decrement();
+					}
+				}
+
+				auto t2 = std::chrono::high_resolution_clock::now();
+				auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+				std::cout << "mse::TGenerationalPointer: " << time_span.count() << " seconds.";
+				if (0 != count) {
+					std::cout << " destructions pending: " << count << "."; /* Using the count variable for (potential) output should prevent the optimizer from discarding it. */
+				}
+				std::cout << std::endl;
+			}
 			{
 				int count = 0;
 				mse::TRefCountingPointer<CE> object1_ptr = mse::make_refcounting<CE>(count);
@@ -2019,8 +2392,365 @@ int main(int argc, char* argv[]) {
 				}
 				std::cout << std::endl;
 			}
+			{
+				/* mse::TPolyPointer<> dispatches to the held pointer's dereference operator via a table indexed by the held
+				pointer type's (integer) id, except when the held pointer's target can't change (as with refcounting
+				pointers), in which case the target address is cached. */
+				class CF {
+				public:
+					CF(int a = 0) : m_a(a) {}
+					mse::TPolyPointer<CF> m_next_item_ptr = static_cast<CF*>(nullptr);
+					int m_a = 3;
+				};
+				auto item1_ptr = mse::make_refcounting<CF>(1);
+				auto item2_ptr = mse::make_refcounting<CF>(2);
+				auto item3_ptr = mse::make_refcounting<CF>(3);
+				item1_ptr->m_next_item_ptr = item2_ptr;
+				item2_ptr->m_next_item_ptr = item3_ptr;
+				item3_ptr->m_next_item_ptr = item1_ptr;
+				auto t1 = std::chrono::high_resolution_clock::now();
+				mse::TPolyPointer<CF>* pp_ptr = std::addressof(item1_ptr->m_next_item_ptr);
+				for (int i = 0; i < number_of_loops2; i += 1) {
+					pp_ptr = std::addressof((*pp_ptr)->m_next_item_ptr);
+				}
+				auto t2 = std::chrono::high_resolution_clock::now();
+				auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+				std::cout << "mse::TPolyPointer (holding mse::TRefCountingPointer, cached target) dereferencing: " << time_span.count() << " seconds.";
+				if (3 == (*pp_ptr)->m_a) {
+					std::cout << " "; /* Using (*pp_ptr)->m_a for (potential) output should prevent the optimizer from discarding too much. */
+				}
+				std::cout << std::endl;
+
+				/* Breaking the reference cycle. */
+				item1_ptr->m_next_item_ptr = static_cast<CF*>(nullptr);
+				item2_ptr->m_next_item_ptr = static_cast<CF*>(nullptr);
+				item3_ptr->m_next_item_ptr = static_cast<CF*>(nullptr);
+			}
+			{
+				class CF {
+				public:
+					CF(int a = 0) : m_a(a) {}
+					mse::TPolyPointer<CF> m_next_item_ptr = static_cast<CF*>(nullptr);
+					int m_a = 3;
+				};
+				mse::mstd::vector<CF> items{ CF(1), CF(2), CF(3) };
+				items[0].m_next_item_ptr = items.begin() + 1;
+				items[1].m_next_item_ptr = items.begin() + 2;
+				items[2].m_next_item_ptr = items.begin();
+				auto t1 = std::chrono::high_resolution_clock::now();
+				mse::TPolyPointer<CF>* pp_ptr = std::addressof(items[0].m_next_item_ptr);
+				for (int i = 0; i < number_of_loops2; i += 1) {
+					pp_ptr = std::addressof((*pp_ptr)->m_next_item_ptr);
+				}
+				auto t2 = std::chrono::high_resolution_clock::now();
+				auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+				std::cout << "mse::TPolyPointer (holding mse::mstd::vector<> iterator, dispatched) dereferencing: " << time_span.count() << " seconds.";
+				if (3 == (*pp_ptr)->m_a) {
+					std::cout << " "; /* Using (*pp_ptr)->m_a for (potential) output should prevent the optimizer from discarding too much. */
+				}
+				std::cout << std::endl;
+
+				/* mse::mstd::vector<> iterators hold (shared) ownership of their container, so we break the reference cycle. */
+				for (auto& item_ref : items) {
+					item_ref.m_next_item_ptr = static_cast<CF*>(nullptr);
+				}
+			}
+			std::cout << std::endl;
+		}
+
+		{
+			/* Some classic C buffer growing loops, ported using the "legacy helper" macros (which are used to convert C
+			code to (safe) SaferCPlusPlus code). */
+			std::cout << "buffer growth via realloc(): \n";
+			static const int number_of_appends = (number_of_loops < 100000) ? number_of_loops : 100000;
+			static const size_t chunk_size = 256;
+			{
+				auto t1 = std::chrono::high_resolution_clock::now();
+				int* buf = nullptr;
+				size_t len = 0;
+				for (int i = 0; i < number_of_appends; i += 1) {
+					/* Growing the buffer by one element at a time. */
+					buf = (int*)realloc(buf, (len + 1) * sizeof(int));
+					buf[len] = i;
+					len += 1;
+				}
+				auto t2 = std::chrono::high_resolution_clock::now();
+				auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+				std::cout << "native realloc() one element at a time: " << time_span.count() << " seconds.";
+				if ((0 < len) && (0 > buf[len - 1])) {
+					std::cout << " "; /* Using the buffer for (potential) output should prevent the optimizer from discarding it. */
+				}
+				std::cout << std::endl;
+				free(buf);
+			}
+			{
+				auto t1 = std::chrono::high_resolution_clock::now();
+				MSE_LH_DYNAMIC_ARRAY_ITERATOR_TYPE(int) buf = nullptr;
+				size_t len = 0;
+				for (int i = 0; i < number_of_appends; i += 1) {
+					MSE_LH_REALLOC(int, buf, (len + 1) * sizeof(int));
+					buf[len] = i;
+					len += 1;
+				}
+				auto t2 = std::chrono::high_resolution_clock::now();
+				auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+				std::cout << "MSE_LH_REALLOC() one element at a time: " << time_span.count() << " seconds.";
+				if ((0 < len) && (0 > buf[len - 1])) {
+					std::cout << " ";
+				}
+				std::cout << std::endl;
+				MSE_LH_FREE(buf);
+			}
+			{
+				int src_chunk[chunk_size];
+				for (size_t i = 0; i < chunk_size; i += 1) {
+					src_chunk[i] = int(i);
+				}
+				auto t1 = std::chrono::high_resolution_clock::now();
+				int* buf = nullptr;
+				size_t len = 0;
+				for (int i = 0; i < number_of_appends; i += int(chunk_size)) {
+					/* Growing the buffer a chunk at a time (as when reading a stream of unknown length). */
+					buf = (int*)realloc(buf, (len + chunk_size) * sizeof(int));
+					memcpy(buf + len, src_chunk, chunk_size * sizeof(int));
+					len += chunk_size;
+				}
+				auto t2 = std::chrono::high_resolution_clock::now();
+				auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+				std::cout << "native realloc() a chunk at a time: " << time_span.count() << " seconds.";
+				if ((0 < len) && (0 > buf[len - 1])) {
+					std::cout << " ";
+				}
+				std::cout << std::endl;
+				free(buf);
+			}
+			{
+				MSE_LH_FIXED_ARRAY_DECLARATION(int, chunk_size, src_chunk);
+				for (size_t i = 0; i < chunk_size; i += 1) {
+					src_chunk[i] = int(i);
+				}
+				auto t1 = std::chrono::high_resolution_clock::now();
+				MSE_LH_DYNAMIC_ARRAY_ITERATOR_TYPE(int) buf = nullptr;
+				size_t len = 0;
+				for (int i = 0; i < number_of_appends; i += int(chunk_size)) {
+					MSE_LH_REALLOC(int, buf, (len + chunk_size) * sizeof(int));
+					MSE_LH_MEMCPY(buf + len, src_chunk, chunk_size * sizeof(int));
+					len += chunk_size;
+				}
+				auto t2 = std::chrono::high_resolution_clock::now();
+				auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+				std::cout << "MSE_LH_REALLOC() a chunk at a time: " << time_span.count() << " seconds.";
+				if ((0 < len) && (0 > buf[len - 1])) {
+					std::cout << " ";
+				}
+				std::cout << std::endl;
+				MSE_LH_FREE(buf);
+			}
 			std::cout << std::endl;
 		}
+
+		{
+			/* Threads coordinating through an atomic object vs. through an (access controlled) object and access requester. */
+			std::cout << "shared counter increments (two threads): \n";
+			static const int number_of_increments = (number_of_loops < 1000000) ? number_of_loops : 1000000;
+			typedef mse::TXScopeObj<mse::TXScopeAccessControlledObj<mse::CInt> > xs_counter_acobj_t;
+			typedef decltype(mse::make_xscope_asyncsharedv2acoreadwrite(&std::declval<xs_counter_acobj_t&>())) xs_access_requester_t;
+			class CB {
+			public:
+				static void atomic_increments(mse::TXScopeAtomicFixedPointer<int> xs_counter_ptr) {
+					for (int i = 0; i < number_of_increments; i += 1) {
+						(*xs_counter_ptr).fetch_add(1, std::memory_order_relaxed);
+					}
+				}
+				static void atomic_update_increments(mse::TXScopeAtomicFixedPointer<int> xs_counter_ptr) {
+					for (int i = 0; i < number_of_increments; i += 1) {
+						mse::xscope_atomic_fetch_update(xs_counter_ptr, [](int x) { return x + 1; }, std::memory_order_relaxed);
+					}
+				}
+				static void access_requester_increments(xs_access_requester_t xs_access_requester) {
+					for (int i = 0; i < number_of_increments; i += 1) {
+						*(xs_access_requester.writelock_ptr()) += 1;
+					}
+				}
+			};
+			{
+				mse::TXScopeAtomicObj<int> xs_counter(0);
+				auto t1 = std::chrono::high_resolution_clock::now();
+				{
+					mse::xscope_thread xscp_thread1(CB::atomic_increments, &xs_counter);
+					mse::xscope_thread xscp_thread2(CB::atomic_increments, &xs_counter);
+				}
+				auto t2 = std::chrono::high_resolution_clock::now();
+				auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+				std::cout << "mse::TXScopeAtomicObj<> fetch_add(): " << time_span.count() << " seconds.";
+				assert(2 * number_of_increments == xs_counter.load());
+				std::cout << std::endl;
+			}
+			{
+				mse::TXScopeAtomicObj<int> xs_counter(0);
+				auto t1 = std::chrono::high_resolution_clock::now();
+				{
+					mse::xscope_thread xscp_thread1(CB::atomic_update_increments, &xs_counter);
+					mse::xscope_thread xscp_thread2(CB::atomic_update_increments, &xs_counter);
+				}
+				auto t2 = std::chrono::high_resolution_clock::now();
+				auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+				std::cout << "mse::xscope_atomic_fetch_update(): " << time_span.count() << " seconds.";
+				assert(2 * number_of_increments == xs_counter.load());
+				std::cout << std::endl;
+			}
+			{
+				xs_counter_acobj_t xs_counter_acobj(0);
+				auto t1 = std::chrono::high_resolution_clock::now();
+				{
+					auto xs_access_requester = mse::make_xscope_asyncsharedv2acoreadwrite(&xs_counter_acobj);
+					mse::xscope_thread xscp_thread1(CB::access_requester_increments, xs_access_requester);
+					mse::xscope_thread xscp_thread2(CB::access_requester_increments, xs_access_requester);
+				}
+				auto t2 = std::chrono::high_resolution_clock::now();
+				auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+				std::cout << "access requester writelock_ptr(): " << time_span.count() << " seconds.";
+				std::cout << std::endl;
+			}
+			std::cout << std::endl;
+		}
+
+		{
+			/* Lock acquisition latencies of the access requesters' shared mutex policies under a mixed read/write load. */
+			std::cout << "access requester lock acquisition latencies (three readers, one writer): \n";
+			static const int number_of_acquisitions = (number_of_loops < 1000000) ? 1000 : 20000;
+			CLockPolicyBenchmark::run<std::shared_timed_mutex>("std::shared_timed_mutex (default)", number_of_acquisitions);
+			CLockPolicyBenchmark::run<mse::reader_preferring_shared_timed_mutex>("mse::reader_preferring_shared_timed_mutex", number_of_acquisitions);
+			CLockPolicyBenchmark::run<mse::writer_preferring_shared_timed_mutex>("mse::writer_preferring_shared_timed_mutex", number_of_acquisitions);
+			CLockPolicyBenchmark::run<mse::fifo_shared_timed_mutex>("mse::fifo_shared_timed_mutex", number_of_acquisitions);
+			std::cout << std::endl;
+		}
+
+		{
+			/* A "sampled" check policy (one that bounds checks only one in every N element accesses) was considered for
+			the nii containers. But the per-access sampling decision costs more than the (relatively cheap) bounds check
+			it would skip, so such a policy wouldn't be faster than just checking every access. */
+			std::cout << "sampled versus full bounds checking of element accesses: \n";
+			static const int number_of_passes = (number_of_loops < 1000000) ? 10 : 100000;
+			CSampledBoundsCheckBenchmark::run<1>("every access checked", number_of_passes);
+			CSampledBoundsCheckBenchmark::run<16>("one in 16 accesses checked (per-thread countdown)", number_of_passes);
+			CSampledBoundsCheckBenchmark::run<0>("no access checked", number_of_passes);
+			std::cout << std::endl;
+		}
+
+		{
+			/* Element access (via operator[]) performance of nii_vector<>s with different check policies. */
+			std::cout << "nii_vector<> element access by check policy: \n";
+			static const int number_of_passes = (number_of_loops < 1000000) ? 10 : 100000;
+			CCheckPolicyBenchmark::run<mse::nii_vector_cp<int, mse::check_policy::full> >("mse::check_policy::full", number_of_passes);
+			CCheckPolicyBenchmark::run<mse::nii_vector_cp<int, mse::check_policy::bounds_only> >("mse::check_policy::bounds_only", number_of_passes);
+			CCheckPolicyBenchmark::run<mse::nii_vector_cp<int, mse::us::check_policy::none_but_structural> >("mse::us::check_policy::none_but_structural", number_of_passes);
+			CCheckPolicyBenchmark::run<std::vector<int> >("std::vector", number_of_passes);
+			std::cout << std::endl;
+		}
+	}
+
+	{
+		/*********************/
+		/*   mse::stats      */
+		/*********************/
+
+		/* When the MSE_ENABLE_STATS preprocessor symbol is defined, the library counts the occurrences of certain
+		events associated with its run-time safety mechanisms. (Otherwise the counts are just zero.) */
+
+		auto stats1 = mse::stats::snapshot();
+
+		mse::mstd::vector<int> vec1 = { 1, 2, 3 };
+		int sum = 0;
+		for (size_t i = 0; i < vec1.size(); i += 1) {
+			sum += vec1[i];
+		}
+		mse::TRegisteredObj<int> reg_int1 = 5;
+		{
+			auto reg_ptr1 = &reg_int1;
+			auto reg_ptr2 = reg_ptr1;
+			sum += *reg_ptr2;
+		}
+
+		auto stats_diff = mse::stats::snapshot() - stats1;
+#ifdef MSE_ENABLE_STATS
+		assert(3 <= stats_diff[mse::stats::event_t::bounds_check]);
+		assert(2 <= stats_diff[mse::stats::event_t::registered_link]);
+		assert(stats_diff[mse::stats::event_t::registered_link] == stats_diff[mse::stats::event_t::registered_unlink]);
+		stats_diff.dump(std::cout);
+		std::cout << std::endl;
+#else // MSE_ENABLE_STATS
+		assert(0 == stats_diff[mse::stats::event_t::bounds_check]);
+#endif // MSE_ENABLE_STATS
+	}
+
+	{
+		/*********************/
+		/*   check policies  */
+		/*********************/
+
+		/* The checks performed by nii_array<>, nii_vector<> and nii_basic_string<> (and their iterators) can be
+		selected per container type via a "check policy". Containers that differ only in their check policy are
+		convertible to each other, implicitly by move, but only explicitly by copy. */
+
+		typedef mse::nii_vector_cp<int, mse::check_policy::bounds_only> bounds_only_vector_t;
+
+		mse::nii_vector<int> vec1 = { 1, 2, 3 };
+
+		/* Moving the contents into a vector with a lighter check policy for use in a hot loop. */
+		bounds_only_vector_t vec2 = std::move(vec1);
+		int sum = 0;
+		for (size_t i = 0; i < vec2.size(); i += 1) {
+			sum += vec2[i];
+		}
+		/* And moving them back. */
+		vec1 = std::move(vec2);
+		assert(3 == vec1.size());
+
+		mse::nii_array_cp<int, 3, mse::us::check_policy::debug_only> array1 = { 1, 2, 3 };
+		mse::nii_array<int, 3> array2(array1);
+		static_assert(!std::is_convertible<const mse::nii_array_cp<int, 3, mse::us::check_policy::debug_only>&, mse::nii_array<int, 3> >::value
+			, "copies (of containers with a different check policy) should be explicit");
+
+		mse::nii_string_cp<mse::us::check_policy::none_but_structural> string1 = "some text";
+		mse::nii_string string2(string1);
+		string2 = mse::nii_string(string1);
+
+		/* With the bounds_only policy, iterator arithmetic isn't validated, but dereferencing still is. */
+		mse::TXScopeObj<bounds_only_vector_t> xs_vec3(vec1);
+		auto xs_iter1 = mse::make_xscope_begin_iterator(&xs_vec3);
+		xs_iter1 += 5;
+		try {
+			sum += *xs_iter1;
+			assert(false);
+		}
+		catch (...) {
+			// expected exception
+		}
+		/* As are element accesses via operator[]. */
+		try {
+			sum += xs_vec3[3];
+			assert(false);
+		}
+		catch (...) {
+			// expected exception
+		}
+		mse::nii_array_cp<int, 3, mse::check_policy::bounds_only> array3 = { 1, 2, 3 };
+		try {
+			sum += array3[3];
+			assert(false);
+		}
+		catch (...) {
+			// expected exception
+		}
+		mse::nii_string_cp<mse::check_policy::bounds_only> string3 = "abc";
+		try {
+			sum += string3[3];
+			assert(false);
+		}
+		catch (...) {
+			// expected exception
+		}
 	}
 
 	msetl_example2();
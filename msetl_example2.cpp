@@ -13,6 +13,7 @@
 #include "mseregistered.h"
 #include "msecregistered.h"
 #include "msenorad.h"
+#include "msehazard.h"
 #include "mserefcounting.h"
 #include "msescope.h"
 #include "mseasyncshared.h"
@@ -138,6 +139,25 @@ public:
 		return mse::return_value(mse::pointer_to(l_obj));
 	}
 
+	/* This function views the given "random access section" as a two-dimensional (row-major) array with the given
+	number of columns, and sets each element to the sum of its row and column indices. */
+	template<class _TRASection>
+	static void foo18(_TRASection ra_section, size_t num_columns) {
+		auto xscope_md_section = mse::make_xscope_multi_dim_section(ra_section, std::array<size_t, 2>{ { ra_section.size() / num_columns, num_columns } });
+		for (size_t row = 0; xscope_md_section.extent(0) > row; row += 1) {
+			auto xscope_row = xscope_md_section.xscope_row(row);
+			size_t column = 0;
+			for (auto& element_ref : xscope_row) {
+				element_ref = int(row + column);
+				column += 1;
+			}
+		}
+		if (1 <= xscope_md_section.extent(0)) {
+			/* Iterators of a (temporary) row view remain valid after the view is gone. */
+			auto first_row_iter = xscope_md_section.xscope_row(0).begin();
+			assert(0 == *first_row_iter);
+		}
+	}
 	template<class _TRASection>
 	static void foo13(_TRASection ra_section) {
 		for (typename _TRASection::size_type i = 0; i < ra_section.size(); i += 1) {
@@ -198,6 +218,10 @@ public:
 		dst_ptr->s = src_ptr->s;
 		std::this_thread::sleep_for(std::chrono::milliseconds(10));
 	}
+	template<class _TAccessRequester>
+	static int foo19(_TAccessRequester access_requester) {
+		return *(access_requester.readlock_ptr());
+	}
 
 	/* This function will be used to demonstrate using rsv::as_an_fparam() to enable template functions to accept scope
 	random access sections that reference temporary objects. */
@@ -217,6 +241,7 @@ public:
 
 MSE_DECLARE_THREAD_LOCAL_GLOBAL(mse::mstd::string) tlg_string1 = "some text";
 MSE_RSV_DECLARE_GLOBAL_IMMUTABLE(mse::nii_string) gimm_string1 = "some text";
+MSE_RSV_DECLARE_GLOBAL_IMMUTABLE_LAZY(mse::nii_string) glazyimm_string1("some lazily constructed text");
 
 
 void msetl_example2() {
@@ -1158,6 +1183,22 @@ void msetl_example2() {
 		auto xs_cptr3 = xs_tl_store3.xscope_ptr();
 		*xs_cptr3 += "def";
 		std::cout << *xs_cptr3 << std::endl;
+
+		{
+			/* In code that accesses the same thread_local object many times, you can use a "handle" to resolve the
+			object's address just once, and obtain scope pointers to it that don't touch any reference counts. */
+			MSE_DECLARE_THREAD_LOCAL(mse::TInt<size_t>) tl_counter = 0;
+			auto xs_tl_counter_handle = mse::rsv::make_xscope_thread_local_handle(tl_counter);
+			auto xs_counter_ptr = xs_tl_counter_handle.xscope_ptr();
+			for (size_t i = 0; i < 100; i += 1) {
+				*xs_counter_ptr += 1;
+			}
+			assert(100 == *xs_tl_counter_handle);
+
+			auto xs_tlc_handle2 = mse::rsv::make_xscope_thread_local_handle(tlc_string2);
+			mse::TXScopeItemFixedConstPointer<mse::mstd::string> xs_cptr4 = xs_tlc_handle2.xscope_ptr();
+			assert(3 == xs_tlc_handle2->size());
+		}
 	}
 
 	{
@@ -1191,6 +1232,56 @@ void msetl_example2() {
 		std::cout << *xs_cptr3 << std::endl;
 	}
 
+	{
+		/***********************************************/
+		/*  MSE_DECLARE_STATIC_IMMUTABLE_LAZY()        */
+		/*  & MSE_RSV_DECLARE_GLOBAL_IMMUTABLE_LAZY()  */
+		/***********************************************/
+
+		/* The target object of a "lazy" static immutable is constructed (in a thread-safe way) on first access, and
+		is never destroyed. So unlike the pointers of (run-time checked) static immutables, obtaining and copying
+		pointers to it does not modify any reference count shared between threads (in any build mode). This can make them a better fit
+		for, for example, lookup tables that are accessed from many threads. */
+		class CB {
+		public:
+			static size_t foo1(mse::rsv::TStaticImmutableLazyFixedConstPointer<mse::nii_string> lazyimm_ptr) {
+				size_t sum = 0;
+				for (size_t i = 0; i < 10; i += 1) {
+					auto lazyimm_ptr2 = lazyimm_ptr;
+					sum += lazyimm_ptr2->size();
+				}
+				return sum;
+			}
+		};
+
+		assert(!glazyimm_string1.is_initialized());
+		auto glazyimm_ptr1 = &glazyimm_string1;
+		assert(glazyimm_string1.is_initialized());
+		auto xs_glazyimm_store1 = mse::make_xscope_strong_pointer_store(glazyimm_ptr1);
+		auto xs_ptr1 = xs_glazyimm_store1.xscope_ptr();
+		std::cout << *xs_ptr1 << std::endl;
+
+		MSE_DECLARE_STATIC_IMMUTABLE_LAZY(mse::nii_string) slazyimm_string2("abc");
+		std::list<mse::mstd::future<size_t>> futures;
+		for (size_t i = 0; i < 3; i += 1) {
+			futures.emplace_back(mse::mstd::async(CB::foo1, &slazyimm_string2));
+		}
+		for (auto it = futures.begin(); futures.end() != it; it++) {
+			auto res1 = (*it).get();
+			assert(30 == res1);
+		}
+		assert(3 == slazyimm_string2->size());
+
+		/* The constructor arguments may be of move-only types. */
+		class CTable {
+		public:
+			CTable(std::unique_ptr<int> size_ptr) : m_size(*size_ptr) {}
+			int m_size = 0;
+		};
+		MSE_DECLARE_STATIC_IMMUTABLE_LAZY(mse::rsv::TAsyncShareableAndPassableObj<CTable>) slazyimm_table3(std::unique_ptr<int>(new int(7)));
+		assert(7 == slazyimm_table3->m_size);
+	}
+
 	{
 		/**********************/
 		/*   stnii_vector<>   */
@@ -1322,9 +1413,121 @@ void msetl_example2() {
 			MSE_LH_FIXED_ARRAY_DECLARATION(arr_element_type, 3/*elements*/, array1) = { 1, 2, 3 };
 			MSE_LH_FIXED_ARRAY_DECLARATION(arr_element_type, 3/*elements*/, array2) = { 4, 5, 6 };
 
-			MSE_LH_MEMSET(array1, 99, 3/*elements*/ * sizeof(arr_element_type));
+			/* (As with MSE_LH_MEMSET() elsewhere, a value of -1 gives the same result whether elements or bytes are set.) */
+			MSE_LH_MEMSET(array1, -1, 3/*elements*/ * sizeof(arr_element_type));
+			/* When the targets are in contiguous storage, MSE_LH_MEMSET() and MSE_LH_MEMCPY() check the bounds once and
+			then operate in bulk. */
 			MSE_LH_MEMCPY(array2, array1, 3/*elements*/ * sizeof(arr_element_type));
 			auto res18 = array2[1];
+			assert(-1 == res18);
+		}
+
+#ifndef MSE_LEGACYHELPERS_DISABLED
+		{
+			/* The bulk operations are used when the (type-erased) iterator reports the contiguous storage (and the
+			remaining extent) of its target. Both fixed arrays and dynamic arrays do. */
+			MSE_LH_FIXED_ARRAY_DECLARATION(int, 3/*elements*/, array1) = { 1, 2, 3 };
+			const mse::TNullableAnyRandomAccessIterator<int> array1_iter = array1;
+			const auto array1_span = contiguous_storage_span(array1_iter);
+			assert((std::addressof(array1[0]) == array1_span.first) && (3 == array1_span.second));
+
+			MSE_LH_DYNAMIC_ARRAY_ITERATOR_TYPE(int) dyn_arr4;
+			MSE_LH_ALLOC(int, dyn_arr4, 8 * sizeof(int));
+			for (int i = 0; 8 > i; i += 1) {
+				dyn_arr4[i] = i;
+			}
+			{
+				const mse::TNullableAnyRandomAccessIterator<int> dyn_arr4_iter = dyn_arr4 + 2;
+				const auto dyn_arr4_span = contiguous_storage_span(dyn_arr4_iter);
+				assert((std::addressof(dyn_arr4[2]) == dyn_arr4_span.first) && (6 == dyn_arr4_span.second));
+			}
+
+			/* Overlapping source and destination ranges in the same array are handled (as with memmove()), in either
+			direction. */
+			MSE_LH_MEMCPY(dyn_arr4 + 2, dyn_arr4, 4 * sizeof(int));
+			assert((0 == dyn_arr4[2]) && (1 == dyn_arr4[3]) && (2 == dyn_arr4[4]) && (3 == dyn_arr4[5]) && (6 == dyn_arr4[6]));
+			MSE_LH_MEMCPY(dyn_arr4, dyn_arr4 + 3, 4 * sizeof(int));
+			assert((1 == dyn_arr4[0]) && (2 == dyn_arr4[1]) && (3 == dyn_arr4[2]) && (6 == dyn_arr4[3]) && (2 == dyn_arr4[4]));
+
+			/* And a range extending past the end of the array is rejected before anything is modified. */
+			try {
+				MSE_LH_MEMCPY(dyn_arr4 + 6, dyn_arr4, 4 * sizeof(int));
+				assert(false);
+			}
+			catch (const std::out_of_range&) {}
+			try {
+				MSE_LH_MEMSET(dyn_arr4 + 6, 0, 4 * sizeof(int));
+				assert(false);
+			}
+			catch (const std::out_of_range&) {}
+			assert((6 == dyn_arr4[6]) && (7 == dyn_arr4[7]));
+			MSE_LH_FREE(dyn_arr4);
+
+			/* Elements that aren't trivially copyable are copied by (bounds checked) element assignment, in an order that
+			handles overlap. */
+			MSE_LH_DYNAMIC_ARRAY_ITERATOR_TYPE(std::string) dyn_arr5;
+			MSE_LH_ALLOC(std::string, dyn_arr5, 4 * sizeof(std::string));
+			dyn_arr5[0] = "a"; dyn_arr5[1] = "b"; dyn_arr5[2] = "c"; dyn_arr5[3] = "d";
+			MSE_LH_MEMCPY(dyn_arr5 + 1, dyn_arr5, 3 * sizeof(std::string));
+			assert((std::string("a") == dyn_arr5[1]) && (std::string("b") == dyn_arr5[2]) && (std::string("c") == dyn_arr5[3]));
+			MSE_LH_MEMCPY(dyn_arr5, dyn_arr5 + 1, 3 * sizeof(std::string));
+			assert((std::string("a") == dyn_arr5[0]) && (std::string("b") == dyn_arr5[1]) && (std::string("c") == dyn_arr5[2]));
+			/* Each of those element accesses is bounds checked. */
+			try {
+				MSE_LH_MEMCPY(dyn_arr5 + 2, dyn_arr5, 3 * sizeof(std::string));
+				assert(false);
+			}
+			catch (...) {}
+			MSE_LH_FREE(dyn_arr5);
+		}
+#endif // !MSE_LEGACYHELPERS_DISABLED
+
+		{
+			typedef int dyn_arr3_element_type;
+			MSE_LH_DYNAMIC_ARRAY_ITERATOR_TYPE(dyn_arr3_element_type) dyn_arr3;
+			MSE_LH_ALLOC(dyn_arr3_element_type, dyn_arr3, 16 * sizeof(dyn_arr3_element_type));
+			/* (A value of -1 results in the same element values whether MSE_LH_MEMSET() sets elements, as the safe
+			implementation does, or bytes, as memset() does when the legacy helpers are disabled.) */
+			MSE_LH_MEMSET(dyn_arr3, -1, 16 * sizeof(dyn_arr3_element_type));
+
+			const char* filename = "msetl_example2_lh_tmp.bin";
+			FILE* stream = fopen(filename, "wb");
+			if (stream) {
+				/* When the target is in contiguous storage, MSE_LH_FWRITE() and MSE_LH_FREAD() check the bounds once and
+				then transfer the data directly. */
+				auto num_written = MSE_LH_FWRITE(dyn_arr3, sizeof(dyn_arr3_element_type), 16, stream);
+				assert(16 == num_written);
+				fclose(stream);
+
+				stream = fopen(filename, "rb");
+				if (stream) {
+					MSE_LH_MEMSET(dyn_arr3, 0, 16 * sizeof(dyn_arr3_element_type));
+					auto num_read = MSE_LH_FREAD(dyn_arr3, sizeof(dyn_arr3_element_type), 16, stream);
+					assert((16 == num_read) && (-1 == dyn_arr3[15]));
+#ifndef MSE_LEGACYHELPERS_DISABLED
+					try {
+						/* A byte count (size * count) that would overflow is rejected rather than wrapped around. */
+						MSE_LH_FREAD(dyn_arr3, sizeof(dyn_arr3_element_type), (std::numeric_limits<size_t>::max)() / 2, stream);
+						assert(false);
+					}
+					catch (const std::overflow_error&) {}
+#endif // !MSE_LEGACYHELPERS_DISABLED
+					fclose(stream);
+				}
+
+#ifndef MSE_LEGACYHELPERS_DISABLED
+				{
+					/* mse::lh::CReadOnlyMappedFile provides (memory mapped, where supported) read-only access to the
+					contents of a file, which can be accessed via a "random access section". */
+					mse::TXScopeObj<mse::lh::CReadOnlyMappedFile> xs_mapped_file(filename);
+					mse::TXScopeAnyRandomAccessConstSection<unsigned char> xs_file_section = mse::lh::make_xscope_mapped_file_const_section(&xs_mapped_file);
+					assert(16 * sizeof(dyn_arr3_element_type) == xs_file_section.size());
+					assert(0xff == xs_file_section[0]);
+				}
+#endif // !MSE_LEGACYHELPERS_DISABLED
+				remove(filename);
+			}
+			MSE_LH_FREE(dyn_arr3);
 		}
 	}
 
@@ -1376,6 +1579,17 @@ void msetl_example2() {
 			static int foo2(mse::TAsyncSharedV2ImmutableFixedPointer<ShareableA> A_immptr) {
 				return A_immptr->b;
 			}
+			static int foo2b(mse::TAsyncSharedV2ImmutableFixedPointer<mse::THazardObj<ShareableA> > A_immptr) {
+				/* Copies of this (hazard) pointer are registered in a record belonging to this thread rather than in a
+				reference count shared with other threads. */
+				mse::THazardConstPointer<ShareableA> A_hzdptr1 = &(*A_immptr);
+				int sum = 0;
+				for (size_t i = 0; i < 10; i += 1) {
+					auto A_hzdptr2 = A_hzdptr1;
+					sum += A_hzdptr2->b;
+				}
+				return sum;
+			}
 			static int foo3(mse::TAsyncSharedV2AtomicFixedPointer<ShareableD> D_atomic_ptr) {
 				auto d = (*D_atomic_ptr).load();
 				d.b += 1;
@@ -1390,6 +1604,14 @@ void msetl_example2() {
 				std::this_thread::sleep_for(std::chrono::milliseconds(10));
 				return (*xs_D_atomic_ptr).load().b;
 			}
+			static int foo5(mse::TXScopeAtomicFixedPointer<ShareableD> xs_D_atomic_ptr, mse::TXScopeAtomicFixedPointer<int> xs_go_flag_ptr) {
+				/* Block (without spinning) until the go flag is no longer zero. */
+				mse::xscope_atomic_wait(xs_go_flag_ptr, 0);
+				/* Unlike the load() and store() in foo4(), this increment won't be lost if another thread modifies the
+				object at the same time. */
+				auto prev_d = mse::xscope_atomic_fetch_update(xs_D_atomic_ptr, [](ShareableD d) { d.b += 1; return d; });
+				return prev_d.b + 1;
+			}
 		protected:
 			~B() {}
 		};
@@ -1442,6 +1664,172 @@ void msetl_example2() {
 			}
 			std::cout << std::endl;
 		}
+		{
+			/* mse::TAsyncSharedV2StripedReadWriteAccessRequester<> partitions a shared object into independently locked
+			"stripes", so that threads accessing different stripes don't contend for the same lock. */
+			auto striped_ar = mse::make_asyncsharedv2stripedreadwrite<mse::nii_vector<int> >(8);
+			assert(8 == striped_ar.num_stripes());
+
+			/* Each stripe can be selected by index or by key (hash). */
+			striped_ar.writelock_ptr(3)->push_back(3);
+			striped_ar.writelock_ptr_for_key(std::string("session 17"))->push_back(17);
+			assert(1 == striped_ar.readlock_ptr(3)->size());
+
+			{
+				/* Locks on multiple stripes are acquired in ascending index order, which avoids lock ordering deadlocks. */
+				auto writelock_ptrs = striped_ar.writelock_ptrs({ 5, 1, 5 });
+				assert(2 == writelock_ptrs.size());
+				writelock_ptrs.at(0)->push_back(1);
+				writelock_ptrs.at(1)->push_back(5);
+			}
+			{
+				/* Stripe locks can also be acquired separately, as long as it's in ascending index order. */
+				auto writelock_ptr1 = striped_ar.writelock_ptr(1);
+				auto writelock_ptr5 = striped_ar.writelock_ptr(5);
+				/* Re-acquiring (the recursive lock of) a stripe that's already held is fine. */
+				assert(1 == striped_ar.readlock_ptr(5)->size());
+#ifndef NDEBUG
+				/* But (blocking) requests for a lock on a stripe with a lower index than one already held could deadlock
+				with another thread doing the opposite, so in debug builds they result in an exception. */
+				try {
+					auto writelock_ptr2 = striped_ar.writelock_ptr(2);
+					assert(false);
+				}
+				catch (...) {
+					// expected exception
+				}
+				try {
+					auto readlock_ptrs = striped_ar.readlock_ptrs({ 6, 0 });
+					assert(false);
+				}
+				catch (...) {
+					// expected exception
+				}
+#endif // !NDEBUG
+				/* Non-blocking requests can't deadlock, so they're not restricted. */
+				auto maybe_writelock_ptr2 = striped_ar.try_writelock_ptr(2);
+				assert(maybe_writelock_ptr2.has_value());
+			}
+			{
+				/* Once the higher stripes are released, lower ones can be requested again. */
+				auto writelock_ptr2 = striped_ar.writelock_ptr(2);
+				assert(0 == writelock_ptr2->size());
+			}
+
+			class CB {
+			public:
+				static size_t foo1(mse::TAsyncSharedV2StripedReadWriteAccessRequester<mse::nii_vector<int> > striped_ar, int id) {
+					for (int i = 0; i < 100; i += 1) {
+						striped_ar.writelock_ptr_for_key(i * id)->push_back(i);
+					}
+					return striped_ar.readlock_ptr(0)->size();
+				}
+				static size_t foo2(mse::TAsyncSharedV2StripedReadWriteAccessRequester<mse::nii_vector<int> > striped_ar, size_t first_index, size_t second_index) {
+					size_t num_locked = 0;
+					for (int i = 0; i < 1000; i += 1) {
+						num_locked += striped_ar.writelock_ptrs({ first_index, second_index }).size();
+					}
+					return num_locked;
+				}
+			};
+			{
+				/* Threads requesting the same stripes (together) in opposite orders don't deadlock each other. */
+				auto future1 = mse::mstd::async(CB::foo2, striped_ar, 5, 1);
+				auto future2 = mse::mstd::async(CB::foo2, striped_ar, 1, 5);
+				assert(2000 == future1.get());
+				assert(2000 == future2.get());
+			}
+			std::list<mse::mstd::future<size_t>> futures;
+			for (int i = 1; i <= 3; i += 1) {
+				futures.emplace_back(mse::mstd::async(CB::foo1, striped_ar, i));
+			}
+			for (auto it = futures.begin(); futures.end() != it; it++) {
+				(*it).get();
+			}
+			size_t total_size = 0;
+			for (auto& readlock_ptr : striped_ar.readlock_ptrs({ 0, 1, 2, 3, 4, 5, 6, 7 })) {
+				total_size += readlock_ptr->size();
+			}
+			assert(304 == total_size);
+		}
+		{
+			/* mse::nii_unordered_map<> is an unordered map, with flat storage, that (like nii_vector<>) doesn't support
+			implicit iterators. Direct scope pointers to values can be obtained via a structure change lock guard. */
+			mse::TXScopeObj<mse::nii_unordered_map<int, mse::nii_string> > xs_map1;
+			xs_map1.insert_or_assign(1, "one");
+			xs_map1[2] = "two";
+			assert(2 == xs_map1.size());
+			{
+				auto xs_lock_guard = mse::make_xscope_unordered_map_structure_change_lock_guard(&xs_map1);
+				auto xs_value_ptr = xs_lock_guard.xscope_ptr_to_value(2);
+				*xs_value_ptr = "deux";
+#if !defined(MSE_SCOPEPOINTER_DISABLED)
+				try {
+					/* Inserting or removing elements isn't allowed while a structure change lock guard exists. */
+					xs_map1.erase(1);
+					assert(false);
+				}
+				catch (...) {}
+#endif // !defined(MSE_SCOPEPOINTER_DISABLED)
+			}
+			assert(mse::nii_string("deux") == xs_map1.at(2));
+			{
+				const auto& map1_cref = xs_map1;
+				try {
+					/* Nor while the map is being traversed via a const reference. */
+					map1_cref.for_each([&xs_map1](const int&, const mse::nii_string&) { xs_map1.erase(1); });
+					assert(false);
+				}
+				catch (...) {}
+				assert(xs_map1.contains(1));
+			}
+			xs_map1.erase(1);
+			assert(!xs_map1.contains(1));
+
+			/* mse::TAsyncSharedV2ConcurrentUnorderedMap<> is a shareable map whose elements are partitioned among
+			independently locked "shards" (each an nii_unordered_map<>). */
+			auto concurrent_map = mse::make_asyncsharedv2concurrentunorderedmap<int, int>(8);
+
+			class CB {
+			public:
+				static size_t foo1(mse::TAsyncSharedV2ConcurrentUnorderedMap<int, int> concurrent_map, int id) {
+					for (int i = 0; i < 100; i += 1) {
+						concurrent_map.insert_or_assign(1000 * id + i, i);
+						concurrent_map.visit(1000 * id + i, [](int& value) { value += 1; });
+					}
+					return concurrent_map.get(1000 * id).value();
+				}
+			};
+			std::list<mse::mstd::future<size_t>> futures;
+			for (int i = 1; i <= 3; i += 1) {
+				futures.emplace_back(mse::mstd::async(CB::foo1, concurrent_map, i));
+			}
+			for (auto it = futures.begin(); futures.end() != it; it++) {
+				(*it).get();
+			}
+			assert(300 == concurrent_map.size());
+			assert(100 == *concurrent_map.get(2099));
+			assert(100 == concurrent_map.readlock_ptr_for_key(3099)->at(3099));
+
+			/* The shard locks are recursive, so a function object passed to visit() could reenter the map. But any attempt
+			to remove (or insert) an element of the visited shard while the function object holds a reference to one of its
+			values results in an exception. */
+			try {
+				concurrent_map.visit(2099, [concurrent_map](int& value) { concurrent_map.erase(2099); value += 1; });
+				assert(false);
+			}
+			catch (...) {}
+			assert(100 == *concurrent_map.get(2099));
+			try {
+				concurrent_map.cvisit(2099, [concurrent_map](const int&) { concurrent_map.erase(2099); });
+				assert(false);
+			}
+			catch (...) {}
+			assert(concurrent_map.contains(2099));
+			/* Modifying the visited value, or other shards, is fine. */
+			concurrent_map.visit(2099, [concurrent_map](int& value) { value += 1; concurrent_map.insert_or_assign(2099, value + 1); });
+			assert(102 == *concurrent_map.get(2099));
+		}
 		{
 			/* Just demonstrating the existence of the "try" versions. */
 			auto access_requester = mse::make_asyncsharedv2readwrite<mse::nii_string>("some text");
@@ -1493,6 +1881,503 @@ void msetl_example2() {
 
 			auto A_b_safe_cptr = mse::make_const_pointer_to_member_v2(A_immptr, &A::b);
 		}
+		{
+			/* If the shared immutable object is wrapped in an mse::THazardObj<>, each thread can obtain (run-time checked)
+			"hazard" pointers to it, which it can copy without modifying a reference count shared with other threads. */
+			auto A_hazard_immptr = mse::make_asyncsharedv2immutable<mse::THazardObj<ShareableA> >(5);
+
+			std::list<mse::mstd::future<int>> futures;
+			for (size_t i = 0; i < 3; i += 1) {
+				futures.emplace_back(mse::mstd::async(B::foo2b, A_hazard_immptr));
+			}
+			for (auto it = futures.begin(); futures.end() != it; it++) {
+				int res3 = (*it).get();
+				assert(50 == res3);
+			}
+		}
+		{
+			/* For read-mostly objects that are occasionally replaced (with a new immutable version), there's
+			mse::TAsyncSharedV2EpochImmutablePointer<>. Reading the current version through a "pinned" pointer doesn't
+			modify any reference count (or anything else) shared with other threads. */
+			auto A_epoch_immptr = mse::make_asyncsharedv2epochimmutable<ShareableA>(5);
+			{
+				auto A_pinned_ptr1 = A_epoch_immptr.xscope_pinned_ptr();
+				assert(5 == A_pinned_ptr1->b);
+
+				/* Publishing a new version doesn't affect the version A_pinned_ptr1 is pointing to. */
+				A_epoch_immptr.publish(6);
+				assert(5 == A_pinned_ptr1->b);
+				assert(6 == A_epoch_immptr.xscope_pinned_ptr()->b);
+			}
+
+			class CB {
+			public:
+				static int foo1(mse::TAsyncSharedV2EpochImmutablePointer<ShareableA> A_epoch_immptr) {
+					int max_b = 0;
+					for (size_t i = 0; i < 1000; i += 1) {
+						auto A_pinned_ptr = A_epoch_immptr.xscope_pinned_ptr();
+						max_b = std::max(max_b, A_pinned_ptr->b);
+					}
+					return max_b;
+				}
+			};
+
+			std::list<mse::mstd::future<int>> futures;
+			for (size_t i = 0; i < 3; i += 1) {
+				futures.emplace_back(mse::mstd::async(CB::foo1, A_epoch_immptr));
+			}
+			for (int i = 7; i < 100; i += 1) {
+				A_epoch_immptr.publish(i);
+			}
+			for (auto it = futures.begin(); futures.end() != it; it++) {
+				int res2 = (*it).get();
+				assert((6 <= res2) && (99 >= res2));
+			}
+		}
+		{
+			/* mse::TAsyncSharedV2AtomicSnapshot<> holds an immutable object that can be atomically replaced. Unlike
+			with mse::TAsyncSharedV2AtomicFixedPointer<>, the object doesn't need to be trivially copyable. Readers obtain
+			a TAsyncSharedV2ImmutableFixedPointer<> to the current version without locking. */
+			auto A_snapshot_holder = mse::make_asyncsharedv2atomicsnapshot<ShareableA>(5);
+			auto A_immptr1 = A_snapshot_holder.snapshot();
+			assert(5 == A_immptr1->b);
+
+			A_snapshot_holder.publish(6);
+			/* Existing snapshots are unaffected. */
+			assert(5 == A_immptr1->b);
+			assert(6 == A_snapshot_holder.snapshot()->b);
+
+			/* You can also publish an existing immutable object. */
+			A_snapshot_holder.store(A_immptr1);
+			assert(5 == A_snapshot_holder.snapshot()->b);
+
+			class CB {
+			public:
+				static int foo1(mse::TAsyncSharedV2AtomicSnapshot<ShareableA> A_snapshot_holder) {
+					int max_b = 0;
+					for (size_t i = 0; i < 1000; i += 1) {
+						auto A_immptr = A_snapshot_holder.snapshot();
+						max_b = std::max(max_b, A_immptr->b);
+					}
+					return max_b;
+				}
+			};
+
+			std::list<mse::mstd::future<int>> futures;
+			for (size_t i = 0; i < 3; i += 1) {
+				futures.emplace_back(mse::mstd::async(CB::foo1, A_snapshot_holder));
+			}
+			for (int i = 7; i < 100; i += 1) {
+				A_snapshot_holder.publish(i);
+			}
+			for (auto it = futures.begin(); futures.end() != it; it++) {
+				int res2 = (*it).get();
+				assert((5 <= res2) && (99 >= res2));
+			}
+		}
+		{
+			/* Concurrent publishing and reading of a snapshot of a (non-trivial) string type. Each published version
+			consists of a single repeated character, so readers can verify that the version they obtained is intact. */
+			class CB {
+			public:
+				static int read(mse::TAsyncSharedV2AtomicSnapshot<mse::nii_string> snapshot_holder) {
+					int num_intact = 0;
+					for (int i = 0; i < 2000; i += 1) {
+						auto immptr = snapshot_holder.snapshot();
+						const auto& str_cref = *immptr;
+						bool is_intact = !str_cref.empty();
+						for (size_t j = 0; str_cref.size() > j; j += 1) {
+							is_intact = is_intact && (str_cref[0] == str_cref[j]);
+						}
+						num_intact += is_intact ? 1 : 0;
+					}
+					return num_intact;
+				}
+				static int write(mse::TAsyncSharedV2AtomicSnapshot<mse::nii_string> snapshot_holder, char ch) {
+					for (int i = 1; i <= 2000; i += 1) {
+						snapshot_holder.publish(size_t(1 + (i % 64)), ch);
+					}
+					return 0;
+				}
+			};
+
+			auto snapshot_holder = mse::make_asyncsharedv2atomicsnapshot<mse::nii_string>(size_t(1), 'a');
+			std::list<mse::mstd::future<int>> futures;
+			for (size_t i = 0; i < 3; i += 1) {
+				futures.emplace_back(mse::mstd::async(CB::read, snapshot_holder));
+			}
+			auto future1 = mse::mstd::async(CB::write, snapshot_holder, 'b');
+			auto future2 = mse::mstd::async(CB::write, snapshot_holder, 'c');
+			future1.get();
+			future2.get();
+			for (auto it = futures.begin(); futures.end() != it; it++) {
+				int res2 = (*it).get();
+				assert(2000 == res2);
+			}
+		}
+		{
+			/* mse::spsc_channel<> and mse::mpmc_channel<> are bounded queues for passing elements between threads. Their
+			"sender" and "receiver" ends are handles that can be passed to the producer and consumer threads. The element
+			type must be recognized as safe to pass between threads. */
+
+			class CB {
+			public:
+				static int produce1(mse::spsc_channel<int>::sender_t sender) {
+					for (int i = 1; i <= 1000; i += 1) {
+						sender.send(i);
+					}
+					return 0;
+				}
+				static int consume1(mse::spsc_channel<int>::receiver_t receiver) {
+					int sum = 0;
+					/* receive() returns an empty optional once the channel is closed (i.e. its sender is gone) and
+					drained. */
+					while (auto maybe_value = receiver.receive()) {
+						sum += maybe_value.value();
+					}
+					return sum;
+				}
+				static int produce2(mse::mpmc_channel<int>::sender_t sender) {
+					for (int i = 1; i <= 1000; i += 1) {
+						sender.send(i);
+					}
+					return 0;
+				}
+				static int consume2(mse::mpmc_channel<int>::receiver_t receiver, int count) {
+					int sum = 0;
+					for (int i = 0; i < count; i += 1) {
+						sum += receiver.receive().value();
+					}
+					return sum;
+				}
+				/* Sends a couple of elements, each after the receiver has (likely) parked, then goes away, closing the
+				channel. */
+				static int produce3(mse::spsc_channel<int>::sender_t sender) {
+					for (int i = 1; i <= 2; i += 1) {
+						std::this_thread::sleep_for(std::chrono::microseconds(200));
+						sender.send(i);
+					}
+					return 0;
+				}
+				static int count_received(mse::spsc_channel<int>::receiver_t receiver) {
+					int count = 0;
+					while (receiver.receive()) {
+						count += 1;
+					}
+					return count;
+				}
+			};
+
+			{
+				mse::spsc_channel<int> channel1(64);
+				assert(64 == channel1.capacity());
+
+				/* An spsc_channel<>'s sender and receiver can each be obtained only once, and can be moved, but not copied. */
+				auto future1 = mse::mstd::async(CB::produce1, channel1.sender());
+				auto future2 = mse::mstd::async(CB::consume1, channel1.receiver());
+				future1.get();
+				auto res1 = future2.get();
+				assert(500500 == res1);
+			}
+			{
+				/* The closing of the channel (when the sender goes away) races with the receiver's wake up. No element
+				should be lost. */
+				for (int i = 0; i < 50; i += 1) {
+					mse::spsc_channel<int> channel1(1);
+					auto future2 = mse::mstd::async(CB::count_received, channel1.receiver());
+					auto future1 = mse::mstd::async(CB::produce3, channel1.sender());
+					future1.get();
+					auto num_received = future2.get();
+					assert(2 == num_received);
+				}
+			}
+			{
+				mse::mpmc_channel<int> channel2(16);
+
+				/* mpmc_channel<> senders and receivers can be copied and shared between any number of threads. */
+				auto sender = channel2.sender();
+				auto receiver = channel2.receiver();
+				auto future1 = mse::mstd::async(CB::produce2, sender);
+				auto future2 = mse::mstd::async(CB::produce2, sender);
+				auto future3 = mse::mstd::async(CB::consume2, receiver, 1000);
+				auto future4 = mse::mstd::async(CB::consume2, receiver, 1000);
+				future1.get();
+				future2.get();
+				auto res2 = future3.get() + future4.get();
+				assert(2 * 500500 == res2);
+
+				/* The try_*() member functions don't block. */
+				auto maybe_value1 = receiver.try_receive();
+				assert(!maybe_value1);
+				bool send_succeeded = sender.try_send(5);
+				assert(send_succeeded);
+				auto maybe_value = receiver.try_receive();
+				assert(maybe_value && (5 == maybe_value.value()));
+			}
+			{
+				/* A channel with a capacity of one holds (at most) one element. */
+				mse::mpmc_channel<int> channel3(1);
+				assert(1 == channel3.capacity());
+				auto sender = channel3.sender();
+				auto receiver = channel3.receiver();
+				assert(sender.try_send(6));
+				assert(!sender.try_send(7));
+				auto maybe_value1 = receiver.try_receive();
+				assert(maybe_value1 && (6 == maybe_value1.value()));
+				assert(!receiver.try_receive());
+
+				auto future1 = mse::mstd::async(CB::produce2, sender);
+				auto future2 = mse::mstd::async(CB::produce2, sender);
+				auto future3 = mse::mstd::async(CB::consume2, receiver, 1000);
+				auto future4 = mse::mstd::async(CB::consume2, receiver, 1000);
+				future1.get();
+				future2.get();
+				auto res3 = future3.get() + future4.get();
+				assert(2 * 500500 == res3);
+			}
+			{
+				/* An element whose (copy) construction throws mustn't leave the channel unusable. */
+				class CThrowsOnCopy {
+				public:
+					CThrowsOnCopy(int value, bool throw_on_copy = false) : m_value(value), m_throw_on_copy(throw_on_copy) {}
+					CThrowsOnCopy(const CThrowsOnCopy& src) : m_value(src.m_value), m_throw_on_copy(src.m_throw_on_copy) {
+						if (m_throw_on_copy) { throw std::runtime_error("CThrowsOnCopy"); }
+					}
+					CThrowsOnCopy(CThrowsOnCopy&& src) noexcept = default;
+					void async_shareable_and_passable_tag() const {}
+					int m_value = 0;
+					bool m_throw_on_copy = false;
+				};
+				mse::mpmc_channel<CThrowsOnCopy> channel4(2);
+				auto sender = channel4.sender();
+				auto receiver = channel4.receiver();
+				const CThrowsOnCopy throwing_value(8, true/*throw_on_copy*/);
+				try {
+					sender.try_send(throwing_value);
+					assert(false);
+				}
+				catch (...) {
+					std::cout << "expected exception" << std::endl;
+				}
+				try {
+					sender.send(throwing_value);
+					assert(false);
+				}
+				catch (...) {
+					std::cout << "expected exception" << std::endl;
+				}
+				assert(!receiver.try_receive());
+				for (int i = 0; i < 3; i += 1) {
+					assert(sender.try_send(CThrowsOnCopy(9 + i)));
+					auto maybe_value = receiver.try_receive();
+					assert(maybe_value && ((9 + i) == maybe_value.value().m_value));
+				}
+			}
+		}
+		{
+			/* The futures returned by mstd::async() support continuations. The continuation is run (on a library executor
+			thread) once the future's value is available, without a thread having to wait for it in the meantime. */
+			class CB {
+			public:
+				static int produce(int x) {
+					return 2 * x;
+				}
+				static int add_one(int x) {
+					return x + 1;
+				}
+				static double halve(int x) {
+					return x / 2.0;
+				}
+				static int value_of(mse::when_any_result<int> result) {
+					return result.value;
+				}
+			};
+
+			auto future1 = mse::mstd::async(CB::produce, 5).then(CB::add_one).then(CB::halve);
+			auto res1 = future1.get();
+			assert(5.5 == res1);
+
+			/* when_all() and when_any() combine futures (without blocking). */
+			auto future2 = mse::mstd::when_all(mse::mstd::async(CB::produce, 1), mse::mstd::async(CB::halve, 3));
+			auto res2 = future2.get();
+			assert((2 == std::get<0>(res2)) && (1.5 == std::get<1>(res2)));
+
+			std::vector<mse::mstd::future<int> > futures;
+			for (int i = 0; i < 8; i += 1) {
+				futures.push_back(mse::mstd::async(CB::produce, i));
+			}
+			auto future3 = mse::mstd::when_all(futures.begin(), futures.end());
+			auto res3 = future3.get();
+			assert((8 == res3.size()) && (14 == res3.back()));
+
+			auto future4 = mse::mstd::when_any(mse::mstd::async(CB::produce, 3), mse::mstd::async(CB::produce, 3)).then(CB::value_of);
+			auto res4 = future4.get();
+			assert(6 == res4);
+
+			/* Continuations of deferred futures are run on a dedicated thread, rather than tying up an executor thread. */
+			auto future5 = mse::mstd::async(std::launch::deferred, CB::produce, 2).then(CB::add_one);
+			auto res5 = future5.get();
+			assert(5 == res5);
+
+			{
+				/* xscope_future<>s support the same operations, with the scope restrictions on the passed function objects
+				and values. Here we share an access controlled scope object with the scope tasks. */
+				mse::TXScopeObj<mse::TXScopeAccessControlledObj<int> > xscope_aco(5);
+				auto xscope_access_requester = mse::make_xscope_asyncsharedv2acoreadwrite(&xscope_aco);
+
+				auto res5 = mse::xscope_async(J::foo19<decltype(xscope_access_requester)>, xscope_access_requester).then(CB::add_one).get();
+				assert(6 == res5);
+#ifdef MSE_HAS_CXX17
+				auto xscope_future1 = mse::xscope_async(J::foo19<decltype(xscope_access_requester)>, xscope_access_requester);
+				auto xscope_future2 = mse::xscope_async(J::foo19<decltype(xscope_access_requester)>, xscope_access_requester);
+				/* Note that the resulting xscope_future<>'s destructor waits for all the tasks it was derived from. */
+				auto xscope_future3 = mse::xscope_when_all(xscope_future1, xscope_future2);
+				auto res6 = xscope_future3.get();
+				assert((5 == std::get<0>(res6)) && (5 == std::get<1>(res6)));
+#endif // MSE_HAS_CXX17
+			}
+		}
+#ifdef MSE_HAS_CXX20_COROUTINES
+		{
+			/* With C++20 (coroutine) support, access requesters also provide awaitable versions of lock acquisition. Rather
+			than blocking the thread while the lock is unavailable, the awaiting co_task is suspended, freeing the thread to
+			run other tasks. */
+			class CB {
+			public:
+				static mse::co_task increment(mse::TAsyncSharedV2ReadWriteAccessRequester<ShareableA> ar, int count) {
+					for (int i = 0; i < count; i += 1) {
+						auto writelock_ptr = co_await ar.async_writelock_ptr();
+						writelock_ptr->b += 1;
+					}
+				}
+				static mse::co_task read_and_increment(mse::TAsyncSharedV2ReadWriteAccessRequester<ShareableA> ar, int count) {
+					for (int i = 0; i < count; i += 1) {
+						{
+							auto readlock_ptr = co_await ar.async_readlock_ptr();
+							assert(0 <= readlock_ptr->b);
+						}
+						/* A co_task can co_await another co_task. */
+						co_await increment(ar, 1);
+					}
+				}
+				static int increment_blocking(mse::TAsyncSharedV2ReadWriteAccessRequester<ShareableA> ar) {
+					for (int i = 0; i < 100; i += 1) {
+						ar.writelock_ptr()->b += 1;
+					}
+					return 0;
+				}
+			};
+
+			auto ash_access_requester = mse::make_asyncsharedv2readwrite<ShareableA>(0);
+			{
+				/* co_scheduler runs its tasks on the thread that calls its run() member function. */
+				mse::co_scheduler scheduler1;
+				for (int i = 0; i < 10; i += 1) {
+					scheduler1.spawn(CB::increment, ash_access_requester, 10);
+				}
+				scheduler1.run();
+				assert(100 == ash_access_requester.readlock_ptr()->b);
+			}
+			{
+				/* Tasks that are never run are destroyed (along with the arguments they own) with the scheduler. */
+				auto shared_int_ptr = std::make_shared<int>(5);
+				{
+					mse::co_scheduler scheduler3;
+					scheduler3.spawn([](std::shared_ptr<int> int_ptr) -> mse::co_task { *int_ptr += 1; co_return; }, shared_int_ptr);
+					assert(2 == shared_int_ptr.use_count());
+				}
+				assert((1 == shared_int_ptr.use_count()) && (5 == *shared_int_ptr));
+			}
+			{
+				/* co_thread_pool_scheduler runs its tasks on a set of threads. As with mstd::thread, the arguments are
+				required to be of a type that's safely passable to other threads. */
+				mse::co_thread_pool_scheduler scheduler2(4);
+				for (int i = 0; i < 20; i += 1) {
+					scheduler2.spawn(CB::read_and_increment, ash_access_requester, 10);
+				}
+				/* Tasks can coexist with threads using the (blocking) lock pointers. */
+				auto future1 = mse::mstd::async(CB::increment_blocking, ash_access_requester);
+				future1.get();
+				scheduler2.join();
+				assert(400 == ash_access_requester.readlock_ptr()->b);
+			}
+			{
+				/* A task that requests a lock it would have to wait for itself to release (like a write lock on an object it
+				holds a read lock on) gets an exception (as exclusive_writelock_ptr() would throw), rather than being
+				suspended indefinitely. */
+				mse::co_scheduler scheduler4;
+				scheduler4.spawn([](mse::TAsyncSharedV2ReadWriteAccessRequester<ShareableA> ar) -> mse::co_task {
+					{
+						auto readlock_ptr = co_await ar.async_readlock_ptr();
+						try {
+							auto writelock_ptr = co_await ar.async_writelock_ptr();
+							assert(false);
+						}
+						catch (const std::system_error&) {}
+						/* Including when the request is made by a child task. */
+						try {
+							co_await CB::increment(ar, 1);
+							assert(false);
+						}
+						catch (const std::system_error&) {}
+						/* Additional read locks are fine. */
+						auto readlock_ptr2 = co_await ar.async_readlock_ptr();
+						assert(readlock_ptr2->b == readlock_ptr->b);
+					}
+					{
+						auto writelock_ptr = co_await ar.async_writelock_ptr();
+						try {
+							auto readlock_ptr = co_await ar.async_readlock_ptr();
+							assert(false);
+						}
+						catch (const std::system_error&) {}
+						writelock_ptr->b += 1;
+					}
+					/* Once the task's locks are released, it can obtain any of them again. */
+					co_await CB::increment(ar, 1);
+				}, ash_access_requester);
+				scheduler4.run();
+				assert(402 == ash_access_requester.readlock_ptr()->b);
+			}
+		}
+#endif // MSE_HAS_CXX20_COROUTINES
+#ifdef MSE_ENABLE_LOCK_PROFILING
+		{
+			/* When the MSE_ENABLE_LOCK_PROFILING preprocessor symbol is defined, the mutexes used by the access
+			requesters record their contention statistics, which can be queried (or dumped) at run-time. */
+			class CB {
+			public:
+				static int increment(mse::TAsyncSharedV2ReadWriteAccessRequester<ShareableA> ar) {
+					for (int i = 0; i < 100; i += 1) {
+						ar.writelock_ptr()->b += 1;
+					}
+					return 0;
+				}
+			};
+
+			auto ash_access_requester = mse::make_asyncsharedv2readwrite<ShareableA>(0);
+			{
+				std::list<mse::mstd::future<int>> futures;
+				for (size_t i = 0; i < 4; i += 1) {
+					futures.emplace_back(mse::mstd::async(CB::increment, ash_access_requester));
+				}
+				for (auto& future : futures) {
+					future.get();
+				}
+			}
+			assert(400 == ash_access_requester.readlock_ptr()->b);
+
+			/* The profiles are ordered by decreasing total wait time, so the most contended mutexes come first. */
+			auto profiles = mse::stats::lock_profiles();
+			auto found_it = std::find_if(profiles.begin(), profiles.end(), [](const mse::stats::lock_profile_t& profile) {
+				return (400 <= profile.exclusive_acquisitions);
+			});
+			assert(profiles.end() != found_it);
+			if (profiles.end() != found_it) {
+				(*found_it).dump(std::cout);
+			}
+		}
+#endif // MSE_ENABLE_LOCK_PROFILING
 		{
 			/* For scenarios where the shared object is atomic, you can get away without using locks
 			or access requesters. */
@@ -1840,6 +2725,33 @@ void msetl_example2() {
 			int res2 = (*xscope_D_atomic_ptr).load().b;
 		}
 
+		{
+			/* mse::xscope_atomic_fetch_update() supports atomic "read-modify-write" operations not directly supported by
+			std::atomic<>'s member functions, and mse::xscope_atomic_wait() lets threads wait for an atomic object's
+			value to change. */
+			mse::TXScopeAtomicObj<ShareableD> xscope_D_atomic_obj(7);
+			mse::TXScopeAtomicObj<int> xscope_go_flag(0);
+			auto xscope_D_atomic_ptr = &xscope_D_atomic_obj;
+			auto xscope_go_flag_ptr = &xscope_go_flag;
+
+			{
+				mse::xscope_thread xscp_thread1(B::foo5, xscope_D_atomic_ptr, xscope_go_flag_ptr);
+				mse::xscope_thread xscp_thread2(B::foo5, xscope_D_atomic_ptr, xscope_go_flag_ptr);
+
+				xscope_go_flag.store(1);
+				mse::xscope_atomic_notify_all(xscope_go_flag_ptr);
+			}
+			assert(9 == xscope_D_atomic_obj.load().b);
+
+			/* These functions only accept (scope) pointers to atomic objects. So, for example, passing a native pointer to a
+			(non-scope) std::atomic<> would result in a compile error. */
+			static_assert(mse::impl::ns_atomic_wait::is_xscope_atomic_pointer<decltype(xscope_go_flag_ptr)>::value, "");
+			static_assert(!mse::impl::ns_atomic_wait::is_xscope_atomic_pointer<ShareableD*>::value, "");
+#ifndef MSE_SCOPEPOINTER_DISABLED
+			static_assert(!mse::impl::ns_atomic_wait::is_xscope_atomic_pointer<std::atomic<int>*>::value, "");
+#endif // !MSE_SCOPEPOINTER_DISABLED
+		}
+
 		{
 			/* This block is similar to a previous one that demonstrates safely allowing different threads to (simultaneously)
 			modify different sections of a vector. The difference is just that here the shared vector is a pre-existing one
@@ -1950,6 +2862,136 @@ void msetl_example2() {
 
 			int q = 5;
 		}
+
+		{
+			/* TXScopeStridedSection<> and TXScopeMultiDimSection<> are scope views over "random access sections" for things
+			like images and matrices. Their bounds are validated once, when the view is constructed, so element access and
+			traversal don't need to re-validate them. */
+			static const size_t num_rows = 6;
+			static const size_t num_columns = 4;
+
+			mse::TXScopeObj<mse::nii_vector<int> > xscope_image(num_rows * num_columns, 0);
+
+			{
+				/* Here we view the vector as a 6 x 4 (row-major) two-dimensional array. */
+				auto xscope_md_section = mse::make_xscope_multi_dim_section(&xscope_image, std::array<size_t, 2>{ { num_rows, num_columns } });
+				xscope_md_section(2, 3) = 7;
+				assert(7 == xscope_image[2 * num_columns + 3]);
+
+				/* Rows and columns are available as (one-dimensional) strided sections, which support range-based for loops
+				and standard algorithms. */
+				auto xscope_column3 = xscope_md_section.xscope_column(3);
+				assert(num_rows == xscope_column3.size());
+				assert(7 == xscope_column3[2]);
+				std::fill(xscope_column3.begin(), xscope_column3.end(), 1);
+
+				/* Rectangular "tiles" (subviews) are cheap to obtain. */
+				auto xscope_tile = xscope_md_section.xscope_subview({ { 1, 1 } }, { { 2, 3 } });
+				xscope_tile.for_each([](int& element_ref) { element_ref += 10; });
+				assert(11 == xscope_md_section(2, 3));
+
+				/* Views with arbitrary offsets and strides are also supported. Here we view every other element of every
+				other row. */
+				auto xscope_decimated_view = mse::make_xscope_multi_dim_section(&xscope_image, 0
+					, std::array<size_t, 2>{ { num_rows / 2, num_columns / 2 } }, std::array<size_t, 2>{ { 2 * num_columns, 2 } });
+				assert(&(xscope_decimated_view(1, 1)) == &(xscope_md_section(2, 2)));
+
+				/* And of course, out of bounds views and accesses are caught. */
+				try {
+					auto xscope_column4 = xscope_md_section.xscope_column(4);
+					assert(false);
+				}
+				catch (...) {}
+				try {
+					auto xscope_strided_section = mse::make_xscope_strided_section(&xscope_image, 1, num_rows + 1, num_columns);
+					assert(false);
+				}
+				catch (...) {}
+
+				/* Empty tiles are fine too, even where a non-empty tile's starting position would be past the end. (Here the
+				view is over a section whose iterator validates its arithmetic.) */
+				auto xscope_checked_ra_section = mse::make_xscope_random_access_section(mse::make_xscope_begin_iterator(&xscope_image), xscope_image.size());
+				auto xscope_checked_md_section = mse::make_xscope_multi_dim_section(xscope_checked_ra_section, std::array<size_t, 2>{ { num_rows, num_columns } });
+				auto xscope_empty_tile = xscope_checked_md_section.xscope_subview({ { num_rows, 1 } }, { { 0, 2 } });
+				assert(xscope_empty_tile.empty());
+				xscope_empty_tile.for_each([](int&) { assert(false); });
+				/* The strides of an empty view aren't validated, so neither are those of its tiles. */
+				auto xscope_empty_strided_view = mse::make_xscope_multi_dim_section(xscope_checked_ra_section, 0
+					, std::array<size_t, 2>{ { 0, 2 } }, std::array<size_t, 2>{ { 1000, 1000 } });
+				auto xscope_empty_tile2 = xscope_empty_strided_view.xscope_subview({ { 0, 1 } }, { { 0, 1 } });
+				assert(xscope_empty_tile2.empty());
+				try {
+					auto element_value = xscope_empty_tile2(0, 0);
+					assert(false);
+				}
+				catch (...) {}
+			}
+
+			{
+				/* When the underlying storage is contiguous and can't be relocated (as with an nii_array<>, but not a
+				(resizable) nii_vector<>), the views access their (already validated) elements via a raw pointer. */
+				mse::TXScopeObj<mse::nii_array<int, num_rows * num_columns> > xscope_array_image;
+				auto xscope_md_section = mse::make_xscope_multi_dim_section(&xscope_array_image, std::array<size_t, 2>{ { num_rows, num_columns } });
+				xscope_md_section(2, 3) = 7;
+				assert(7 == xscope_array_image[2 * num_columns + 3]);
+				assert(std::addressof(xscope_md_section(num_rows - 1, num_columns - 1)) == std::addressof(xscope_array_image.back()));
+
+				auto xscope_column3 = xscope_md_section.xscope_column(3);
+				std::fill(xscope_column3.begin(), xscope_column3.end(), 1);
+				assert(1 == xscope_array_image[(num_rows - 1) * num_columns + 3]);
+				auto xscope_tile = xscope_md_section.xscope_subview({ { 1, 1 } }, { { 2, 3 } });
+				xscope_tile.for_each([](int& element_ref) { element_ref += 10; });
+				assert(11 == xscope_md_section(2, 3));
+				assert(std::addressof(xscope_tile(0, 0)) == std::addressof(xscope_array_image[num_columns + 1]));
+
+				/* Indices are still checked against the view's extents. */
+				try {
+					auto element_value = xscope_md_section(num_rows, 0);
+					assert(false);
+				}
+				catch (...) {}
+				auto xscope_empty_row = xscope_md_section.xscope_line(1, { { 0, num_columns } });
+				assert(xscope_empty_row.empty());
+				try {
+					auto element_value = xscope_empty_row[0];
+					assert(false);
+				}
+				catch (...) {}
+			}
+
+			{
+				/* Since the rows of a row-major view are contiguous, a "band" of rows is just a "random access section". So
+				multi-dimensional views can be split up among threads using the existing section splitters. Here we'll split
+				the image into three bands of two rows each. */
+				mse::TXScopeObj<mse::TXScopeAccessControlledObj<mse::nii_vector<int> > > xscope_acimage;
+				(*(xscope_acimage.xscope_pointer())).swap(xscope_image);
+
+				static const size_t rows_per_band = 2;
+				mse::mstd::vector<size_t> section_sizes;
+				for (size_t i = 0; i < num_rows / rows_per_band; i += 1) {
+					section_sizes.push_back(rows_per_band * num_columns);
+				}
+				{
+					mse::TXScopeAsyncACORASectionSplitter<mse::nii_vector<int> > xscope_ra_section_split1(&xscope_acimage, section_sizes);
+					auto ar0 = xscope_ra_section_split1.ra_section_access_requester(0);
+
+					auto my_foo18_function = J::foo18<decltype(ar0.writelock_ra_section())>;
+					typedef decltype(my_foo18_function) my_foo18_function_type;
+					auto my_foo18_proxy_function = J::invoke_with_writelock_ra_section1<decltype(ar0), my_foo18_function_type, const size_t&>;
+
+					mse::xscope_thread_carrier xscope_threads;
+					for (size_t i = 0; i < section_sizes.size(); i += 1) {
+						auto ar = xscope_ra_section_split1.ra_section_access_requester(i);
+						xscope_threads.new_thread(my_foo18_proxy_function, ar, my_foo18_function, num_columns);
+					}
+					/* The scope will not end until all the scope threads have finished executing. */
+				}
+
+				(*(xscope_acimage.xscope_pointer())).swap(xscope_image);
+				/* Each thread indexed its band's rows from zero. */
+				assert(int(1 + (num_columns - 1)) == xscope_image[(2 * num_columns) + (num_columns - 1) + num_columns]);
+			}
+		}
 	}
 }
 
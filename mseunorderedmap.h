@@ -0,0 +1,552 @@
+
+// Copyright (c) 2015 Noah Lopez
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#ifndef MSEUNORDEREDMAP_H
+#define MSEUNORDEREDMAP_H
+
+#include "msemsearray.h"
+#include "msescope.h"
+#include <vector>
+#include <utility>
+#include <functional>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <mutex>
+#include <shared_mutex>
+#include <algorithm>
+#include <atomic>
+#include <system_error>
+
+#ifdef MSE_CUSTOM_THROW_DEFINITION
+#include <iostream>
+#define MSE_THROW(x) MSE_CUSTOM_THROW_DEFINITION(x)
+#else // MSE_CUSTOM_THROW_DEFINITION
+#define MSE_THROW(x) throw(x)
+#endif // MSE_CUSTOM_THROW_DEFINITION
+
+namespace mse {
+
+	namespace us {
+		namespace impl {
+			template<class _Key, class _Ty, class _Hash/* = std::hash<_Key>*/, class _KeyEqual/* = std::equal_to<_Key>*/, class _TStateMutex/* = mse::non_thread_safe_shared_mutex*/>
+			class gnii_unordered_map;
+		}
+	}
+
+	/* nii_unordered_map<> is an unordered (hash) map that, like nii_vector<>, does not support (implicit) iterators. Its
+	elements are stored in flat (contiguous) arrays and located via an open addressing (linear probing) index table. Lookups
+	of existing keys never change the structure of the map. Direct (scope) pointers to values can be obtained via an
+	xscope_structure_change_lock_guard (see make_xscope_unordered_map_structure_change_lock_guard()), which prevents any
+	insertion or removal of elements for as long as it exists. */
+	template<class _Key, class _Ty, class _Hash = std::hash<_Key>, class _KeyEqual = std::equal_to<_Key>, class _TStateMutex = mse::non_thread_safe_shared_mutex>
+	using nii_unordered_map = mse::us::impl::gnii_unordered_map<_Key, _Ty, _Hash, _KeyEqual, _TStateMutex>;
+
+	namespace impl {
+		namespace ns_gnii_unordered_map {
+			template<class _Key, class _Ty, class _Hash, class _KeyEqual, class _TStateMutex>
+			class xscope_structure_change_lock_guard;
+		}
+	}
+
+	namespace us {
+		namespace impl {
+
+			template<class _Key, class _Ty, class _Hash/* = std::hash<_Key>*/, class _KeyEqual/* = std::equal_to<_Key>*/, class _TStateMutex/* = mse::non_thread_safe_shared_mutex*/>
+			class gnii_unordered_map {
+			public:
+				typedef gnii_unordered_map _Myt;
+				typedef _Key key_type;
+				typedef _Ty mapped_type;
+				typedef _Hash hasher;
+				typedef _KeyEqual key_equal;
+				typedef std::pair<_Key, _Ty> value_type;
+				typedef size_t size_type;
+				typedef std::ptrdiff_t difference_type;
+
+				gnii_unordered_map() {}
+				gnii_unordered_map(_XSTD initializer_list<value_type> _Ilist) {
+					reserve(_Ilist.size());
+					for (const auto& item : _Ilist) {
+						try_emplace(item.first, item.second);
+					}
+				}
+				gnii_unordered_map(const _Myt& _Right) {
+					CConstTraversalGuard src_guard(_Right);
+					m_keys = _Right.m_keys;
+					m_values = _Right.m_values;
+					m_hashes = _Right.m_hashes;
+					m_index_table = _Right.m_index_table;
+					m_index_table_bits = _Right.m_index_table_bits;
+				}
+				gnii_unordered_map(_Myt&& _Right) {
+					_Right.const_traversal_check();
+					std::lock_guard<_TStateMutex> src_lock(_Right.m_structure_change_mutex);
+					m_keys = std::move(_Right.m_keys);
+					m_values = std::move(_Right.m_values);
+					m_hashes = std::move(_Right.m_hashes);
+					m_index_table = std::move(_Right.m_index_table);
+					m_index_table_bits = _Right.m_index_table_bits;
+					_Right.reset_to_empty();
+				}
+
+				~gnii_unordered_map() {
+					mse::impl::destructor_lock_guard1<decltype(m_structure_change_mutex)> lock1(m_structure_change_mutex);
+
+					/* This is just a no-op function that will cause a compile error when _Key or _Ty is not an eligible type. */
+					valid_if_Key_and_Ty_are_not_xscope_types();
+				}
+
+				_Myt& operator=(const _Myt& _Right) {
+					if (std::addressof(_Right) != this) {
+						/* Like move assignment, the source is protected from structure changes while it's being copied. But
+						since the source is const, this is done via the (thread safe) const traversal count rather than
+						the (non-thread-safe) structure change mutex. */
+						CConstTraversalGuard src_guard(_Right);
+						const_traversal_check();
+						std::lock_guard<decltype(m_structure_change_mutex)> lock1(m_structure_change_mutex);
+						m_keys = _Right.m_keys;
+						m_values = _Right.m_values;
+						m_hashes = _Right.m_hashes;
+						m_index_table = _Right.m_index_table;
+						m_index_table_bits = _Right.m_index_table_bits;
+					}
+					return (*this);
+				}
+				_Myt& operator=(_Myt&& _Right) {
+					if (std::addressof(_Right) != this) {
+						_Right.const_traversal_check();
+						const_traversal_check();
+						std::lock_guard<_TStateMutex> src_lock(_Right.m_structure_change_mutex);
+						const_traversal_check();
+						std::lock_guard<decltype(m_structure_change_mutex)> lock1(m_structure_change_mutex);
+						m_keys = std::move(_Right.m_keys);
+						m_values = std::move(_Right.m_values);
+						m_hashes = std::move(_Right.m_hashes);
+						m_index_table = std::move(_Right.m_index_table);
+						m_index_table_bits = _Right.m_index_table_bits;
+						_Right.reset_to_empty();
+					}
+					return (*this);
+				}
+
+				size_type size() const _NOEXCEPT { return m_keys.size(); }
+				bool empty() const _NOEXCEPT { return m_keys.empty(); }
+				/* The number of slots in the (open addressing) index table. */
+				size_type bucket_count() const _NOEXCEPT { return m_index_table.size(); }
+				float load_factor() const _NOEXCEPT {
+					return (0 == bucket_count()) ? 0.0f : float(size()) / float(bucket_count());
+				}
+
+				void reserve(size_type count) {
+					const_traversal_check();
+					std::lock_guard<decltype(m_structure_change_mutex)> lock1(m_structure_change_mutex);
+					reserve_helper(count);
+				}
+				void clear() {
+					const_traversal_check();
+					std::lock_guard<decltype(m_structure_change_mutex)> lock1(m_structure_change_mutex);
+					m_keys.clear();
+					m_values.clear();
+					m_hashes.clear();
+					std::fill(m_index_table.begin(), m_index_table.end(), s_empty_slot());
+				}
+
+				size_type count(const _Key& key) const { return (s_npos() != find_dense_index(key)) ? 1 : 0; }
+				bool contains(const _Key& key) const { return (s_npos() != find_dense_index(key)); }
+
+				_Ty& at(const _Key& key) {
+					const auto dense_index = find_dense_index(key);
+					if (s_npos() == dense_index) { MSE_THROW(std::out_of_range("key not found - _Ty& at(const _Key& key) - gnii_unordered_map")); }
+					return m_values[dense_index];
+				}
+				const _Ty& at(const _Key& key) const {
+					const auto dense_index = find_dense_index(key);
+					if (s_npos() == dense_index) { MSE_THROW(std::out_of_range("key not found - const _Ty& at(const _Key& key) const - gnii_unordered_map")); }
+					return m_values[dense_index];
+				}
+				/* If the key is not already present, a default constructed value is inserted (which is a structure change). */
+				_Ty& operator[](const _Key& key) {
+					const auto hash = hash_of(key);
+					auto dense_index = find_dense_index(key, hash);
+					if (s_npos() == dense_index) {
+						const_traversal_check();
+						std::lock_guard<decltype(m_structure_change_mutex)> lock1(m_structure_change_mutex);
+						dense_index = insert_new_helper(hash, key);
+					}
+					return m_values[dense_index];
+				}
+
+				/* Inserts a value constructed from the given arguments if (and only if) the key is not already present. Returns
+				whether an insertion took place. */
+				template<class... _Valty>
+				bool try_emplace(const _Key& key, _Valty&&... _Val) {
+					const auto hash = hash_of(key);
+					if (s_npos() != find_dense_index(key, hash)) {
+						return false;
+					}
+					const_traversal_check();
+					std::lock_guard<decltype(m_structure_change_mutex)> lock1(m_structure_change_mutex);
+					insert_new_helper(hash, key, std::forward<_Valty>(_Val)...);
+					return true;
+				}
+				bool insert(const value_type& _X) {
+					return try_emplace(_X.first, _X.second);
+				}
+				bool insert(value_type&& _X) {
+					return try_emplace(_X.first, std::move(_X.second));
+				}
+				/* Returns true if a new element was inserted, false if an existing value was assigned. */
+				template<class _Ty2>
+				bool insert_or_assign(const _Key& key, _Ty2&& obj) {
+					const auto hash = hash_of(key);
+					const auto dense_index = find_dense_index(key, hash);
+					if (s_npos() != dense_index) {
+						m_values[dense_index] = std::forward<_Ty2>(obj);
+						return false;
+					}
+					const_traversal_check();
+					std::lock_guard<decltype(m_structure_change_mutex)> lock1(m_structure_change_mutex);
+					insert_new_helper(hash, key, std::forward<_Ty2>(obj));
+					return true;
+				}
+
+				size_type erase(const _Key& key) {
+					const auto hash = hash_of(key);
+					const auto slot_index = find_slot_index(key, hash);
+					if (s_npos() == slot_index) {
+						return 0;
+					}
+					const_traversal_check();
+					std::lock_guard<decltype(m_structure_change_mutex)> lock1(m_structure_change_mutex);
+					erase_slot_helper(slot_index);
+					return 1;
+				}
+
+				/* Since nii_unordered_map<> doesn't support iterators, the elements are visited via a function object taking
+				a (const) key reference and a value reference. Structure changes are disallowed for the duration. */
+				template<class _TFunction>
+				void for_each(_TFunction&& func) {
+					std::shared_lock<_TStateMutex> lock1(m_structure_change_mutex);
+					const auto sz = m_keys.size();
+					for (size_type i = 0; i < sz; i += 1) {
+						func(static_cast<const _Key&>(m_keys[i]), m_values[i]);
+					}
+				}
+				template<class _TFunction>
+				void for_each(_TFunction&& func) const {
+					/* Const member functions may be called concurrently from multiple threads, so rather than the
+					(non-thread-safe) structure change mutex, the (atomic) const traversal count is used to prevent structure
+					changes (via a mutable alias) for the duration. */
+					CConstTraversalGuard guard(*this);
+					const auto sz = m_keys.size();
+					for (size_type i = 0; i < sz; i += 1) {
+						func(m_keys[i], m_values[i]);
+					}
+				}
+				/* Invokes the given function object with a reference to the value associated with the key (if present).
+				Structure changes are disallowed for the duration, so the reference can't be invalidated by the function
+				object (inserting or removing elements via an alias of the map). Returns whether the key was present. */
+				template<class _TFunction>
+				bool visit(const _Key& key, _TFunction&& func) {
+					std::shared_lock<_TStateMutex> lock1(m_structure_change_mutex);
+					const auto dense_index = find_dense_index(key);
+					if (s_npos() == dense_index) {
+						return false;
+					}
+					func(m_values[dense_index]);
+					return true;
+				}
+				template<class _TFunction>
+				bool visit(const _Key& key, _TFunction&& func) const {
+					CConstTraversalGuard guard(*this);
+					const auto dense_index = find_dense_index(key);
+					if (s_npos() == dense_index) {
+						return false;
+					}
+					func(m_values[dense_index]);
+					return true;
+				}
+
+				void swap(_Myt& _Other) {
+					if (std::addressof(_Other) != this) {
+						const_traversal_check();
+						std::lock_guard<decltype(m_structure_change_mutex)> lock1(m_structure_change_mutex);
+						_Other.const_traversal_check();
+						std::lock_guard<decltype(m_structure_change_mutex)> lock2(_Other.m_structure_change_mutex);
+						m_keys.swap(_Other.m_keys);
+						m_values.swap(_Other.m_values);
+						m_hashes.swap(_Other.m_hashes);
+						m_index_table.swap(_Other.m_index_table);
+						std::swap(m_index_table_bits, _Other.m_index_table_bits);
+					}
+				}
+
+				bool operator==(const _Myt& _Right) const {
+					if (size() != _Right.size()) {
+						return false;
+					}
+					const auto sz = m_keys.size();
+					for (size_type i = 0; i < sz; i += 1) {
+						const auto right_dense_index = _Right.find_dense_index(m_keys[i], m_hashes[i]);
+						if ((s_npos() == right_dense_index) || (!(m_values[i] == _Right.m_values[right_dense_index]))) {
+							return false;
+						}
+					}
+					return true;
+				}
+				bool operator!=(const _Myt& _Right) const {
+					return !((*this) == _Right);
+				}
+
+				template<class dummyT = int, class = typename std::enable_if<(std::is_same<dummyT, int>::value)
+					&& (mse::impl::is_marked_as_shareable_msemsearray<_Key>::value)
+					&& (mse::impl::is_marked_as_shareable_msemsearray<_Ty>::value), void>::type>
+				void async_shareable_tag() const {}
+				template<class dummyT = int, class = typename std::enable_if<(std::is_same<dummyT, int>::value)
+					&& (mse::impl::is_marked_as_passable_msemsearray<_Key>::value)
+					&& (mse::impl::is_marked_as_passable_msemsearray<_Ty>::value), void>::type>
+				void async_passable_tag() const {}
+
+			private:
+				/* If _Key or _Ty is an xscope type, then the following member function will not instantiate, causing an
+				(intended) compile error. */
+				template<class _Key2 = _Key, class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Key2, _Key>::value)
+					&& (std::is_same<_Ty2, _Ty>::value) && (!std::is_base_of<mse::us::impl::XScopeTagBase, _Key2>::value)
+					&& (!std::is_base_of<mse::us::impl::XScopeTagBase, _Ty2>::value), void>::type>
+				void valid_if_Key_and_Ty_are_not_xscope_types() const {}
+
+				static constexpr size_type s_npos() { return (std::numeric_limits<size_type>::max)(); }
+				static constexpr size_type s_empty_slot() { return s_npos(); }
+				static constexpr size_type s_min_index_table_bits() { return 3; }
+
+				size_t hash_of(const _Key& key) const { return size_t(_Hash()(key)); }
+				/* Fibonacci hashing spreads the (possibly poorly distributed) hash values over the (power of two sized)
+				index table. */
+				size_type home_slot_of(size_t hash) const {
+					assert(1 <= m_index_table_bits);
+					return size_type((uint64_t(hash) * uint64_t(0x9E3779B97F4A7C15ull)) >> (64 - m_index_table_bits));
+				}
+				size_type slot_mask() const { return m_index_table.size() - 1; }
+
+				size_type find_slot_index(const _Key& key, size_t hash) const {
+					if (m_keys.empty()) {
+						return s_npos();
+					}
+					const auto mask = slot_mask();
+					for (auto slot_index = home_slot_of(hash); ; slot_index = (slot_index + 1) & mask) {
+						const auto dense_index = m_index_table[slot_index];
+						if (s_empty_slot() == dense_index) {
+							return s_npos();
+						}
+						if ((hash == m_hashes[dense_index]) && _KeyEqual()(m_keys[dense_index], key)) {
+							return slot_index;
+						}
+					}
+				}
+				size_type find_dense_index(const _Key& key, size_t hash) const {
+					const auto slot_index = find_slot_index(key, hash);
+					return (s_npos() == slot_index) ? s_npos() : m_index_table[slot_index];
+				}
+				size_type find_dense_index(const _Key& key) const {
+					return find_dense_index(key, hash_of(key));
+				}
+
+				/* The index table is kept at most half full. */
+				void reserve_helper(size_type count) {
+					size_type required_bits = s_min_index_table_bits();
+					while ((size_type(1) << required_bits) < 2 * count) {
+						required_bits += 1;
+					}
+					if (required_bits > m_index_table_bits) {
+						rebuild_index_table(required_bits);
+					}
+					m_keys.reserve(count);
+					m_values.reserve(count);
+					m_hashes.reserve(count);
+				}
+				void rebuild_index_table(size_type new_bits) {
+					m_index_table.assign(size_type(1) << new_bits, s_empty_slot());
+					m_index_table_bits = new_bits;
+					const auto mask = slot_mask();
+					const auto sz = m_keys.size();
+					for (size_type dense_index = 0; dense_index < sz; dense_index += 1) {
+						auto slot_index = home_slot_of(m_hashes[dense_index]);
+						while (s_empty_slot() != m_index_table[slot_index]) {
+							slot_index = (slot_index + 1) & mask;
+						}
+						m_index_table[slot_index] = dense_index;
+					}
+				}
+
+				/* Assumes the key is not already present and that the structure change lock is held. */
+				template<class... _Valty>
+				size_type insert_new_helper(size_t hash, const _Key& key, _Valty&&... _Val) {
+					/* Only the index table is grown here. The element arrays are left to grow on their own so that arguments
+					referring to existing elements remain valid until they are used. */
+					const auto new_size = m_keys.size() + 1;
+					if (m_index_table.size() < 2 * new_size) {
+						auto new_bits = (std::max)(m_index_table_bits + 1, s_min_index_table_bits());
+						while ((size_type(1) << new_bits) < 2 * new_size) {
+							new_bits += 1;
+						}
+						rebuild_index_table(new_bits);
+					}
+					m_values.emplace_back(std::forward<_Valty>(_Val)...);
+					try {
+						m_keys.push_back(key);
+						try {
+							m_hashes.push_back(hash);
+						}
+						catch (...) {
+							m_keys.pop_back();
+							throw;
+						}
+					}
+					catch (...) {
+						m_values.pop_back();
+						throw;
+					}
+					const auto dense_index = m_keys.size() - 1;
+					const auto mask = slot_mask();
+					auto slot_index = home_slot_of(hash);
+					while (s_empty_slot() != m_index_table[slot_index]) {
+						slot_index = (slot_index + 1) & mask;
+					}
+					m_index_table[slot_index] = dense_index;
+					return dense_index;
+				}
+
+				/* Assumes the structure change lock is held. The vacated slot is filled using "backward shift deletion" (so
+				no tombstones are needed), and the vacated dense position is filled with the last element. */
+				void erase_slot_helper(size_type slot_index) {
+					const auto dense_index = m_index_table[slot_index];
+					const auto mask = slot_mask();
+
+					auto hole = slot_index;
+					for (auto next = (hole + 1) & mask; s_empty_slot() != m_index_table[next]; next = (next + 1) & mask) {
+						const auto home = home_slot_of(m_hashes[m_index_table[next]]);
+						/* The entry at "next" can be moved into the hole only if its home slot is not (cyclically) in (hole, next]. */
+						if (((next - home) & mask) >= ((next - hole) & mask)) {
+							m_index_table[hole] = m_index_table[next];
+							hole = next;
+						}
+					}
+					m_index_table[hole] = s_empty_slot();
+
+					const auto last_dense_index = m_keys.size() - 1;
+					if (dense_index != last_dense_index) {
+						/* Redirect the index table slot referring to the last element to its new dense position. */
+						for (auto slot = home_slot_of(m_hashes[last_dense_index]); ; slot = (slot + 1) & mask) {
+							if (last_dense_index == m_index_table[slot]) {
+								m_index_table[slot] = dense_index;
+								break;
+							}
+						}
+						m_keys[dense_index] = std::move(m_keys[last_dense_index]);
+						m_values[dense_index] = std::move(m_values[last_dense_index]);
+						m_hashes[dense_index] = m_hashes[last_dense_index];
+					}
+					m_keys.pop_back();
+					m_values.pop_back();
+					m_hashes.pop_back();
+				}
+
+				/* Registers an ongoing traversal (or copy) of a const map, during which structure changes are not
+				permitted. */
+				class CConstTraversalGuard {
+				public:
+					CConstTraversalGuard(const _Myt& map_cref) : m_map_cref(map_cref) {
+						m_map_cref.m_const_traversal_count.fetch_add(1, std::memory_order_relaxed);
+					}
+					~CConstTraversalGuard() {
+						m_map_cref.m_const_traversal_count.fetch_sub(1, std::memory_order_relaxed);
+					}
+				private:
+					const _Myt& m_map_cref;
+				};
+				void const_traversal_check() const {
+					if (0 != m_const_traversal_count.load(std::memory_order_relaxed)) {
+						MSE_THROW(std::system_error(std::make_error_code(std::errc::resource_deadlock_would_occur)));
+					}
+				}
+
+				void reset_to_empty() {
+					m_keys.clear();
+					m_values.clear();
+					m_hashes.clear();
+					m_index_table.clear();
+					m_index_table_bits = 0;
+				}
+
+				/* The elements are stored in (parallel) contiguous arrays. m_index_table maps (hashed) slots to positions in
+				those arrays. */
+				std::vector<_Key> m_keys;
+				std::vector<_Ty> m_values;
+				std::vector<size_t> m_hashes;
+				std::vector<size_type> m_index_table;
+				size_type m_index_table_bits = 0;
+
+				_TStateMutex m_structure_change_mutex;
+				/* The number of ongoing traversals (and copies) of the map via const references. */
+				mutable std::atomic<size_type> m_const_traversal_count{ 0 };
+
+				friend class mse::impl::ns_gnii_unordered_map::xscope_structure_change_lock_guard<_Key, _Ty, _Hash, _KeyEqual, _TStateMutex>;
+
+				friend void swap(_Myt& a, _Myt& b) { a.swap(b); }
+			};
+		}
+	}
+
+	namespace impl {
+		namespace ns_gnii_unordered_map {
+			/* While an instance of xscope_structure_change_lock_guard exists it ensures that direct (scope) pointers to
+			values in the map do not become invalid by preventing any operation that might insert or remove elements. Any
+			attempt to execute such an operation would result in an exception. */
+			template<class _Key, class _Ty, class _Hash, class _KeyEqual, class _TStateMutex>
+			class xscope_structure_change_lock_guard : public mse::us::impl::XScopeTagBase {
+			public:
+				typedef mse::us::impl::gnii_unordered_map<_Key, _Ty, _Hash, _KeyEqual, _TStateMutex> map_t;
+
+				xscope_structure_change_lock_guard(const mse::TXScopeFixedPointer<map_t>& owner_ptr) : m_stored_ptr(owner_ptr), m_shared_lock((*owner_ptr).m_structure_change_mutex) {}
+#if !defined(MSE_SCOPEPOINTER_DISABLED)
+				xscope_structure_change_lock_guard(const mse::TXScopeItemFixedPointer<map_t>& owner_ptr) : m_stored_ptr(owner_ptr), m_shared_lock((*owner_ptr).m_structure_change_mutex) {}
+#endif // !defined(MSE_SCOPEPOINTER_DISABLED)
+
+				/* Throws std::out_of_range if the key is not present. */
+				auto xscope_ptr_to_value(const _Key& key) const {
+					return mse::us::unsafe_make_xscope_pointer_to((*m_stored_ptr).at(key));
+				}
+				auto target_container_ptr() const {
+					return m_stored_ptr;
+				}
+				void async_not_shareable_and_not_passable_tag() const {}
+
+			private:
+				mse::TXScopeItemFixedPointer<map_t> m_stored_ptr;
+				std::shared_lock<_TStateMutex> m_shared_lock;
+			};
+		}
+	}
+
+	/* While an instance of xscope_structure_change_lock_guard exists it ensures that direct (scope) pointers to
+	values in the map do not become invalid by preventing any operation that might insert or remove elements. Any
+	attempt to execute such an operation would result in an exception. */
+	template<class _Key, class _Ty, class _Hash, class _KeyEqual, class _TStateMutex>
+	auto make_xscope_unordered_map_structure_change_lock_guard(const mse::TXScopeFixedPointer<mse::us::impl::gnii_unordered_map<_Key, _Ty, _Hash, _KeyEqual, _TStateMutex> >& owner_ptr) {
+		return mse::impl::ns_gnii_unordered_map::xscope_structure_change_lock_guard<_Key, _Ty, _Hash, _KeyEqual, _TStateMutex>(owner_ptr);
+	}
+#if !defined(MSE_SCOPEPOINTER_DISABLED)
+	template<class _Key, class _Ty, class _Hash, class _KeyEqual, class _TStateMutex>
+	auto make_xscope_unordered_map_structure_change_lock_guard(const mse::TXScopeItemFixedPointer<mse::us::impl::gnii_unordered_map<_Key, _Ty, _Hash, _KeyEqual, _TStateMutex> >& owner_ptr) {
+		return mse::impl::ns_gnii_unordered_map::xscope_structure_change_lock_guard<_Key, _Ty, _Hash, _KeyEqual, _TStateMutex>(owner_ptr);
+	}
+#endif // !defined(MSE_SCOPEPOINTER_DISABLED)
+}
+
+#endif /*ndef MSEUNORDEREDMAP_H*/